@@ -0,0 +1,238 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "generator.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "utils/common.h"
+
+/// The number of members of generated structs and enums.
+#define BENCH_GEN_MEMBER_COUNT 32
+
+/// The minimum depth of generated expression trees.
+#define BENCH_GEN_MIN_EXPR_DEPTH 24
+
+/// The maximum depth of generated expression trees.
+#define BENCH_GEN_MAX_EXPR_DEPTH 64
+
+/**
+ * \brief Represents the state of the generator.
+ */
+typedef struct bench_gen_t
+{
+  tau_string_t* src; // The generated source.
+  uint64_t state; // State of the pseudo-random number generator.
+} bench_gen_t;
+
+/**
+ * \brief Returns the next pseudo-random number in `[0, bound)`.
+ */
+static size_t bench_gen_rand(bench_gen_t* gen, size_t bound)
+{
+  // xorshift64*
+  gen->state ^= gen->state >> 12;
+  gen->state ^= gen->state << 25;
+  gen->state ^= gen->state >> 27;
+
+  return (size_t)((gen->state * 0x2545F4914F6CDD1DULL) >> 32) % bound;
+}
+
+/**
+ * \brief Appends formatted text to the generated source.
+ */
+static void bench_gen_printf(bench_gen_t* gen, const char* fmt, ...)
+{
+  char buf[256];
+
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+
+  TAU_ASSERT(len >= 0 && (size_t)len < sizeof(buf));
+
+  tau_string_append_cstr(gen->src, buf);
+}
+
+static void bench_gen_function(bench_gen_t* gen, size_t idx)
+{
+  bench_gen_printf(gen, "fun func%zu(a: i32, b: i32): i32 {\n", idx);
+  bench_gen_printf(gen, "  x: mut i32 = a * %zu + b\n", 1 + bench_gen_rand(gen, 99));
+  bench_gen_printf(gen, "  y: i32 = (x - %zu) / %zu\n", bench_gen_rand(gen, 99), 1 + bench_gen_rand(gen, 99));
+
+  for (size_t i = 0, count = 2 + bench_gen_rand(gen, 5); i < count; i++)
+    bench_gen_printf(gen, "  x = x %c y * %zu\n", "+-"[bench_gen_rand(gen, 2)], 1 + bench_gen_rand(gen, 9));
+
+  bench_gen_printf(gen, "  if x > y then {\n    x = x - y\n  } else {\n    x = x + %zu\n  }\n", 1 + bench_gen_rand(gen, 99));
+  bench_gen_printf(gen, "  while x > %zu do x = x - %zu\n", 100 + bench_gen_rand(gen, 900), 1 + bench_gen_rand(gen, 9));
+
+  if (idx > 0)
+    bench_gen_printf(gen, "  return x + func%zu(y, a)\n}\n\n", bench_gen_rand(gen, idx));
+  else
+    bench_gen_printf(gen, "  return x + y\n}\n\n");
+}
+
+/**
+ * \brief Generates an expression tree of the given depth.
+ *
+ * \details One operand of every operator is a subtree of the remaining depth
+ * and the other one a shallow subtree, so the size of the tree grows linearly
+ * with its depth. Parentheses are omitted at random, leaving the precedence of
+ * the operators to the parser.
+ *
+ * Bitwise operators do not convert literals to the type of the other operand,
+ * so every deep subtree ends in a variable, and bitwise expressions and their
+ * operands are always grouped so precedence cannot move a literal next to one.
+ */
+static void bench_gen_expr(bench_gen_t* gen, size_t depth, bool allow_literal, bool is_grouped)
+{
+  static const char* const vars[] = { "a", "b", "c" };
+  static const char* const arit_ops[] = { "+", "-", "*", "/", "%" };
+  static const char* const bit_ops[] = { "&", "|", "^", "<<", ">>" };
+
+  if (depth == 0)
+  {
+    if (allow_literal && bench_gen_rand(gen, 3) == 0)
+      bench_gen_printf(gen, "%zu", 1 + bench_gen_rand(gen, 99));
+    else
+      bench_gen_printf(gen, "%s", vars[bench_gen_rand(gen, TAU_COUNTOF(vars))]);
+
+    return;
+  }
+
+  bool is_bitwise = bench_gen_rand(gen, 3) == 0;
+  const char* op = is_bitwise ? bit_ops[bench_gen_rand(gen, TAU_COUNTOF(bit_ops))] : arit_ops[bench_gen_rand(gen, TAU_COUNTOF(arit_ops))];
+
+  is_grouped = is_grouped || is_bitwise || bench_gen_rand(gen, 2) == 0;
+  size_t shallow_depth = TAU_MIN(bench_gen_rand(gen, 3), depth - 1);
+
+  if (is_grouped)
+    tau_string_append_cstr(gen->src, "(");
+
+  if (bench_gen_rand(gen, 2) == 0)
+  {
+    bench_gen_expr(gen, depth - 1, false, is_bitwise);
+    bench_gen_printf(gen, " %s ", op);
+    bench_gen_expr(gen, shallow_depth, !is_bitwise, is_bitwise);
+  }
+  else
+  {
+    bench_gen_expr(gen, shallow_depth, !is_bitwise, is_bitwise);
+    bench_gen_printf(gen, " %s ", op);
+    bench_gen_expr(gen, depth - 1, false, is_bitwise);
+  }
+
+  if (is_grouped)
+    tau_string_append_cstr(gen->src, ")");
+}
+
+static void bench_gen_expression(bench_gen_t* gen, size_t idx)
+{
+  size_t depth = BENCH_GEN_MIN_EXPR_DEPTH + bench_gen_rand(gen, BENCH_GEN_MAX_EXPR_DEPTH - BENCH_GEN_MIN_EXPR_DEPTH + 1);
+
+  bench_gen_printf(gen, "fun e%zu(a: i32, b: i32, c: i32): i32 {\n  return ", idx);
+  bench_gen_expr(gen, depth, false, false);
+  tau_string_append_cstr(gen->src, "\n}\n\n");
+}
+
+static void bench_gen_declaration(bench_gen_t* gen, size_t idx)
+{
+  static const char* const types[] = { "i32", "i64", "u8", "u16", "f32", "f64", "bool", "*u8", "vec4f32", "mat3f32" };
+
+  bench_gen_printf(gen, "struct S%zu {\n  pub m0: i32\n", idx);
+
+  for (size_t i = 1; i < BENCH_GEN_MEMBER_COUNT; i++)
+  {
+    // Odd structs nest even ones every now and then. Even structs nest none,
+    // so sizes stay bounded.
+    if (idx % 2 == 1 && bench_gen_rand(gen, 8) == 0)
+      bench_gen_printf(gen, "  pub m%zu: S%zu\n", i, 2 * bench_gen_rand(gen, (idx + 1) / 2));
+    else
+      bench_gen_printf(gen, "  pub m%zu: %s\n", i, types[bench_gen_rand(gen, TAU_COUNTOF(types))]);
+  }
+
+  bench_gen_printf(gen, "}\n\nenum E%zu {\n", idx);
+
+  for (size_t i = 0; i < BENCH_GEN_MEMBER_COUNT; i++)
+    bench_gen_printf(gen, "  V%zu\n", i);
+
+  bench_gen_printf(gen, "}\n\nfun d%zu(a: i32): i32 {\n", idx);
+  bench_gen_printf(gen, "  s: mut S%zu = undef\n  s.m0 = a\n", idx);
+  bench_gen_printf(gen, "  e: E%zu = E%zu.V%zu\n", idx, idx, bench_gen_rand(gen, BENCH_GEN_MEMBER_COUNT));
+  bench_gen_printf(gen, "  return s.m0 + a\n}\n\n");
+}
+
+static void bench_gen_vector(bench_gen_t* gen, size_t idx)
+{
+  size_t n = 2 + bench_gen_rand(gen, 3);
+
+  bench_gen_printf(gen, "fun v%zu(a: vec%zuf32, b: vec%zuf32, m: mat%zuf32, q: mat%zuf32, k: f32): vec%zuf32 {\n", idx, n, n, n, n, n);
+  bench_gen_printf(gen, "  c0: vec%zuf32 = a * k + b\n", n);
+  bench_gen_printf(gen, "  p0: mat%zuf32 = m * k + q\n", n);
+
+  // Mutable vector and matrix locals cannot be initialized yet, so every step
+  // declares new ones.
+  size_t count = 2 + bench_gen_rand(gen, 5);
+
+  for (size_t i = 1; i <= count; i++)
+  {
+    bench_gen_printf(gen, "  c%zu: vec%zuf32 = (c%zu + a) * %zu.5 - b * k\n", i, n, i - 1, bench_gen_rand(gen, 10));
+    bench_gen_printf(gen, "  p%zu: mat%zuf32 = p%zu + q * k - m * %zu.25\n", i, n, i - 1, bench_gen_rand(gen, 10));
+  }
+
+  bench_gen_printf(gen, "  return c%zu + a - b\n}\n\n", count);
+}
+
+const char* bench_workload_to_cstr(bench_workload_t workload)
+{
+  switch (workload)
+  {
+  case BENCH_WORKLOAD_FUNCTIONS:    return "functions";
+  case BENCH_WORKLOAD_EXPRESSIONS:  return "expressions";
+  case BENCH_WORKLOAD_DECLARATIONS: return "declarations";
+  case BENCH_WORKLOAD_VECTORS:      return "vectors";
+  default: TAU_UNREACHABLE();
+  }
+
+  return NULL;
+}
+
+bench_workload_t bench_workload_from_cstr(const char* name)
+{
+  for (int i = 0; i < BENCH_WORKLOAD_COUNT; i++)
+    if (strcmp(bench_workload_to_cstr((bench_workload_t)i), name) == 0)
+      return (bench_workload_t)i;
+
+  return BENCH_WORKLOAD_COUNT;
+}
+
+tau_string_t* bench_generate(bench_workload_t workload, size_t scale, uint64_t seed)
+{
+  bench_gen_t gen = {
+    .src = tau_string_init(),
+    .state = seed ^ 0x9E3779B97F4A7C15ULL,
+  };
+
+  // xorshift never leaves the zero state.
+  if (gen.state == 0)
+    gen.state = 1;
+
+  for (size_t i = 0; i < scale; i++)
+    switch (workload)
+    {
+    case BENCH_WORKLOAD_FUNCTIONS:    bench_gen_function(&gen, i);    break;
+    case BENCH_WORKLOAD_EXPRESSIONS:  bench_gen_expression(&gen, i);  break;
+    case BENCH_WORKLOAD_DECLARATIONS: bench_gen_declaration(&gen, i); break;
+    case BENCH_WORKLOAD_VECTORS:      bench_gen_vector(&gen, i);      break;
+    default: TAU_UNREACHABLE();
+    }
+
+  return gen.src;
+}
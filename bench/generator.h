@@ -0,0 +1,62 @@
+/**
+ * \file
+ *
+ * \brief Synthetic Tau source generator.
+ *
+ * \details The generator produces Tau sources that stress one part of the
+ * compiler each. The sources are deterministic: the same workload, scale and
+ * seed always produce the same source, so results of different runs and
+ * different builds are comparable. Every generated source compiles without
+ * errors.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_BENCH_GENERATOR_H
+#define TAU_BENCH_GENERATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/str.h"
+
+/**
+ * \brief Enumeration of synthetic workloads.
+ */
+typedef enum bench_workload_t
+{
+  BENCH_WORKLOAD_FUNCTIONS, // Many functions with locals, branches, loops and calls.
+  BENCH_WORKLOAD_EXPRESSIONS, // Deeply nested expression trees.
+  BENCH_WORKLOAD_DECLARATIONS, // Long struct and enum declarations.
+  BENCH_WORKLOAD_VECTORS, // Vector and matrix arithmetic.
+  BENCH_WORKLOAD_COUNT // Number of workloads.
+} bench_workload_t;
+
+/**
+ * \brief Returns the name of a workload.
+ *
+ * \param[in] workload The workload.
+ * \returns The name of the workload.
+ */
+const char* bench_workload_to_cstr(bench_workload_t workload);
+
+/**
+ * \brief Finds a workload by its name.
+ *
+ * \param[in] name The name of the workload.
+ * \returns The workload or `BENCH_WORKLOAD_COUNT` if there is none.
+ */
+bench_workload_t bench_workload_from_cstr(const char* name);
+
+/**
+ * \brief Generates the source of a workload.
+ *
+ * \param[in] workload The workload to be generated.
+ * \param[in] scale The number of top-level declarations to be generated.
+ * \param[in] seed The seed of the pseudo-random choices.
+ * \returns Pointer to the newly generated source.
+ */
+tau_string_t* bench_generate(bench_workload_t workload, size_t scale, uint64_t seed);
+
+#endif
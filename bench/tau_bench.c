@@ -0,0 +1,619 @@
+/**
+ * \file
+ *
+ * \brief Compiler throughput benchmark.
+ *
+ * \details Compiles synthetic workloads in memory through the library and
+ * measures the time spent in each stage. Every workload is compiled several
+ * times after an unmeasured warmup and the median time of each stage is kept. The results are written as
+ * JSON, one workload per line, and can be compared against the results of an
+ * earlier run, failing if any workload got slower than the given tolerance.
+ *
+ * Back-to-back runs of a workload differ by around 30% even on an otherwise
+ * idle machine, through frequency scaling and cache effects, so single runs are
+ * not compared. The median damps outliers but keeps that spread on shared or
+ * virtualized machines, where both the repetitions and the tolerance have to
+ * be raised to keep the comparison stable.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "generator.h"
+#include "llvm.h"
+#include "ast/ast.h"
+#include "stages/analysis/ctrlflow.h"
+#include "stages/analysis/nameres.h"
+#include "stages/analysis/symtable.h"
+#include "stages/analysis/types/typebuilder.h"
+#include "stages/analysis/types/typecheck.h"
+#include "stages/analysis/types/typetable.h"
+#include "stages/codegen/codegen.h"
+#include "stages/lexer/lexer.h"
+#include "stages/lexer/token/registry.h"
+#include "stages/parser/parser.h"
+#include "utils/common.h"
+#include "utils/interner.h"
+#include "utils/timer.h"
+#include "utils/io/argparse.h"
+
+/// The maximum length of a line of a results file.
+#define BENCH_LINE_BUFFER_SIZE 1024
+
+/**
+ * \brief Enumeration of measured stages.
+ */
+typedef enum bench_stage_t
+{
+  BENCH_STAGE_LEXER,
+  BENCH_STAGE_PARSER,
+  BENCH_STAGE_NAMERES,
+  BENCH_STAGE_TYPECHECK,
+  BENCH_STAGE_CTRLFLOW,
+  BENCH_STAGE_CODEGEN,
+  BENCH_STAGE_EMIT,
+  BENCH_STAGE_COUNT
+} bench_stage_t;
+
+static const char* const g_bench_stage_names[BENCH_STAGE_COUNT] = {
+  "lexer", "parser", "nameres", "typecheck", "ctrlflow", "codegen", "emit"
+};
+
+/**
+ * \brief Represents the results of a workload.
+ */
+typedef struct bench_result_t
+{
+  bench_workload_t workload; // The measured workload.
+  size_t bytes; // Size of the source in bytes.
+  size_t lines; // Number of lines of the source.
+  size_t tokens; // Number of tokens of the source.
+  size_t nodes; // Number of AST nodes of the source.
+  uint64_t stages[BENCH_STAGE_COUNT]; // Median time of each stage in ticks.
+} bench_result_t;
+
+/**
+ * \brief Represents the benchmark options.
+ */
+typedef struct bench_options_t
+{
+  bool workloads[BENCH_WORKLOAD_COUNT]; // Whether each workload is run.
+  size_t scale; // Number of top-level declarations of each workload.
+  size_t repeat; // Number of times each workload is compiled.
+  uint64_t seed; // Seed of the generator.
+  const char* output; // Path to the results file or `NULL` for stdout.
+  const char* baseline; // Path to the baseline results file or `NULL`.
+  double tolerance; // Allowed slowdown against the baseline in percent.
+  bool should_exit; // Whether to exit after parsing the options.
+  bool is_failed; // Whether the options were invalid.
+} bench_options_t;
+
+/**
+ * \brief Enumeration of command-line options.
+ */
+typedef enum bench_option_kind_t
+{
+  BENCH_OPTION_HELP,      ///< -h, --help
+  BENCH_OPTION_WORKLOAD,  ///< -w, --workload <NAME>
+  BENCH_OPTION_SCALE,     ///< -n, --scale <N>
+  BENCH_OPTION_REPEAT,    ///< -r, --repeat <N>
+  BENCH_OPTION_SEED,      ///< --seed <N>
+  BENCH_OPTION_OUTPUT,    ///< -o, --output <FILE>
+  BENCH_OPTION_BASELINE,  ///< --baseline <FILE>
+  BENCH_OPTION_TOLERANCE, ///< --tolerance <PCT>
+} bench_option_kind_t;
+
+static const tau_argparse_option_t g_bench_argparse_opts[] = {
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_HELP,      "h",  "help",      NULL,   "Display this help message and exit."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_WORKLOAD,  "w",  "workload",  "NAME", "Run a workload (functions, expressions, declarations, vectors), all by default."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_SCALE,     "n",  "scale",     "N",    "Generate N top-level declarations per workload (default 200)."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_REPEAT,    "r",  "repeat",    "N",    "Compile each workload N times and keep the median (default 5)."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_SEED,      NULL, "seed",      "N",    "Seed the generator with N (default 1)."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_OUTPUT,    "o",  "output",    "FILE", "Write the results to FILE instead of stdout."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_BASELINE,  NULL, "baseline",  "FILE", "Fail if a workload is slower than in the results in FILE."),
+  TAU_ARGPARSE_OPTION(BENCH_OPTION_TOLERANCE, NULL, "tolerance", "PCT",  "Allow workloads to be PCT percent slower than the baseline (default 25).")
+};
+
+/**
+ * \brief Parses a number option that must be at least `min`.
+ */
+static uint64_t bench_options_number(bench_options_t* opts, tau_argparse_ctx_t* argp_ctx, const char* name, uint64_t min)
+{
+  const char* arg = tau_argparse_next_arg(argp_ctx);
+  char* end = NULL;
+
+  unsigned long long value = arg == NULL ? 0 : strtoull(arg, &end, 10);
+
+  if (arg == NULL || *end != '\0' || value < min)
+  {
+    fprintf(stderr, "Invalid %s: %s\n", name, arg == NULL ? "" : arg);
+    opts->is_failed = true;
+  }
+
+  return (uint64_t)value;
+}
+
+static void bench_options_parse(bench_options_t* opts, int argc, const char* argv[])
+{
+  memset(opts, 0, sizeof(bench_options_t));
+
+  opts->scale = 200;
+  opts->repeat = 5;
+  opts->seed = 1;
+  opts->tolerance = 25.0;
+
+  bool has_workload = false;
+
+  tau_argparse_ctx_t* argp_ctx = tau_argparse_ctx_init(g_bench_argparse_opts, TAU_COUNTOF(g_bench_argparse_opts), argv, argc);
+
+  int opt_id;
+
+  while (!opts->should_exit && !opts->is_failed && (opt_id = tau_argparse_fetch(argp_ctx)) != TAU_ARGPARSE_EOA)
+  {
+    switch (opt_id)
+    {
+    case BENCH_OPTION_HELP:
+    {
+      puts("Usage: tau_bench [OPTIONS...]\n");
+      tau_argparse_print_options(argp_ctx, stdout);
+      opts->should_exit = true;
+      break;
+    }
+    case BENCH_OPTION_WORKLOAD:
+    {
+      const char* arg = tau_argparse_next_arg(argp_ctx);
+      bench_workload_t workload = arg == NULL ? BENCH_WORKLOAD_COUNT : bench_workload_from_cstr(arg);
+
+      if (workload == BENCH_WORKLOAD_COUNT)
+      {
+        fprintf(stderr, "Unknown workload: %s\n", arg == NULL ? "" : arg);
+        opts->is_failed = true;
+        break;
+      }
+
+      opts->workloads[workload] = true;
+      has_workload = true;
+      break;
+    }
+    case BENCH_OPTION_SCALE:    opts->scale = (size_t)bench_options_number(opts, argp_ctx, "scale", 1);         break;
+    case BENCH_OPTION_REPEAT:   opts->repeat = (size_t)bench_options_number(opts, argp_ctx, "repeat count", 1); break;
+    case BENCH_OPTION_SEED:     opts->seed = bench_options_number(opts, argp_ctx, "seed", 0);                   break;
+    case BENCH_OPTION_OUTPUT:   opts->output = tau_argparse_next_arg(argp_ctx);                                 break;
+    case BENCH_OPTION_BASELINE: opts->baseline = tau_argparse_next_arg(argp_ctx);                               break;
+    case BENCH_OPTION_TOLERANCE:
+    {
+      const char* arg = tau_argparse_next_arg(argp_ctx);
+      char* end = NULL;
+
+      opts->tolerance = arg == NULL ? -1.0 : strtod(arg, &end);
+
+      if (opts->tolerance < 0.0 || *end != '\0')
+      {
+        fprintf(stderr, "Invalid tolerance: %s\n", arg == NULL ? "" : arg);
+        opts->is_failed = true;
+      }
+
+      break;
+    }
+    case TAU_ARGPARSE_UNKNOWN:
+    {
+      fprintf(stderr, "Unknown argument: %s\n", tau_argparse_get_arg_at(argp_ctx, tau_argparse_get_index(argp_ctx) - 1));
+      opts->is_failed = true;
+      break;
+    }
+    default: TAU_UNREACHABLE();
+    }
+  }
+
+  tau_argparse_ctx_free(argp_ctx);
+
+  if (!has_workload)
+    for (int i = 0; i < BENCH_WORKLOAD_COUNT; i++)
+      opts->workloads[i] = true;
+}
+
+/**
+ * \brief Prints the diagnostics of a failed stage.
+ */
+static bool bench_check_errors(tau_error_bag_t* errors, bench_stage_t stage)
+{
+  if (tau_error_bag_empty(errors))
+    return true;
+
+  fprintf(stderr, "Generated source failed in %s.\n", g_bench_stage_names[stage]);
+  tau_error_bag_print(errors);
+
+  return false;
+}
+
+/**
+ * \brief Compiles a source once, recording the time of each stage.
+ */
+static bool bench_compile(bench_result_t* result, const char* path, const char* src, uint64_t stages[BENCH_STAGE_COUNT])
+{
+  LLVMContextRef llvm_context = tau_llvm_get_context();
+  LLVMModuleRef llvm_module = LLVMModuleCreateWithNameInContext("bench", llvm_context);
+  LLVMBuilderRef llvm_builder = LLVMCreateBuilderInContext(llvm_context);
+
+  tau_vector_t* tokens = tau_vector_init();
+  tau_arena_t* arena = tau_arena_init();
+  tau_symtable_t* symtable = tau_symtable_init(NULL);
+  tau_typebuilder_t* typebuilder = tau_typebuilder_init(llvm_context, tau_llvm_get_data());
+  tau_typetable_t* typetable = tau_typetable_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_ast_node_t* root = NULL;
+  bool is_compiled = false;
+  uint64_t begin = 0;
+
+  {
+    tau_lexer_t* lexer = tau_lexer_init();
+
+    begin = tau_timer_now();
+    tau_lexer_lex(lexer, path, src, tokens, errors);
+    stages[BENCH_STAGE_LEXER] = tau_timer_now() - begin;
+
+    tau_lexer_free(lexer);
+
+    if (!bench_check_errors(errors, BENCH_STAGE_LEXER))
+      goto cleanup;
+  }
+
+  {
+    tau_parser_t* parser = tau_parser_init();
+
+    begin = tau_timer_now();
+    root = tau_parser_parse(parser, tokens, arena, errors);
+    stages[BENCH_STAGE_PARSER] = tau_timer_now() - begin;
+
+    tau_parser_free(parser);
+
+    if (!bench_check_errors(errors, BENCH_STAGE_PARSER))
+      goto cleanup;
+  }
+
+  {
+    tau_nameres_ctx_t* ctx = tau_nameres_ctx_init(symtable, errors);
+
+    begin = tau_timer_now();
+    tau_ast_node_nameres(ctx, root);
+    stages[BENCH_STAGE_NAMERES] = tau_timer_now() - begin;
+
+    tau_nameres_ctx_free(ctx);
+
+    if (!bench_check_errors(errors, BENCH_STAGE_NAMERES))
+      goto cleanup;
+  }
+
+  {
+    tau_typecheck_ctx_t* ctx = tau_typecheck_ctx_init(typebuilder, typetable, errors);
+
+    begin = tau_timer_now();
+    tau_ast_node_typecheck(ctx, root);
+    stages[BENCH_STAGE_TYPECHECK] = tau_timer_now() - begin;
+
+    tau_typecheck_ctx_free(ctx);
+
+    if (!bench_check_errors(errors, BENCH_STAGE_TYPECHECK))
+      goto cleanup;
+  }
+
+  {
+    tau_ctrlflow_ctx_t* ctx = tau_ctrlflow_ctx_init(errors);
+
+    begin = tau_timer_now();
+    tau_ast_node_ctrlflow(ctx, root);
+    stages[BENCH_STAGE_CTRLFLOW] = tau_timer_now() - begin;
+
+    tau_ctrlflow_ctx_free(ctx);
+
+    if (!bench_check_errors(errors, BENCH_STAGE_CTRLFLOW))
+      goto cleanup;
+  }
+
+  {
+    tau_codegen_ctx_t* ctx = tau_codegen_ctx_init(typebuilder, typetable, llvm_context, tau_llvm_get_data(), llvm_module, llvm_builder);
+
+    begin = tau_timer_now();
+    tau_ast_node_codegen(ctx, root);
+    stages[BENCH_STAGE_CODEGEN] = tau_timer_now() - begin;
+
+    tau_codegen_ctx_free(ctx);
+  }
+
+  char* llvm_error_str = NULL;
+
+  if (LLVMVerifyModule(llvm_module, LLVMReturnStatusAction, &llvm_error_str))
+  {
+    fprintf(stderr, "Generated source failed in codegen: %s\n", llvm_error_str);
+    LLVMDisposeMessage(llvm_error_str);
+    goto cleanup;
+  }
+
+  LLVMDisposeMessage(llvm_error_str);
+
+  {
+    LLVMMemoryBufferRef llvm_buffer = NULL;
+
+    begin = tau_timer_now();
+    LLVMBool is_failed = LLVMTargetMachineEmitToMemoryBuffer(tau_llvm_get_machine(), llvm_module, LLVMObjectFile, &llvm_error_str, &llvm_buffer);
+    stages[BENCH_STAGE_EMIT] = tau_timer_now() - begin;
+
+    if (is_failed)
+    {
+      fprintf(stderr, "Failed to emit object: %s\n", llvm_error_str);
+      LLVMDisposeMessage(llvm_error_str);
+      goto cleanup;
+    }
+
+    LLVMDisposeMemoryBuffer(llvm_buffer);
+  }
+
+  result->tokens = tau_vector_size(tokens);
+  result->nodes = tau_ast_node_count();
+  is_compiled = true;
+
+cleanup:
+  tau_error_bag_free(errors);
+  tau_typetable_free(typetable);
+  tau_typebuilder_free(typebuilder);
+  tau_symtable_free(symtable);
+  tau_arena_free(arena);
+  tau_vector_free(tokens);
+
+  LLVMDisposeBuilder(llvm_builder);
+  LLVMDisposeModule(llvm_module);
+
+  // Start every compilation from the same state, like the compiler does for
+  // every input file.
+  tau_token_registry_free();
+  tau_interner_free();
+  tau_ast_node_reset_count();
+  tau_llvm_thread_free();
+
+  return is_compiled;
+}
+
+static int bench_ticks_cmp(const void* lhs, const void* rhs)
+{
+  uint64_t lhs_ticks = *(const uint64_t*)lhs;
+  uint64_t rhs_ticks = *(const uint64_t*)rhs;
+
+  return lhs_ticks < rhs_ticks ? -1 : (lhs_ticks > rhs_ticks ? 1 : 0);
+}
+
+/**
+ * \brief Sorts the times of a stage over all runs and returns their median.
+ */
+static uint64_t bench_median(uint64_t* ticks, size_t count)
+{
+  qsort(ticks, count, sizeof(uint64_t), bench_ticks_cmp);
+
+  return count % 2 == 1 ? ticks[count / 2] : (ticks[count / 2 - 1] + ticks[count / 2]) / 2;
+}
+
+/**
+ * \brief Generates and compiles a workload, keeping the median time of each
+ * stage.
+ */
+static bool bench_run(bench_result_t* result, bench_workload_t workload, const bench_options_t* opts)
+{
+  char path[64];
+  snprintf(path, sizeof(path), "%s.tau", bench_workload_to_cstr(workload));
+
+  tau_string_t* src = bench_generate(workload, opts->scale, opts->seed);
+
+  memset(result, 0, sizeof(bench_result_t));
+
+  result->workload = workload;
+  result->bytes = tau_string_length(src);
+
+  for (const char* it = tau_string_begin(src); it != tau_string_end(src); it++)
+    if (*it == '\n')
+      result->lines++;
+
+  // The times of a run are stored stage by stage, so that the runs of a
+  // stage are contiguous.
+  uint64_t* ticks = (uint64_t*)calloc(opts->repeat * BENCH_STAGE_COUNT, sizeof(uint64_t));
+  TAU_ASSERT(ticks != NULL);
+
+  // The first compilation warms up caches and the allocator and is not
+  // measured.
+  uint64_t warmup[BENCH_STAGE_COUNT] = { 0 };
+
+  bool is_compiled = bench_compile(result, path, tau_string_begin(src), warmup);
+
+  for (size_t i = 0; i < opts->repeat && is_compiled; i++)
+  {
+    uint64_t stages[BENCH_STAGE_COUNT] = { 0 };
+
+    is_compiled = bench_compile(result, path, tau_string_begin(src), stages);
+
+    for (int j = 0; j < BENCH_STAGE_COUNT; j++)
+      ticks[(size_t)j * opts->repeat + i] = stages[j];
+  }
+
+  if (is_compiled)
+    for (int j = 0; j < BENCH_STAGE_COUNT; j++)
+      result->stages[j] = bench_median(ticks + (size_t)j * opts->repeat, opts->repeat);
+
+  free(ticks);
+  tau_string_free(src);
+
+  return is_compiled;
+}
+
+static double bench_ticks_to_ms(uint64_t ticks)
+{
+  return (double)ticks * 1000.0 / (double)tau_timer_freq();
+}
+
+static double bench_result_total_ms(const bench_result_t* result)
+{
+  uint64_t total = 0;
+
+  for (int i = 0; i < BENCH_STAGE_COUNT; i++)
+    total += result->stages[i];
+
+  return bench_ticks_to_ms(total);
+}
+
+/**
+ * \brief Returns a count per second of a stage.
+ */
+static double bench_result_per_sec(const bench_result_t* result, size_t count, bench_stage_t stage)
+{
+  double ms = bench_ticks_to_ms(result->stages[stage]);
+
+  return ms > 0.0 ? (double)count * 1000.0 / ms : 0.0;
+}
+
+static void bench_write_json(FILE* stream, const bench_options_t* opts, const bench_result_t* results, size_t result_count)
+{
+  fprintf(stream, "{\n  \"version\": \"%s\",\n  \"scale\": %zu,\n  \"repeat\": %zu,\n  \"seed\": %llu,\n  \"workloads\": [\n", TAU_VERSION, opts->scale, opts->repeat, (unsigned long long)opts->seed);
+
+  for (size_t i = 0; i < result_count; i++)
+  {
+    const bench_result_t* result = &results[i];
+
+    fprintf(stream, "    {\"name\": \"%s\", \"bytes\": %zu, \"lines\": %zu, \"tokens\": %zu, \"nodes\": %zu",
+      bench_workload_to_cstr(result->workload), result->bytes, result->lines, result->tokens, result->nodes);
+
+    for (int j = 0; j < BENCH_STAGE_COUNT; j++)
+      fprintf(stream, ", \"%s_ms\": %.3f", g_bench_stage_names[j], bench_ticks_to_ms(result->stages[j]));
+
+    fprintf(stream, ", \"total_ms\": %.3f, \"tokens_per_sec\": %.0f, \"nodes_per_sec\": %.0f}%s\n",
+      bench_result_total_ms(result),
+      bench_result_per_sec(result, result->tokens, BENCH_STAGE_LEXER),
+      bench_result_per_sec(result, result->nodes, BENCH_STAGE_PARSER),
+      i + 1 < result_count ? "," : ""
+    );
+  }
+
+  fputs("  ]\n}\n", stream);
+}
+
+/**
+ * \brief Finds the total time of a workload in a results file.
+ *
+ * \returns The total time in milliseconds or a negative value if the workload
+ * is missing.
+ */
+static double bench_baseline_total_ms(FILE* stream, const char* name)
+{
+  char line[BENCH_LINE_BUFFER_SIZE];
+  char key[64];
+
+  snprintf(key, sizeof(key), "\"name\": \"%s\",", name);
+
+  rewind(stream);
+
+  while (fgets(line, sizeof(line), stream) != NULL)
+  {
+    if (strstr(line, key) == NULL)
+      continue;
+
+    const char* total = strstr(line, "\"total_ms\": ");
+
+    if (total != NULL)
+      return strtod(total + strlen("\"total_ms\": "), NULL);
+  }
+
+  return -1.0;
+}
+
+/**
+ * \brief Compares the results against a baseline.
+ *
+ * \returns `true` if no workload is slower than the tolerance allows, `false`
+ * otherwise.
+ */
+static bool bench_compare(const bench_options_t* opts, const bench_result_t* results, size_t result_count)
+{
+  FILE* stream = fopen(opts->baseline, "r");
+
+  if (stream == NULL)
+  {
+    fprintf(stderr, "Failed to open baseline: %s\n", opts->baseline);
+    return false;
+  }
+
+  bool is_within = true;
+
+  for (size_t i = 0; i < result_count; i++)
+  {
+    const char* name = bench_workload_to_cstr(results[i].workload);
+    double baseline_ms = bench_baseline_total_ms(stream, name);
+    double total_ms = bench_result_total_ms(&results[i]);
+
+    if (baseline_ms <= 0.0)
+    {
+      fprintf(stderr, "%-12s no baseline\n", name);
+      continue;
+    }
+
+    double change = (total_ms / baseline_ms - 1.0) * 100.0;
+    bool is_regressed = change > opts->tolerance;
+
+    fprintf(stderr, "%-12s %10.3f ms, baseline %10.3f ms, %+6.1f%%%s\n", name, total_ms, baseline_ms, change, is_regressed ? " REGRESSION" : "");
+
+    is_within = is_within && !is_regressed;
+  }
+
+  fclose(stream);
+
+  return is_within;
+}
+
+int main(int argc, const char* argv[])
+{
+  bench_options_t opts;
+  bench_options_parse(&opts, argc, argv);
+
+  if (opts.should_exit || opts.is_failed)
+    return opts.is_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+  tau_llvm_init(LLVMCodeGenLevelNone);
+
+  bench_result_t results[BENCH_WORKLOAD_COUNT];
+  size_t result_count = 0;
+  int status = EXIT_SUCCESS;
+
+  for (int i = 0; i < BENCH_WORKLOAD_COUNT && status == EXIT_SUCCESS; i++)
+  {
+    if (!opts.workloads[i])
+      continue;
+
+    if (bench_run(&results[result_count], (bench_workload_t)i, &opts))
+      result_count++;
+    else
+      status = EXIT_FAILURE;
+  }
+
+  tau_llvm_free();
+
+  if (status != EXIT_SUCCESS)
+    return status;
+
+  FILE* stream = opts.output == NULL ? stdout : fopen(opts.output, "w");
+
+  if (stream == NULL)
+  {
+    fprintf(stderr, "Failed to open output: %s\n", opts.output);
+    return EXIT_FAILURE;
+  }
+
+  bench_write_json(stream, &opts, results, result_count);
+
+  if (stream != stdout)
+    fclose(stream);
+
+  if (opts.baseline != NULL && !bench_compare(&opts, results, result_count))
+    status = EXIT_FAILURE;
+
+  return status;
+}
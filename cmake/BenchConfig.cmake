@@ -0,0 +1,14 @@
+set(TAU_BENCH_BASELINE "" CACHE FILEPATH "Benchmark results to compare against, disabled if empty")
+set(TAU_BENCH_REPEAT 5 CACHE STRING "Number of benchmark runs per workload whose median is compared")
+# Back-to-back runs differ by around 30%, raise both on shared or virtualized machines.
+set(TAU_BENCH_TOLERANCE 25 CACHE STRING "Allowed benchmark slowdown against the baseline in percent")
+
+function(tau_add_bench TARGET)
+  file(GLOB_RECURSE TAU_BENCH_SOURCE_FILES ${PROJECT_SOURCE_DIR}/bench/*.c)
+
+  add_executable(${TARGET} ${TAU_BENCH_SOURCE_FILES})
+
+  if (TAU_BENCH_BASELINE)
+    add_test(NAME ${TARGET} COMMAND ${TARGET} --repeat ${TAU_BENCH_REPEAT} --baseline ${TAU_BENCH_BASELINE} --tolerance ${TAU_BENCH_TOLERANCE} --output ${CMAKE_BINARY_DIR}/${TARGET}.json)
+  endif ()
+endfunction()
@@ -29,16 +29,10 @@ typedef struct tau_ast_decl_enum_constant_t
 /**
  * \brief Initializes a new AST enum constant declaration node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_enum_constant_t* tau_ast_decl_enum_constant_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST enum constant declaration node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_enum_constant_free(tau_ast_decl_enum_constant_t* node);
+tau_ast_decl_enum_constant_t* tau_ast_decl_enum_constant_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST enum constant declaration node.
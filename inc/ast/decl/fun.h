@@ -21,7 +21,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_decl_fun_t
 {
   TAU_AST_DECL_HEADER;
-  tau_symtable_t* scope;            // The associated scope of parameters and function body.
   tau_ast_node_t* parent;           // The associated parent module declaration.
   tau_vector_t* params;             // Vector of associated parameter declarations.
   tau_ast_node_t* return_type;      // The associated return type.
@@ -39,16 +38,10 @@ typedef struct tau_ast_decl_fun_t
 /**
  * \brief Initializes a new AST function declaration node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_fun_t* tau_ast_decl_fun_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST function declaration node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_fun_free(tau_ast_decl_fun_t* node);
+tau_ast_decl_fun_t* tau_ast_decl_fun_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST function declaration node.
@@ -20,7 +20,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_decl_generic_fun_t
 {
   TAU_AST_DECL_HEADER;
-  tau_symtable_t* scope;        ///< The associated scope of the generic function declaration.
   tau_vector_t* generic_params; ///< Vector of generic parameter declarations.
   tau_vector_t* params;         ///< Vector of function parameter declarations.
   tau_ast_node_t* return_type;  ///< Pointer to the return type node.
@@ -30,16 +29,10 @@ typedef struct tau_ast_decl_generic_fun_t
 /**
  * \brief Initializes a new AST generic function declaration node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_generic_fun_t* tau_ast_decl_generic_fun_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST generic function declaration node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_generic_fun_free(tau_ast_decl_generic_fun_t* node);
+tau_ast_decl_generic_fun_t* tau_ast_decl_generic_fun_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST generic function declaration node.
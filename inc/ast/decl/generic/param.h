@@ -27,16 +27,10 @@ typedef struct tau_ast_decl_generic_param_t
 /**
  * \brief Initializes a new AST generic parameter declaration node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_generic_param_t* tau_ast_decl_generic_param_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST generic parameter declaration node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_generic_param_free(tau_ast_decl_generic_param_t* node);
+tau_ast_decl_generic_param_t* tau_ast_decl_generic_param_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST generic parameter declaration node.
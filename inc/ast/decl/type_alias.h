@@ -20,7 +20,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_decl_type_alias_t
 {
   TAU_AST_DECL_HEADER;
-  tau_symtable_t* scope;  ///< The associated scope of members.
   tau_ast_node_t* parent; ///< The associated parent module declaration.
   tau_ast_node_t* type;   ///< The associated type.
 
@@ -30,16 +29,10 @@ typedef struct tau_ast_decl_type_alias_t
 /**
  * \brief Initializes a new AST type alias declaration node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_type_alias_t* tau_ast_decl_type_alias_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST type alias declaration node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_type_alias_free(tau_ast_decl_type_alias_t* node);
+tau_ast_decl_type_alias_t* tau_ast_decl_type_alias_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST type alias declaration node.
@@ -31,16 +31,10 @@ typedef struct tau_ast_decl_var_t
 /**
  * \brief Initializes a new AST variable declaration node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_decl_var_t* tau_ast_decl_var_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST variable declaration node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_decl_var_free(tau_ast_decl_var_t* node);
+tau_ast_decl_var_t* tau_ast_decl_var_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST variable declaration node.
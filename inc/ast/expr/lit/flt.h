@@ -26,16 +26,10 @@ typedef struct tau_ast_expr_lit_flt_t
 /**
  * \brief Initializes a new AST literal float expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_lit_flt_t* tau_ast_expr_lit_flt_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST literal float expression node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_expr_lit_flt_free(tau_ast_expr_lit_flt_t* node);
+tau_ast_expr_lit_flt_t* tau_ast_expr_lit_flt_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST literal float expression node.
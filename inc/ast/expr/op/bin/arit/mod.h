@@ -27,9 +27,10 @@ typedef struct tau_ast_expr_op_bin_arit_mod_t
  * \brief Initializes a new AST binary arithmetic multiplication operation expression
  * node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_bin_arit_mod_t* tau_ast_expr_op_bin_arit_mod_init(void);
+tau_ast_expr_op_bin_arit_mod_t* tau_ast_expr_op_bin_arit_mod_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST binary arithmetic multiplication
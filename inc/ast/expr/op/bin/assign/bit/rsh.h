@@ -28,9 +28,10 @@ typedef struct tau_ast_expr_op_bin_assign_bit_rsh_t
  * \brief Initializes a new AST binary bitwise right-shift assignment operation
  * expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_bin_assign_bit_rsh_t* tau_ast_expr_op_bin_assign_bit_rsh_init(void);
+tau_ast_expr_op_bin_assign_bit_rsh_t* tau_ast_expr_op_bin_assign_bit_rsh_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST binary bitwise right-shift
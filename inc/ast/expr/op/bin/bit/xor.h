@@ -26,9 +26,10 @@ typedef struct tau_ast_expr_op_bin_bit_xor_t
 /**
  * \brief Initializes a new AST binary bitwise XOR operation expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_bin_bit_xor_t* tau_ast_expr_op_bin_bit_xor_init(void);
+tau_ast_expr_op_bin_bit_xor_t* tau_ast_expr_op_bin_bit_xor_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST binary bitwise XOR operation
@@ -26,9 +26,10 @@ typedef struct tau_ast_expr_op_bin_logic_or_t
 /**
  * \brief Initializes a new AST binary logical OR operation expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_bin_logic_or_t* tau_ast_expr_op_bin_logic_or_init(void);
+tau_ast_expr_op_bin_logic_or_t* tau_ast_expr_op_bin_logic_or_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST binary logical OR operation
@@ -27,16 +27,10 @@ typedef struct tau_ast_expr_op_spec_t
 /**
  * \brief Initializes a new AST generic specialization operation expression node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_spec_t* tau_ast_expr_op_spec_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST generic specialization operation expression node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_expr_op_spec_free(tau_ast_expr_op_spec_t* node);
+tau_ast_expr_op_spec_t* tau_ast_expr_op_spec_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST generic specialization operation expression node.
@@ -26,9 +26,10 @@ typedef struct tau_ast_expr_op_un_arit_dec_post_t
 /**
  * \brief Initializes a new AST unary post-decrement operation expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_un_arit_dec_post_t* tau_ast_expr_op_un_arit_dec_post_init(void);
+tau_ast_expr_op_un_arit_dec_post_t* tau_ast_expr_op_un_arit_dec_post_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST unary post-decrement operation
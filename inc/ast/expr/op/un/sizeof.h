@@ -25,9 +25,10 @@ typedef struct tau_ast_expr_op_un_sizeof_t
 /**
  * \brief Initializes a new AST unary sizeof operation expression node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_expr_op_un_sizeof_t* tau_ast_expr_op_un_sizeof_init(void);
+tau_ast_expr_op_un_sizeof_t* tau_ast_expr_op_un_sizeof_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST unary sizeof operation
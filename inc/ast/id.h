@@ -25,16 +25,10 @@ typedef struct tau_ast_id_t
 /**
  * \brief Initializes a new AST identifier node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_id_t* tau_ast_id_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST identifier node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_id_free(tau_ast_id_t* node);
+tau_ast_id_t* tau_ast_id_init(tau_arena_t* arena);
 
 /**
  * \brief Writes a JSON dump of an AST identifier node into a stream.
@@ -16,12 +16,14 @@
 #include "stages/codegen/codegen.h"
 #include "stages/lexer/token/token.h"
 #include "utils/common.h"
+#include "utils/memory/arena.h"
 
 /**
  * \brief Header for all AST nodes.
  */
 #define TAU_AST_NODE_HEADER\
   tau_ast_kind_t kind; /** AST node kind. */\
+  uint32_t uid; /** Dense unique identifier of the node. */\
   tau_token_t* tok /** The token associated with this node. */
 
 TAU_EXTERN_C_BEGIN
@@ -123,11 +125,35 @@ typedef struct tau_ast_node_t
 } tau_ast_node_t;
 
 /**
- * \brief Frees all memory allocated by an AST node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
+ * \brief Allocates and clears a new AST node.
+ *
+ * \details Every node is assigned the next unique identifier. Identifiers are
+ * dense and start from zero, which allows per-node information to be stored
+ * in flat arrays indexed by them. Each thread numbers its nodes separately.
+ *
+ * \param[in] arena Pointer to the arena to allocate the node from.
+ * \param[in] size The size of the node in bytes.
+ * \param[in] kind The kind of the node.
+ * \returns Pointer to the newly allocated node.
+ */
+tau_ast_node_t* tau_ast_node_init(tau_arena_t* arena, size_t size, tau_ast_kind_t kind);
+
+/**
+ * \brief Returns the number of AST nodes created so far on the current thread.
+ *
+ * \details Every node identifier is less than this number.
+ *
+ * \returns The number of AST nodes.
+ */
+size_t tau_ast_node_count(void);
+
+/**
+ * \brief Restarts node numbering from zero on the current thread.
+ *
+ * \details Must only be called once every node created on the current thread
+ * has been freed.
  */
-void tau_ast_node_free(tau_ast_node_t* node);
+void tau_ast_node_reset_count(void);
 
 /**
  * \brief Performs name resolution pass on an AST node.
@@ -26,16 +26,10 @@ typedef struct tau_ast_path_list_t
 /**
  * \brief Initializes a new AST path list node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_path_list_t* tau_ast_path_list_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST path list node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_path_list_free(tau_ast_path_list_t* node);
+tau_ast_path_list_t* tau_ast_path_list_init(tau_arena_t* arena);
 
 /**
  * \brief Writes a JSON dump of an AST path list node into a stream.
@@ -25,16 +25,10 @@ typedef struct tau_ast_path_wildcard_t
 /**
  * \brief Initializes a new AST path wildcard node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_path_wildcard_t* tau_ast_path_wildcard_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST path wildcard node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_path_wildcard_free(tau_ast_path_wildcard_t* node);
+tau_ast_path_wildcard_t* tau_ast_path_wildcard_init(tau_arena_t* arena);
 
 /**
  * \brief Writes a JSON dump of an AST path wildcard node into a stream.
@@ -29,16 +29,10 @@ typedef struct tau_ast_poison_t
 /**
  * \brief Initializes a new AST poison node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_poison_t* tau_ast_poison_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST poison node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_poison_free(tau_ast_poison_t* node);
+tau_ast_poison_t* tau_ast_poison_init(tau_arena_t* arena);
 
 /**
  * \brief Writes a JSON dump of an AST poison node into a stream.
@@ -20,23 +20,16 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_prog_t
 {
   TAU_AST_NODE_HEADER;
-  tau_symtable_t* scope; // The associated scope of declarations.
   tau_vector_t* decls; // Vector of associated declarations.
 } tau_ast_prog_t;
 
 /**
  * \brief Initializes a new AST program node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_prog_t* tau_ast_prog_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST program node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_prog_free(tau_ast_prog_t* node);
+tau_ast_prog_t* tau_ast_prog_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST program node.
@@ -20,23 +20,16 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_stmt_block_t
 {
   TAU_AST_STMT_HEADER;
-  tau_symtable_t* scope; // The associated scope.
   tau_vector_t* stmts;   // Collection of statements within the block.
 } tau_ast_stmt_block_t;
 
 /**
  * \brief Initializes a new AST block statement node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_stmt_block_t* tau_ast_stmt_block_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST block statement node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_stmt_block_free(tau_ast_stmt_block_t* node);
+tau_ast_stmt_block_t* tau_ast_stmt_block_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST block statement node.
@@ -20,7 +20,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_stmt_for_t
 {
   TAU_AST_STMT_HEADER;
-  tau_symtable_t* scope; // The associated scope of loop variable and loop body.
   tau_ast_node_t* var; // The associated loop variable declaration.
   tau_ast_node_t* range; // The associated range expression.
   tau_ast_node_t* stmt; // The associated body statement.
@@ -29,16 +28,10 @@ typedef struct tau_ast_stmt_for_t
 /**
  * \brief Initializes a new AST for-loop statement node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_stmt_for_t* tau_ast_stmt_for_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST for-loop statement node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_stmt_for_free(tau_ast_stmt_for_t* node);
+tau_ast_stmt_for_t* tau_ast_stmt_for_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST for-loop statement node.
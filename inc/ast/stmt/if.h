@@ -21,7 +21,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_stmt_if_t
 {
   TAU_AST_STMT_HEADER;
-  tau_symtable_t* scope; // The associated scope.
   tau_ast_node_t* cond; // The associated condition expression.
   tau_ast_node_t* stmt; // The associated consequent statement.
   tau_ast_node_t* stmt_else; // The associated optional alternative statement.
@@ -34,16 +33,10 @@ typedef struct tau_ast_stmt_if_t
 /**
  * \brief Initializes a new AST if statement node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_stmt_if_t* tau_ast_stmt_if_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST if statement node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_stmt_if_free(tau_ast_stmt_if_t* node);
+tau_ast_stmt_if_t* tau_ast_stmt_if_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST if statement node.
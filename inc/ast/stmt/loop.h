@@ -20,7 +20,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_stmt_loop_t
 {
   TAU_AST_STMT_HEADER;
-  tau_symtable_t* scope; ///< The associated scope.
   tau_ast_node_t* stmt;  ///< The associated body statement.
 
   LLVMBasicBlockRef llvm_begin; ///< LLVM block for the beginning of the loop.
@@ -30,16 +29,10 @@ typedef struct tau_ast_stmt_loop_t
 /**
  * \brief Initializes a new AST loop statement node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_stmt_loop_t* tau_ast_stmt_loop_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST loop statement node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_stmt_loop_free(tau_ast_stmt_loop_t* node);
+tau_ast_stmt_loop_t* tau_ast_stmt_loop_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST loop statement node.
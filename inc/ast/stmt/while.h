@@ -20,7 +20,6 @@ TAU_EXTERN_C_BEGIN
 typedef struct tau_ast_stmt_while_t
 {
   TAU_AST_STMT_HEADER;
-  tau_symtable_t* scope; // The associated scope.
   tau_ast_node_t* cond; // The associated condition expression.
   tau_ast_node_t* stmt; // The associated body statement.
 
@@ -32,16 +31,10 @@ typedef struct tau_ast_stmt_while_t
 /**
  * \brief Initializes a new AST while statement node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_stmt_while_t* tau_ast_stmt_while_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST while statement node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_stmt_while_free(tau_ast_stmt_while_t* node);
+tau_ast_stmt_while_t* tau_ast_stmt_while_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST while statement node.
@@ -26,16 +26,10 @@ typedef struct tau_ast_type_id_t
 /**
  * \brief Initializes a new AST type identifier node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_id_t* tau_ast_type_id_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST type identifier node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_id_free(tau_ast_type_id_t* node);
+tau_ast_type_id_t* tau_ast_type_id_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST type identifier node.
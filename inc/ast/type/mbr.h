@@ -28,16 +28,10 @@ typedef struct tau_ast_type_mbr_t
 /**
  * \brief Initializes a new AST member type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_mbr_t* tau_ast_type_mbr_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST member type node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_mbr_free(tau_ast_type_mbr_t* node);
+tau_ast_type_mbr_t* tau_ast_type_mbr_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST member type node.
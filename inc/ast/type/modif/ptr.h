@@ -25,16 +25,10 @@ typedef struct tau_ast_type_ptr_t
 /**
  * \brief Initializes a new AST pointer type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_ptr_t* tau_ast_type_ptr_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST pointer type node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_ptr_free(tau_ast_type_ptr_t* node);
+tau_ast_type_ptr_t* tau_ast_type_ptr_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST pointer type node.
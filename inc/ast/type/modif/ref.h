@@ -25,16 +25,10 @@ typedef struct tau_ast_type_ref_t
 /**
  * \brief Initializes a new AST reference type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_ref_t* tau_ast_type_ref_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST reference type node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_ref_free(tau_ast_type_ref_t* node);
+tau_ast_type_ref_t* tau_ast_type_ref_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST reference type node.
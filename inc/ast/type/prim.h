@@ -25,128 +25,138 @@ typedef struct tau_ast_type_prim_t
 /**
  * \brief Initializes a new AST primitive `i8` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_i8_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_i8_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `i16` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_i16_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_i16_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `i32` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_i32_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_i32_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `i64` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_i64_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_i64_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `isize` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_isize_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_isize_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `u8` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_u8_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_u8_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `u16` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_u16_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_u16_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `u32` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_u32_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_u32_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `u64` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_u64_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_u64_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `usize` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_usize_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_usize_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `f32` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_f32_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_f32_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `f64` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_f64_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_f64_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `c64` type node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_c64_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_c64_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `c128` type node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_c128_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_c128_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `char` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_char_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_char_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `bool` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_bool_init(void);
+tau_ast_type_prim_t* tau_ast_type_prim_bool_init(tau_arena_t* arena);
 
 /**
  * \brief Initializes a new AST primitive `unit` type node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_prim_t* tau_ast_type_prim_unit_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST primitive type node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_prim_free(tau_ast_type_prim_t* node);
+tau_ast_type_prim_t* tau_ast_type_prim_unit_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST primitive type node.
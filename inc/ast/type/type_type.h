@@ -25,16 +25,10 @@ typedef struct tau_ast_type_type_t
 /**
  * \brief Initializes a new AST type-type node.
  *
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_type_type_t* tau_ast_type_type_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST type-type node.
- *
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_type_type_free(tau_ast_type_type_t* node);
+tau_ast_type_type_t* tau_ast_type_type_init(tau_arena_t* arena);
 
 /**
  * \brief Performs name resolution pass on an AST type-type node.
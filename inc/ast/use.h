@@ -26,16 +26,10 @@ typedef struct tau_ast_use_t
 /**
  * \brief Initializes a new AST use directive node.
  * 
+ * \param[in] arena Pointer to the arena to allocate the node from.
  * \returns Pointer to the newly initialized AST node.
  */
-tau_ast_use_t* tau_ast_use_init(void);
-
-/**
- * \brief Frees all memory allocated by an AST use directive node.
- * 
- * \param[in] node Pointer to the AST node to be freed.
- */
-void tau_ast_use_free(tau_ast_use_t* node);
+tau_ast_use_t* tau_ast_use_init(tau_arena_t* arena);
 
 /**
  * \brief Writes a JSON dump of an AST use directive node into a stream.
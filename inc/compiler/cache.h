@@ -0,0 +1,131 @@
+/**
+ * \file
+ *
+ * \brief Compilation cache.
+ *
+ * \details The cache stores the output files of compiling an input file in a
+ * directory, keyed by the contents of the input file and a configuration
+ * string describing everything else the outputs depend on (compiler version,
+ * target, options). Compiling an input file whose key is present restores the
+ * outputs from the cache instead of running the compiler stages.
+ *
+ * Each entry is a single file named after the key. Entries and restored
+ * outputs are written to a temporary file first and renamed into place, so
+ * concurrent compilers sharing a cache directory never observe partial files.
+ * Restoring an entry updates its modification time, and trimming the cache
+ * removes the least recently used entries until it fits its size limit.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_CACHE_H
+#define TAU_CACHE_H
+
+#include <stdio.h>
+
+#include "utils/common.h"
+#include "utils/collections/vector.h"
+#include "utils/io/path.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Represents a compilation cache.
+ */
+typedef struct tau_cache_t tau_cache_t;
+
+/**
+ * \brief Represents the number of cache operations.
+ */
+typedef struct tau_cache_stats_t
+{
+  size_t hit_count; ///< Number of entries restored.
+  size_t miss_count; ///< Number of lookups without a usable entry.
+  size_t store_count; ///< Number of entries written.
+  size_t evict_count; ///< Number of entries removed by trimming.
+} tau_cache_stats_t;
+
+/**
+ * \brief Initializes a new cache in a directory.
+ *
+ * \details The directory is created if it does not exist. The statistics
+ * accumulated by previous compilers using the directory are loaded.
+ *
+ * \param[in] dir Path to the cache directory.
+ * \param[in] max_size The size limit of the cache in bytes.
+ * \returns Pointer to the newly initialized cache or `NULL` if the directory
+ * could not be created.
+ */
+tau_cache_t* tau_cache_init(const char* dir, size_t max_size);
+
+/**
+ * \brief Frees all memory allocated by a cache and adds its statistics to the
+ * ones stored in the cache directory.
+ *
+ * \param[in] cache Pointer to the cache to be freed.
+ */
+void tau_cache_free(tau_cache_t* cache);
+
+/**
+ * \brief Restores the outputs of compiling an input file from the cache.
+ *
+ * \details Output `ext` of `path` is written to `path` with its extension
+ * replaced by `ext`. Every output stored in the entry is restored, which may
+ * be fewer than requested, since compiling a file does not necessarily write
+ * every possible output. Nothing is written unless each of them is one of the
+ * requested outputs. This function is thread-safe.
+ *
+ * \param[in,out] cache Pointer to the cache to be used.
+ * \param[in] config The configuration the outputs depend on.
+ * \param[in] src Pointer to the contents of the input file.
+ * \param[in] src_size The size of the input file in bytes.
+ * \param[in] path Pointer to the path of the input file.
+ * \param[in] extensions Vector of the extensions of every possible output.
+ * \returns `true` if the outputs were restored, `false` otherwise.
+ */
+bool tau_cache_restore(tau_cache_t* cache, const char* config, const char* src, size_t src_size, tau_path_t* path, tau_vector_t* extensions);
+
+/**
+ * \brief Stores the outputs of compiling an input file in the cache.
+ *
+ * \details Nothing is stored if any of the outputs cannot be read. This
+ * function is thread-safe.
+ *
+ * \param[in,out] cache Pointer to the cache to be used.
+ * \param[in] config The configuration the outputs depend on.
+ * \param[in] src Pointer to the contents of the input file.
+ * \param[in] src_size The size of the input file in bytes.
+ * \param[in] path Pointer to the path of the input file.
+ * \param[in] extensions Vector of output extensions.
+ */
+void tau_cache_store(tau_cache_t* cache, const char* config, const char* src, size_t src_size, tau_path_t* path, tau_vector_t* extensions);
+
+/**
+ * \brief Removes the least recently used entries until the cache fits its size
+ * limit with some headroom.
+ *
+ * \param[in,out] cache Pointer to the cache to be trimmed.
+ */
+void tau_cache_trim(tau_cache_t* cache);
+
+/**
+ * \brief Retrieves the statistics of a cache since it was initialized.
+ *
+ * \param[in] cache Pointer to the cache to be used.
+ * \returns The statistics of the cache.
+ */
+tau_cache_stats_t tau_cache_get_stats(tau_cache_t* cache);
+
+/**
+ * \brief Writes the statistics of a cache since it was initialized and since
+ * the cache directory was created to a stream.
+ *
+ * \param[in] cache Pointer to the cache to be used.
+ * \param[in] stream The stream to be written to.
+ */
+void tau_cache_print_stats(tau_cache_t* cache, FILE* stream);
+
+TAU_EXTERN_C_END
+
+#endif
@@ -49,8 +49,14 @@ int tau_compiler_main(tau_compiler_t* compiler, int argc, const char* argv[]);
 /**
  * \brief Processes a source file.
  *
+ * \details Diagnostics are written to the log and crumb streams of the calling
+ * thread. Every per-thread singleton used during compilation belongs to the
+ * calling thread, so different threads may process files concurrently.
+ *
  * \param[in,out] compiler Pointer to the compiler context to be used.
  * \param[in] path Pointer to the path of the source file.
+ * \returns Pointer to the environment of the compiled file or `NULL` if the
+ * file failed to compile.
  */
 tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_t* path);
 
@@ -14,19 +14,21 @@
 #include "stages/analysis/symtable.h"
 #include "stages/analysis/types/types.h"
 #include "utils/collections/vector.h"
+#include "utils/memory/arena.h"
 
 /**
  * \brief Represents a compilation environment.
  *
- * \details The environment does not own any of its members. It is purely a
- * convenience type that holds objects needed throughout the compilation
- * process.
+ * \details Apart from the AST arena, the environment does not own any of its
+ * members. It is purely a convenience type that holds objects needed
+ * throughout the compilation process.
  */
 typedef struct tau_environment_t
 {
   tau_vector_t* paths;               ///< Vector of source file paths associated with the environment.
-  tau_vector_t* sources;             ///< Vector of source file contents associated with the environment.
+  tau_vector_t* sources;             ///< Vector of source file views associated with the environment.
   tau_vector_t* tokens;              ///< Vector of tokens associated with the environment.
+  tau_arena_t* ast_arena;            ///< Arena owning the AST nodes of the environment.
 
   tau_symtable_t* symtable;          ///< The symbol table associated with the environment.
   tau_typebuilder_t* typebuilder;    ///< The type builder associated with the environment.
@@ -58,13 +60,4 @@ tau_environment_t* tau_environment_init(tau_symtable_t* symtable, tau_typebuilde
  */
 void tau_environment_free(tau_environment_t* env);
 
-/**
- * \brief Merges a compilation environment into another. The source environment
- * is freed in the process.
- *
- * \param[in,out] dest Pointer to the compilation environment to merge into.
- * \param[in] src Pointer to the compilation environment to be merged.
- */
-void tau_environment_merge(tau_environment_t* dest, tau_environment_t* src);
-
 #endif
@@ -0,0 +1,57 @@
+/**
+ * \file
+ *
+ * \brief Link time optimization.
+ *
+ * \details With link time optimization every input file is optimized by the
+ * pre-link pipeline and emitted as bitcode instead of machine code. The link
+ * step loads the bitcode of every input file and optimizes the modules with
+ * knowledge of each other before generating machine code.
+ *
+ * Full link time optimization merges every module into a single one, which is
+ * optimized and emitted as a single object.
+ *
+ * Thin link time optimization keeps the modules separate. Every module imports
+ * copies of the small functions it calls from other modules as
+ * `available_externally` definitions, which the post-link pipeline may inline
+ * and drops afterwards. The modules are then optimized and emitted in
+ * parallel, one object each. The LLVM C API cannot write module summaries, so
+ * import decisions are made on the loaded modules instead.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_LTO_H
+#define TAU_LTO_H
+
+#include "llvm.h"
+#include "compiler/options.h"
+#include "utils/common.h"
+#include "utils/collections/vector.h"
+#include "utils/concurrency/threadpool.h"
+#include "utils/io/path.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Links the bitcode of the input files with link time optimization.
+ *
+ * \details The bitcode of input file `path` is read from `path` with its
+ * extension replaced by `bc`. In thin mode the object of every input file is
+ * written to `path` with its extension replaced by `obj`, in full mode the
+ * single object is written to `output_path`.
+ *
+ * \param[in] mode The link time optimization mode, other than none.
+ * \param[in] input_files Vector of paths to the input files.
+ * \param[in] passes The post-link pass pipeline in LLVM's textual format.
+ * \param[in] output_path Pointer to the path of the object in full mode.
+ * \param[in,out] pool Pointer to the thread pool to be used or `NULL` to link
+ * on the calling thread.
+ * \returns `true` if linking was successful, `false` otherwise.
+ */
+bool tau_lto_link(tau_lto_mode_t mode, tau_vector_t* input_files, const char* passes, tau_path_t* output_path, tau_threadpool_t* pool);
+
+TAU_EXTERN_C_END
+
+#endif
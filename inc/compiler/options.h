@@ -16,6 +16,29 @@
 
 TAU_EXTERN_C_BEGIN
 
+/**
+ * \brief Enumeration of optimization levels.
+ */
+typedef enum tau_opt_level_t
+{
+  TAU_OPT_LEVEL_O0, ///< No optimizations.
+  TAU_OPT_LEVEL_O1, ///< Basic optimizations.
+  TAU_OPT_LEVEL_O2, ///< Most optimizations.
+  TAU_OPT_LEVEL_O3, ///< All optimizations.
+  TAU_OPT_LEVEL_OS, ///< Optimizations for code size.
+  TAU_OPT_LEVEL_OZ, ///< Aggressive optimizations for code size.
+} tau_opt_level_t;
+
+/**
+ * \brief Enumeration of link time optimization modes.
+ */
+typedef enum tau_lto_mode_t
+{
+  TAU_LTO_MODE_NONE, ///< Every input file is compiled to machine code on its own.
+  TAU_LTO_MODE_THIN, ///< Input files import small functions from each other.
+  TAU_LTO_MODE_FULL, ///< Input files are merged into a single module.
+} tau_lto_mode_t;
+
 /**
  * \brief Represents a compiler option context.
  */
@@ -92,6 +115,100 @@ tau_vector_t* tau_options_get_search_directories(tau_options_ctx_t* ctx);
  */
 tau_vector_t* tau_options_get_input_files(tau_options_ctx_t* ctx);
 
+/**
+ * \brief Retrieves the maximum number of input files compiled in parallel.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The maximum number of parallel jobs, at least `1` and at most four
+ * times the number of hardware threads.
+ */
+size_t tau_options_get_job_count(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the number of objects the code of a module is split into.
+ *
+ * \details Modules with fewer function definitions are split into one object
+ * per definition.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The number of partitions per module, at least `1` and at most
+ * `256`.
+ */
+size_t tau_options_get_split_count(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the directory of the compilation cache.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns Path to the cache directory or `NULL` if caching is disabled.
+ */
+const char* tau_options_get_cache_dir(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the size limit of the compilation cache.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The size limit of the cache in bytes.
+ */
+size_t tau_options_get_cache_size(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves whether to print cache statistics.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns `true` if cache statistics should be printed, `false` otherwise.
+ */
+bool tau_options_get_cache_stats(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the optimization level.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The optimization level.
+ */
+tau_opt_level_t tau_options_get_opt_level(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the link time optimization mode.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The link time optimization mode.
+ */
+tau_lto_mode_t tau_options_get_lto_mode(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves the LLVM pass pipeline overriding the one implied by the
+ * optimization level.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns The pass pipeline in LLVM's textual format or `NULL` if not set.
+ */
+const char* tau_options_get_passes(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves whether to verify the module after every pass.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns `true` if every pass should be verified, `false` otherwise.
+ */
+bool tau_options_get_verify_each(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves whether to write a time trace of the compilation.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns `true` if a time trace should be written, `false` otherwise.
+ */
+bool tau_options_get_time_trace(tau_options_ctx_t* ctx);
+
+/**
+ * \brief Retrieves whether to print a memory report for each input file.
+ *
+ * \param[in] ctx Pointer to the compiler option context to be used.
+ * \returns `true` if a memory report should be printed, `false` otherwise.
+ */
+bool tau_options_get_mem_report(tau_options_ctx_t* ctx);
+
 /**
  * \brief Retrieves wether to use verbose output or not.
  *
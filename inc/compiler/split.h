@@ -0,0 +1,94 @@
+/**
+ * \file
+ *
+ * \brief Split module code generation.
+ *
+ * \details A module is split into a fixed number of partitions of contiguous
+ * function definitions with roughly equal instruction counts. Each partition
+ * is loaded into its own LLVM context from the bitcode of the whole module,
+ * every definition outside of the partition is turned into a declaration and
+ * the result is emitted as a separate object file. Partitions are independent
+ * of each other, so they can be code generated in parallel.
+ *
+ * Functions and mutable global variables with local linkage are given hidden
+ * external linkage and a name unique to the source file beforehand, so that
+ * partitions can refer to each other's symbols. Constants with local linkage
+ * are duplicated in every partition using them.
+ *
+ * Partitioning only depends on the module and the number of partitions, so
+ * the emitted objects are identical regardless of how many threads are used.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_SPLIT_H
+#define TAU_SPLIT_H
+
+#include "llvm.h"
+#include "utils/common.h"
+#include "utils/concurrency/threadpool.h"
+#include "utils/io/path.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Gives functions and mutable global variables with local linkage
+ * hidden external linkage and a name unique to a source file.
+ *
+ * \details Promoted names only depend on the module and the path, so modules
+ * loaded from the same bitcode agree on them.
+ *
+ * \param[in,out] llvm_module The module to be modified.
+ * \param[in] path Pointer to the path of the source file.
+ */
+void tau_split_promote_locals(LLVMModuleRef llvm_module, tau_path_t* path);
+
+/**
+ * \brief Replaces a function definition with a declaration of the same name.
+ *
+ * \details The function is deleted and every use of it refers to the new
+ * declaration, which is appended to the function list of the module.
+ *
+ * \param[in,out] llvm_module The module containing the function.
+ * \param[in] llvm_function The function to be replaced.
+ */
+void tau_split_make_declaration(LLVMModuleRef llvm_module, LLVMValueRef llvm_function);
+
+/**
+ * \brief Retrieves the number of partitions a module is emitted as.
+ *
+ * \details Every partition receives at least one function definition, so
+ * modules with fewer definitions than requested partitions are emitted as one
+ * partition per definition. Modules with aliases are emitted as a single
+ * partition.
+ *
+ * \param[in] llvm_module The module to be emitted.
+ * \param[in] partition_count The requested number of partitions, at least `1`.
+ * \returns The number of partitions, at least `1`.
+ */
+size_t tau_split_partition_count(LLVMModuleRef llvm_module, size_t partition_count);
+
+/**
+ * \brief Emits a module as a number of separately code generated partitions.
+ *
+ * \details Partition `i` of `path` is written to `path` with its extension
+ * replaced by `i.obj`, and `i.asm` if assembly is requested. The module is
+ * modified in place to make symbols with local linkage visible across
+ * partitions.
+ *
+ * \param[in,out] llvm_module The module to be emitted.
+ * \param[in] path Pointer to the path of the source file.
+ * \param[in] partition_count The requested number of partitions, at least
+ * `1`.
+ * \param[in] emit_asm Whether to emit assembly files as well.
+ * \param[in,out] pool Pointer to the thread pool to be used or `NULL` to emit
+ * the partitions on the calling thread.
+ * \returns The number of emitted partitions, see
+ * `tau_split_partition_count`.
+ */
+size_t tau_split_emit(LLVMModuleRef llvm_module, tau_path_t* path, size_t partition_count, bool emit_asm, tau_threadpool_t* pool);
+
+TAU_EXTERN_C_END
+
+#endif
@@ -44,10 +44,11 @@ TAU_EXTERN_C_BEGIN
 /**
  * \brief Initializes LLVM and all of its components.
  * 
+ * \param[in] codegen_level The optimization level of the target machines.
  * \returns `true` if LLVM and all of its components were initialized successfully,
  * otherwise `false`.
  */
-bool tau_llvm_init(void);
+bool tau_llvm_init(LLVMCodeGenOptLevel codegen_level);
 
 /**
  * \brief Frees all resources associated with LLVM.
@@ -55,9 +56,17 @@ bool tau_llvm_init(void);
 void tau_llvm_free(void);
 
 /**
- * \brief Gets the current LLVM context.
+ * \brief Frees the LLVM context, target machine and target data layout of the
+ * current thread.
+ *
+ * \details They are created again on the next request.
+ */
+void tau_llvm_thread_free(void);
+
+/**
+ * \brief Gets the LLVM context of the current thread.
  * 
- * \returns The current LLVM context.
+ * \returns The LLVM context of the current thread.
  */
 LLVMContextRef tau_llvm_get_context(void);
 
@@ -69,19 +78,28 @@ LLVMContextRef tau_llvm_get_context(void);
 LLVMTargetRef tau_llvm_get_target(void);
 
 /**
- * \brief Gets the current LLVM target data layout.
+ * \brief Gets the LLVM target data layout of the current thread.
  * 
- * \returns The current LLVM target data layout.
+ * \returns The LLVM target data layout of the current thread.
  */
 LLVMTargetDataRef tau_llvm_get_data(void);
 
 /**
- * \brief Gets the current LLVM target machine.
+ * \brief Gets the LLVM target machine of the current thread.
  * 
- * \returns The current LLVM target machine.
+ * \returns The LLVM target machine of the current thread.
  */
 LLVMTargetMachineRef tau_llvm_get_machine(void);
 
+/**
+ * \brief Creates a new target machine configured like the per-thread ones.
+ *
+ * \details The caller owns the target machine and has to dispose of it.
+ *
+ * \returns The new target machine or `NULL` if it could not be created.
+ */
+LLVMTargetMachineRef tau_llvm_create_machine(void);
+
 /**
  * \brief Gets the current LLVM target triple.
  * 
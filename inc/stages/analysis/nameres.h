@@ -20,9 +20,9 @@
 
 #include <utils/error.h>
 
+#include "stages/analysis/scopestack.h"
 #include "stages/analysis/symtable.h"
 #include "utils/common.h"
-#include "utils/collections/stack.h"
 
 TAU_EXTERN_C_BEGIN
 
@@ -31,8 +31,8 @@ TAU_EXTERN_C_BEGIN
  */
 typedef struct tau_nameres_ctx_t
 {
-  tau_symtable_t* global_scope; ///< The symbol table of the global scope.
-  tau_stack_t* scopes; ///< Current scope stack.
+  tau_symtable_t* global_scope; ///< The symbol table owning the member scopes.
+  tau_scopestack_t* scopes; ///< Current scope stack.
   tau_error_bag_t* errors; ///< Associated error bag to add errors to.
 } tau_nameres_ctx_t;
 
@@ -53,27 +53,48 @@ tau_nameres_ctx_t* tau_nameres_ctx_init(tau_symtable_t* symtable, tau_error_bag_
 void tau_nameres_ctx_free(tau_nameres_ctx_t* ctx);
 
 /**
- * \brief Begins a new scope and returns it.
- * 
+ * \brief Begins a new scope.
+ *
+ * \param[in] ctx Pointer to the name resolution context.
+ */
+void tau_nameres_ctx_scope_begin(tau_nameres_ctx_t* ctx);
+
+/**
+ * \brief Begins a new scope whose declarations remain accessible as members
+ * after name resolution.
+ *
  * \param[in] ctx Pointer to the name resolution context.
- * \returns Pointer to the new scope.
+ * \returns Pointer to the symbol table receiving the declarations of the scope.
  */
-tau_symtable_t* tau_nameres_ctx_scope_begin(tau_nameres_ctx_t* ctx);
+tau_symtable_t* tau_nameres_ctx_member_scope_begin(tau_nameres_ctx_t* ctx);
 
 /**
  * \brief Ends the current scope.
- * 
+ *
  * \param[in] ctx Pointer to the name resolution context.
  */
 void tau_nameres_ctx_scope_end(tau_nameres_ctx_t* ctx);
 
 /**
- * \brief Returns the current scope.
- * 
+ * \brief Declares a name in the current scope.
+ *
+ * \param[in] ctx Pointer to the name resolution context.
+ * \param[in] id The interned identifier of the name.
+ * \param[in] node Pointer to the declaring AST node.
+ * \returns `NULL` if the name was declared, otherwise a pointer to the node
+ * already declaring the name in the current scope.
+ */
+tau_ast_node_t* tau_nameres_ctx_declare(tau_nameres_ctx_t* ctx, uint32_t id, tau_ast_node_t* node);
+
+/**
+ * \brief Looks up the innermost visible declaration of a name.
+ *
  * \param[in] ctx Pointer to the name resolution context.
- * \returns Pointer to the current scope.
+ * \param[in] id The interned identifier of the name.
+ * \returns Pointer to the declaring AST node or `NULL` if the name is not
+ * visible.
  */
-tau_symtable_t* tau_nameres_ctx_scope_cur(tau_nameres_ctx_t* ctx);
+tau_ast_node_t* tau_nameres_ctx_lookup(tau_nameres_ctx_t* ctx, uint32_t id);
 
 TAU_EXTERN_C_END
 
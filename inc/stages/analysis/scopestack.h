@@ -0,0 +1,97 @@
+/**
+ * \file
+ *
+ * \brief Scope stack interface.
+ *
+ * \details The scope stack tracks the names visible during name resolution.
+ * Instead of one hash table per scope it keeps a single open addressing map
+ * from interned identifiers to a stack of bindings, together with an undo log
+ * of the bindings declared in each open scope. Declaring a name pushes a
+ * binding onto its stack, looking up a name reads the top of its stack and
+ * leaving a scope pops the bindings recorded in the undo log. Beginning and
+ * ending a scope therefore allocates nothing and a lookup costs a single probe
+ * regardless of the nesting depth.
+ *
+ * Scopes whose members must remain accessible after name resolution, such as
+ * those of structs or modules, can be associated with a symbol table which
+ * receives a copy of every binding declared in the scope.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_SCOPESTACK_H
+#define TAU_SCOPESTACK_H
+
+#include "stages/analysis/symtable.h"
+#include "utils/common.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Represents a scope stack.
+ */
+typedef struct tau_scopestack_t tau_scopestack_t;
+
+/**
+ * \brief Initializes a new scope stack with no open scopes.
+ *
+ * \returns Pointer to the newly initialized scope stack.
+ */
+tau_scopestack_t* tau_scopestack_init(void);
+
+/**
+ * \brief Frees all memory associated with a scope stack.
+ *
+ * \param[in] stack Pointer to the scope stack to be freed.
+ */
+void tau_scopestack_free(tau_scopestack_t* stack);
+
+/**
+ * \brief Opens a new innermost scope.
+ *
+ * \param[in,out] stack Pointer to the scope stack.
+ * \param[in] members Pointer to the symbol table receiving the bindings
+ * declared in the scope, or `NULL`.
+ */
+void tau_scopestack_begin(tau_scopestack_t* stack, tau_symtable_t* members);
+
+/**
+ * \brief Closes the innermost scope and removes its bindings.
+ *
+ * \param[in,out] stack Pointer to the scope stack.
+ */
+void tau_scopestack_end(tau_scopestack_t* stack);
+
+/**
+ * \brief Declares a name in the innermost scope.
+ *
+ * \param[in,out] stack Pointer to the scope stack.
+ * \param[in] id The interned identifier of the name.
+ * \param[in] node Pointer to the declaring AST node.
+ * \returns `NULL` if the name was declared, otherwise a pointer to the node
+ * already declaring the name in the innermost scope.
+ */
+tau_ast_node_t* tau_scopestack_insert(tau_scopestack_t* stack, uint32_t id, tau_ast_node_t* node);
+
+/**
+ * \brief Looks up the innermost declaration of a name.
+ *
+ * \param[in] stack Pointer to the scope stack.
+ * \param[in] id The interned identifier of the name.
+ * \returns Pointer to the declaring AST node or `NULL` if the name is not
+ * visible.
+ */
+tau_ast_node_t* tau_scopestack_lookup(tau_scopestack_t* stack, uint32_t id);
+
+/**
+ * \brief Returns the number of open scopes.
+ *
+ * \param[in] stack Pointer to the scope stack.
+ * \returns The number of open scopes.
+ */
+size_t tau_scopestack_depth(tau_scopestack_t* stack);
+
+TAU_EXTERN_C_END
+
+#endif
@@ -21,7 +21,6 @@
 
 #include "utils/common.h"
 #include "utils/collections/vector.h"
-#include "utils/str_view.h"
 
 TAU_EXTERN_C_BEGIN
 
@@ -51,8 +50,7 @@ typedef struct tau_symtable_t tau_symtable_t;
 struct tau_symbol_t
 {
   tau_symtable_t* parent; ///< The symbol's parent symbol table.
-  const char* id;     ///< The symbol's identifier.
-  size_t len;         ///< The length of the identifier.
+  uint32_t id;        ///< The symbol's interned identifier.
   tau_ast_node_t* node;   ///< The AST node associated with the symbol.
   tau_symbol_t* next;     ///< The next symbol in the same bucket (for handling collisions).
 };
@@ -70,22 +68,11 @@ struct tau_symtable_t
  * \brief Initializes a new symbol with the given identifier and associated AST
  * node.
  *
- * \param[in] id Pointer to the beginning of the identifier.
- * \param[in] len The length of the identifier.
+ * \param[in] id The interned identifier of the symbol.
  * \param[in] node Pointer to the AST node associated with the symbol.
  * \returns A pointer to the newly initialized symbol.
  */
-tau_symbol_t* tau_symbol_init(const char* id, size_t len, tau_ast_node_t* node);
-
-/**
- * \brief Initializes a new symbol with the given identifier and associated AST
- * node.
- *
- * \param[in] id String view of the identifier.
- * \param[in] node Pointer to the AST node associated with the symbol.
- * \returns A pointer to the newly initialized symbol.
- */
-tau_symbol_t* tau_symbol_init_with_str_view(tau_string_view_t id, tau_ast_node_t* node);
+tau_symbol_t* tau_symbol_init(uint32_t id, tau_ast_node_t* node);
 
 /**
  * \brief Frees the resources associated with a symbol.
@@ -124,40 +111,19 @@ tau_symbol_t* tau_symtable_insert(tau_symtable_t* table, tau_symbol_t* new_sym);
  * table hierarchy.
  *
  * \param[in] table Pointer to the symbol table.
- * \param[in] id Pointer to the beginning of the identifier.
- * \param[in] len The length of the identifier.
- * \returns A pointer to the symbol or NULL if it was not found.
- */
-tau_symbol_t* tau_symtable_get(tau_symtable_t* table, const char* id, size_t len);
-
-/**
- * \brief Retrieves a symbol from a symbol table without traversing the symbol
- * table hierarchy.
- *
- * \param[in] table Pointer to the symbol table.
- * \param[in] id String view of the identifier.
- * \returns A pointer to the symbol or NULL if it was not found.
- */
-tau_symbol_t* tau_symtable_get_with_str_view(tau_symtable_t* table, tau_string_view_t id);
-
-/**
- * \brief Retrieves a symbol from a symbol table hierarchy.
- *
- * \param[in] table Pointer to the symbol table.
- * \param[in] id Pointer to the beginning of the identifier.
- * \param[in] len The length of the identifier.
+ * \param[in] id The interned identifier of the symbol.
  * \returns A pointer to the symbol or NULL if it was not found.
  */
-tau_symbol_t* tau_symtable_lookup(tau_symtable_t* table, const char* id, size_t len);
+tau_symbol_t* tau_symtable_get(tau_symtable_t* table, uint32_t id);
 
 /**
  * \brief Retrieves a symbol from a symbol table hierarchy.
  *
  * \param[in] table Pointer to the symbol table.
- * \param[in] id String view of the identifier.
+ * \param[in] id The interned identifier of the symbol.
  * \returns A pointer to the symbol or NULL if it was not found.
  */
-tau_symbol_t* tau_symtable_lookup_with_str_view(tau_symtable_t* table, tau_string_view_t id);
+tau_symbol_t* tau_symtable_lookup(tau_symtable_t* table, uint32_t id);
 
 /**
  * \brief Merges a symbol table into another. The source symbol table is
@@ -35,6 +35,9 @@ typedef struct tau_ast_node_t tau_ast_node_t;
  * nodes with their corresponding type descriptors. It plays a critical role in
  * type checking and resolution during compilation. It owns neither the AST nodes
  * nor the associated type descriptors.
+ *
+ * The type descriptors are stored in a flat array indexed by the unique
+ * identifiers of the AST nodes.
  */
 typedef struct tau_typetable_t tau_typetable_t;
 
@@ -80,6 +83,9 @@ tau_typedesc_t* tau_typetable_lookup(tau_typetable_t* table, tau_ast_node_t* nod
  * \brief Merges a type table into another. The source type table is freed
  * in the process.
  *
+ * \details Both type tables must hold the types of nodes created by the same
+ * compilation job, and no node may have a type in both.
+ *
  * \param[in,out] dest Pointer to the type table to merge into.
  * \param[in] src Pointer to the type table to be merged.
  */
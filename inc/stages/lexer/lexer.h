@@ -194,6 +194,14 @@ void tau_lexer_skip_n(tau_lexer_t* lex, size_t n);
  */
 size_t tau_lexer_skip_integer_suffix(tau_lexer_t* lex);
 
+/**
+ * \brief Skips whitespace characters, recording whether a line feed was
+ * skipped so that the next token can be flagged with `TAU_TOKEN_FLAG_NEWLINE`.
+ *
+ * \param[in] lex Pointer to the lexer.
+ */
+void tau_lexer_skip_whitespace(tau_lexer_t* lex);
+
 /**
  * \brief Skips a line comment.
  *
@@ -0,0 +1,66 @@
+/**
+ * \file
+ *
+ * \brief Line index interface.
+ *
+ * \details A line index records the position of the first character of every
+ * line in a source file. It is built once per source file and allows the row
+ * and column of any position to be resolved with a binary search instead of
+ * rescanning the source from its beginning.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_LINE_INDEX_H
+#define TAU_LINE_INDEX_H
+
+#include <stddef.h>
+
+#include "utils/extern_c.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Represents a line index.
+ */
+typedef struct tau_line_index_t tau_line_index_t;
+
+/**
+ * \brief Initializes a new line index for a source string.
+ *
+ * \param[in] src The null-terminated source string to be indexed.
+ * \returns Pointer to the newly initialized line index.
+ */
+tau_line_index_t* tau_line_index_init(const char* src);
+
+/**
+ * \brief Frees all memory associated with a line index.
+ *
+ * \param[in] idx Pointer to the line index to be freed.
+ */
+void tau_line_index_free(tau_line_index_t* idx);
+
+/**
+ * \brief Retrieves the number of lines in a line index.
+ *
+ * \param[in] idx Pointer to the line index.
+ * \returns The number of lines.
+ */
+size_t tau_line_index_count(tau_line_index_t* idx);
+
+/**
+ * \brief Resolves a position in the source string to a row and column.
+ *
+ * \details Both the row and the column are zero-based.
+ *
+ * \param[in] idx Pointer to the line index.
+ * \param[in] pos The position to be resolved.
+ * \param[out] row Pointer to a variable where the row is to be written.
+ * \param[out] col Pointer to a variable where the column is to be written.
+ */
+void tau_line_index_resolve(tau_line_index_t* idx, size_t pos, size_t* row, size_t* col);
+
+TAU_EXTERN_C_END
+
+#endif
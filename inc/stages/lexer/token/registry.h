@@ -3,9 +3,10 @@
  *
  * \brief Token registry.
  *
- * \details The token registry is a singleton for managing and tracking tokens
- * in a centralized manner. This registry provides a convenient way to register
- * tokens and free them all at once.
+ * \details The token registry is a per-thread singleton for managing and
+ * tracking tokens in a centralized manner. This registry provides a convenient
+ * way to register tokens and free them all at once. Tokens can only be looked
+ * up on the thread which registered them.
  *
  * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
@@ -14,6 +15,7 @@
 #ifndef TAU_TOKEN_REGISTRY_H
 #define TAU_TOKEN_REGISTRY_H
 
+#include "stages/lexer/line_index.h"
 #include "stages/lexer/token/token.h"
 #include "utils/common.h"
 
@@ -22,29 +24,36 @@ TAU_EXTERN_C_BEGIN
 /**
  * \brief Adds a file to associate tokens with in the registry.
  *
+ * \details If the file is already registered its existing identifier is
+ * returned.
+ *
  * \param[in] path Path to the source file.
  * \param[in] src The contents of the source file.
+ * \returns Identifier of the file in the registry.
  */
-void tau_token_registry_register_file(const char* path, const char* src);
+uint32_t tau_token_registry_register_file(const char* path, const char* src);
 
 /**
  * \brief Adds a new token to the registry.
  *
- * \param[in] path Path to the associated source file.
+ * \param[in] file Identifier of the associated source file.
  * \param[in] kind The kind of the token.
  * \param[in] pos The position of the token in the source file.
  * \returns Pointer to the newly registered token.
  */
-tau_token_t* tau_token_registry_token_init(const char* path, tau_token_kind_t kind, size_t pos);
+tau_token_t* tau_token_registry_token_init(uint32_t file, tau_token_kind_t kind, size_t pos);
 
 /**
- * \brief Retrieves the path and contents of the source file associated with a token.
+ * \brief Retrieves the path, contents and line index of the source file
+ * associated with a token.
  *
  * \param[in] tok Pointer to the token.
  * \param[out] path Pointer to a variable where the path is to be written.
  * \param[out] src Pointer to a variable where the contents are to be written.
+ * \param[out] lines Pointer to a variable where the line index is to be
+ * written.
  */
-void tau_token_registry_path_and_src(tau_token_t* tok, const char** path, const char** src);
+void tau_token_registry_file_info(tau_token_t* tok, const char** path, const char** src, tau_line_index_t** lines);
 
 /**
  * \brief Frees all registered tokens.
@@ -20,6 +20,7 @@
 
 #include "stages/lexer/location.h"
 #include "utils/common.h"
+#include "utils/interner.h"
 #include "utils/str.h"
 #include "utils/str_view.h"
 #include "utils/collections/vector.h"
@@ -142,26 +143,37 @@ typedef enum tau_token_kind_e
   TAU_TOK_PUNCT_BRACE_RIGHT, ///< Punctuation `}`
   TAU_TOK_PUNCT_HASH, ///< Punctuation `#`
 
-  TAU_TOK_NEWLINE, ///< Newline
+  TAU_TOK_NEWLINE, ///< Newline (only produced by the parser, see `TAU_TOKEN_FLAG_NEWLINE`)
 
   TAU_TOK_EOF, ///< End of file
 } tau_token_kind_t;
 
+/**
+ * \brief Enumeration of token flags.
+ */
+typedef enum tau_token_flag_t
+{
+  TAU_TOKEN_FLAG_NEWLINE = 1 << 0, ///< Token is preceded by at least one newline.
+} tau_token_flag_t;
+
 /**
  * \brief Represents a token.
  */
 typedef struct tau_token_t
 {
   tau_token_kind_t kind; // Token kind.
-  size_t pos; // Position of the token's first character in the source code.
+  uint32_t file; // Identifier of the source file in the token registry.
+  uint32_t pos; // Position of the token's first character in the source code.
+  uint32_t len; // Number of characters in the token.
+  uint32_t flags; // Bitwise combination of `tau_token_flag_t` values.
+  uint32_t id; // Interned identifier of an identifier token, `TAU_INTERNER_NULL_ID` otherwise.
 } tau_token_t;
 
 /**
  * \brief Queries a token's location in a source file.
  *
- * \details The location of a token is calculated lazily in order to
- * reduce memory usage during runtime. This function assumes that the
- * source code for the token is syntactically correct.
+ * \details The row and column of a token are calculated lazily in order to
+ * reduce memory usage during runtime. The length is recorded by the lexer.
  *
  * \param[in] tok Pointer to the token whose location is to be retrieved.
  * \returns The token's location.
@@ -176,9 +188,27 @@ tau_location_t tau_token_location(tau_token_t* tok);
  */
 void tau_token_json_dump(FILE* stream, tau_token_t* tok);
 
+/**
+ * \brief Creates a newline token for the first line feed preceding a token.
+ *
+ * \details The lexer does not produce newline tokens, it marks the following
+ * token with `TAU_TOKEN_FLAG_NEWLINE` instead. This function recovers the
+ * position of the first of those newlines for places where a newline token is
+ * still needed.
+ *
+ * \param[in] prev Pointer to the token preceding `tok`, or `NULL` if `tok` is
+ * the first token of its source file.
+ * \param[in] tok Pointer to the token with `TAU_TOKEN_FLAG_NEWLINE` set.
+ * \returns The newline token.
+ */
+tau_token_t tau_token_newline_before(tau_token_t* prev, tau_token_t* tok);
+
 /**
  * \brief Dumps the JSON representation of a vector of tokens to the specified
  * stream.
+ *
+ * \details Newlines recorded with `TAU_TOKEN_FLAG_NEWLINE` are dumped as
+ * separate newline tokens, one for every line feed.
  * 
  * \param[in] stream The stream to write the JSON output to.
  * \param[in] vec The vector of tokens to be dumped.
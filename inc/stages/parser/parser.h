@@ -48,8 +48,11 @@ typedef struct tau_parser_decl_context_t
 typedef struct tau_parser_t
 {
   tau_vector_t* tokens; ///< Vector of tokens to be processed.
+  tau_arena_t* arena; ///< Arena to allocate nodes from.
   size_t cur; ///< Current token index.
   bool ignore_newlines; ///< Ignore newlines while parsing.
+  bool newline_skipped; ///< Whether the newline preceding the current token was already skipped.
+  tau_token_t newline; ///< Newline token returned when newlines are not ignored.
   tau_stack_t* parents; ///< Stack of parent declarations.
   tau_parser_decl_context_t decl_ctx; ///< Context for the declaration being parsed.
   tau_error_bag_t* errors; ///< Associated error bag.
@@ -665,10 +668,11 @@ tau_ast_node_t* tau_parser_parse_use_directive(tau_parser_t* par);
  * 
  * \param[in] par Parser to be used.
  * \param[in] tokens Vector of tokens to be parsed.
+ * \param[in] arena Pointer to the arena to allocate the nodes from.
  * \param[in] errors Pointer to the error bag to add errors to.
  * \returns Pointer to the root node.
  */
-tau_ast_node_t* tau_parser_parse(tau_parser_t* par, tau_vector_t* tokens, tau_error_bag_t* errors);
+tau_ast_node_t* tau_parser_parse(tau_parser_t* par, tau_vector_t* tokens, tau_arena_t* arena, tau_error_bag_t* errors);
 
 TAU_EXTERN_C_END
 
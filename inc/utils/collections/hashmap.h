@@ -0,0 +1,137 @@
+/**
+ * \file
+ *
+ * \brief Hash map data structure interface.
+ *
+ * \details A hash map associates values with keys and finds the value of a key
+ * in constant expected time. The map stores values in a single array of slots
+ * using open addressing with linear probing, together with the hash of their
+ * key. Keys are not stored, the caller provides the hash of a key and a
+ * function matching a stored value against it. This way a value can serve as
+ * its own key, and keys whose hash is computed once, such as interned strings,
+ * are never hashed again.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_HASHMAP_H
+#define TAU_HASHMAP_H
+
+#include "utils/common.h"
+
+TAU_EXTERN_C_BEGIN
+
+/// Represents a hash map data structure.
+typedef struct tau_hashmap_t tau_hashmap_t;
+
+/**
+ * \brief Represents a slot of a hash map.
+ */
+typedef struct tau_hashmap_entry_t
+{
+  uint64_t hash; ///< The hash of the key of the value.
+  void* value; ///< Pointer to the value or `NULL` if the slot is empty.
+} tau_hashmap_entry_t;
+
+/// Function type used to check whether a value belongs to a key.
+typedef bool(*tau_hashmap_match_func_t)(const void* value, const void* key);
+
+/// Utility function pointer type for `tau_hashmap_for_each` function.
+typedef void(*tau_hashmap_for_each_func_t)(void*);
+
+/**
+ * \brief Initializes a new hash map.
+ *
+ * \returns A pointer to the newly initialized hash map.
+ */
+tau_hashmap_t* tau_hashmap_init(void);
+
+/**
+ * \brief Initializes a new hash map which can hold a number of values before
+ * growing.
+ *
+ * \param[in] capacity The number of values the hash map should hold.
+ * \returns A pointer to the newly initialized hash map.
+ */
+tau_hashmap_t* tau_hashmap_init_with_capacity(size_t capacity);
+
+/**
+ * \brief Frees the resources associated with a hash map. The values are not
+ * freed.
+ *
+ * \param[in] map Pointer to the hash map to be freed.
+ */
+void tau_hashmap_free(tau_hashmap_t* map);
+
+/**
+ * \brief Finds the slot of a key in a hash map.
+ *
+ * \details If the key is not in the hash map, the returned slot is the empty
+ * slot where it belongs, with its hash filled in. A value can be stored in it
+ * with `tau_hashmap_insert` as long as the hash map is not modified in the
+ * meantime.
+ *
+ * \param[in,out] map Pointer to the hash map.
+ * \param[in] hash The hash of the key.
+ * \param[in] match Function checking whether a value belongs to the key.
+ * \param[in] key Pointer to the key to be passed to `match`.
+ * \returns Pointer to the slot of the key or to the empty slot where it
+ * belongs.
+ */
+tau_hashmap_entry_t* tau_hashmap_find(tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key);
+
+/**
+ * \brief Stores a value in the empty slot returned by `tau_hashmap_find`.
+ *
+ * \details Every slot returned earlier is invalidated.
+ *
+ * \param[in,out] map Pointer to the hash map.
+ * \param[in,out] entry Pointer to the empty slot.
+ * \param[in] value Pointer to the value, which must not be `NULL`.
+ */
+void tau_hashmap_insert(tau_hashmap_t* restrict map, tau_hashmap_entry_t* restrict entry, void* restrict value);
+
+/**
+ * \brief Retrieves the value of a key from a hash map.
+ *
+ * \param[in] map Pointer to the hash map.
+ * \param[in] hash The hash of the key.
+ * \param[in] match Function checking whether a value belongs to the key.
+ * \param[in] key Pointer to the key to be passed to `match`.
+ * \returns The value of the key if present, `NULL` otherwise.
+ */
+void* tau_hashmap_get(const tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key);
+
+/**
+ * \brief Removes the value of a key from a hash map.
+ *
+ * \details Every slot returned earlier is invalidated.
+ *
+ * \param[in,out] map Pointer to the hash map.
+ * \param[in] hash The hash of the key.
+ * \param[in] match Function checking whether a value belongs to the key.
+ * \param[in] key Pointer to the key to be passed to `match`.
+ * \returns The removed value if the key was present, `NULL` otherwise.
+ */
+void* tau_hashmap_remove(tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key);
+
+/**
+ * \brief Retrieves the number of values in a hash map.
+ *
+ * \param[in] map Pointer to the hash map.
+ * \returns The number of values in the hash map.
+ */
+size_t tau_hashmap_size(const tau_hashmap_t* map);
+
+/**
+ * \brief Calls a function on every value in a hash map in no particular order.
+ *
+ * \param[in] map Pointer to the hash map.
+ * \param[in] func Pointer to the function to be called on the values.
+ */
+void tau_hashmap_for_each(const tau_hashmap_t* map, tau_hashmap_for_each_func_t func);
+
+TAU_EXTERN_C_END
+
+#endif
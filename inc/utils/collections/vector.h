@@ -17,6 +17,7 @@
 #define TAU_VECTOR_H
 
 #include "utils/common.h"
+#include "utils/memory/arena.h"
 
 TAU_EXTERN_C_BEGIN
 
@@ -54,6 +55,17 @@ tau_vector_t* tau_vector_init(void);
  */
 tau_vector_t* tau_vector_init_with_capacity(size_t capacity);
 
+/**
+ * \brief Initializes a new vector whose memory is allocated from an arena.
+ *
+ * \details The vector and its elements are released together with the arena,
+ * freeing the vector is a no-op.
+ *
+ * \param[in] arena Pointer to the arena to allocate from.
+ * \returns A pointer to the newly initialized vector.
+ */
+tau_vector_t* tau_vector_init_with_arena(tau_arena_t* arena);
+
 /**
  * \brief Initializes a new vector from a memory buffer.
  *
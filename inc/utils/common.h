@@ -30,9 +30,11 @@
 #include "utils/offsetof.h"
 #include "utils/os_detect.h"
 #include "utils/swap.h"
+#include "utils/thread_local.h"
 #include "utils/unreachable.h"
 #include "utils/unused.h"
 #include "utils/io/log.h"
 #include "utils/memory/memtrace.h"
+#include "utils/memory/memstat.h"
 
 #endif
@@ -96,6 +96,13 @@ void tau_thread_detach(tau_thread_t* thread);
  */
 bool tau_thread_equal(tau_thread_t* thread1, tau_thread_t* thread2);
 
+/**
+ * \brief Retrieves the number of threads the hardware can run concurrently.
+ *
+ * \returns The number of online logical processors, at least `1`.
+ */
+size_t tau_thread_hardware_concurrency(void);
+
 TAU_EXTERN_C_END
 
 #endif
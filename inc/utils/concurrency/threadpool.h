@@ -0,0 +1,115 @@
+/**
+ * \file
+ *
+ * \brief Work-stealing thread pool library interface.
+ *
+ * \details Every worker thread owns a double-ended queue of tasks. Tasks
+ * spawned by a worker are pushed to the back of its own queue and the worker
+ * takes its next task from the back as well, so related work stays on the
+ * same thread. Tasks spawned by other threads are pushed to a global injection
+ * queue. Idle workers take tasks from the injection queue first and steal from
+ * the front of other workers' queues second.
+ *
+ * Threads waiting for a result through the pool run queued tasks while they
+ * wait, so tasks may wait for other tasks without tying up a worker. Threads
+ * waiting for a parallel for only run the subranges of that call.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_THREADPOOL_H
+#define TAU_THREADPOOL_H
+
+#include "utils/common.h"
+#include "utils/concurrency/future.h"
+
+TAU_EXTERN_C_BEGIN
+
+/// Represents a work-stealing thread pool.
+typedef struct tau_threadpool_t tau_threadpool_t;
+
+/// Type of function to be run as a task.
+typedef void*(*tau_threadpool_func_t)(void* arg);
+
+/// Type of function to be run on a subrange by `tau_threadpool_parallel_for`.
+typedef void(*tau_threadpool_range_func_t)(void* arg, size_t begin, size_t end);
+
+/**
+ * \brief Initializes a new thread pool and starts its worker threads.
+ *
+ * \details With zero worker threads tasks only run on threads waiting through
+ * the pool.
+ *
+ * \param[in] thread_count The number of worker threads.
+ * \returns Pointer to the newly initialized thread pool.
+ */
+tau_threadpool_t* tau_threadpool_init(size_t thread_count);
+
+/**
+ * \brief Runs every queued task, stops the worker threads and frees all
+ * resources associated with a thread pool.
+ *
+ * \param[in] pool Pointer to the thread pool to be freed.
+ */
+void tau_threadpool_free(tau_threadpool_t* pool);
+
+/**
+ * \brief Retrieves the number of worker threads of a thread pool.
+ *
+ * \param[in] pool Pointer to the thread pool.
+ * \returns The number of worker threads.
+ */
+size_t tau_threadpool_thread_count(tau_threadpool_t* pool);
+
+/**
+ * \brief Queues a task whose result is not needed.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in] func The function to be run.
+ * \param[in] arg The argument to be passed to the function.
+ */
+void tau_threadpool_spawn(tau_threadpool_t* pool, tau_threadpool_func_t func, void* arg);
+
+/**
+ * \brief Queues a task and retrieves a future for its result.
+ *
+ * \details The promise is fulfilled with the return value of the function. It
+ * must stay alive until the future is ready.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in] func The function to be run.
+ * \param[in] arg The argument to be passed to the function.
+ * \param[in,out] promise Pointer to an initialized promise.
+ * \param[out] future Pointer to the future to be associated with the promise.
+ */
+void tau_threadpool_submit(tau_threadpool_t* pool, tau_threadpool_func_t func, void* arg, tau_promise_t* restrict promise, tau_future_t* restrict future);
+
+/**
+ * \brief Blocks until a future is ready, running queued tasks in the meantime.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in] future Pointer to the future to wait for.
+ */
+void tau_threadpool_wait(tau_threadpool_t* pool, tau_future_t* future);
+
+/**
+ * \brief Calls a function on disjoint subranges covering a range and blocks
+ * until every call returned.
+ *
+ * \details The range is split in halves until subranges hold at most `grain`
+ * elements. The calling thread takes part in the work, but runs no other
+ * tasks, so `func` may be called from a task that keeps per-thread state.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in] begin The first index of the range.
+ * \param[in] end One past the last index of the range.
+ * \param[in] grain The maximum number of indices per call, at least `1`.
+ * \param[in] func The function to be called on the subranges.
+ * \param[in] arg The argument to be passed to the function.
+ */
+void tau_threadpool_parallel_for(tau_threadpool_t* pool, size_t begin, size_t end, size_t grain, tau_threadpool_range_func_t func, void* arg);
+
+TAU_EXTERN_C_END
+
+#endif
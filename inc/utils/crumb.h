@@ -147,7 +147,7 @@ void tau_crumb_error_note(tau_crumb_error_t* error, tau_crumb_note_t* note);
 void tau_crumb_error_print(tau_crumb_error_t* error);
 
 /**
- * \brief Sets the crumb output stream.
+ * \brief Sets the crumb output stream of the current thread.
  * 
  * \param[in] stream Pointer to the output stream.
  */
@@ -25,12 +25,48 @@ TAU_EXTERN_C_BEGIN
 /**
  * \brief Generates a hash value for a given data.
  *
+ * \details Reads the data a word at a time. The hash values depend on the byte
+ * order of the host.
+ *
  * \param[in] data Pointer to the data to be hashed.
  * \param[in] size The size of the data in bytes.
  * \returns The generated hash value.
  */
 uint64_t tau_hash_digest(const void* data, size_t size);
 
+/**
+ * \brief Generates the FNV-1a hash value for a given data.
+ *
+ * \details Slower than `tau_hash_digest` but independent of the byte order of
+ * the host.
+ *
+ * \param[in] data Pointer to the data to be hashed.
+ * \param[in] size The size of the data in bytes.
+ * \returns The generated hash value.
+ */
+uint64_t tau_hash_fnv1a(const void* data, size_t size);
+
+/**
+ * \brief Generates a hash value for an integer.
+ *
+ * \details Every bit of the hash value depends on every bit of the integer, so
+ * any subset of the bits can serve as an index into a hash table.
+ *
+ * \param[in] value The integer to be hashed.
+ * \returns The generated hash value.
+ */
+uint64_t tau_hash_u64(uint64_t value);
+
+/**
+ * \brief Generates a hash value for a pointer.
+ *
+ * \details Hashes the address only, not the data it points to.
+ *
+ * \param[in] ptr The pointer to be hashed.
+ * \returns The generated hash value.
+ */
+uint64_t tau_hash_ptr(const void* ptr);
+
 /**
  * \brief Combines a seed with the hash value of a given data.
  * 
@@ -43,6 +79,9 @@ uint64_t tau_hash_combine_with_data(uint64_t seed, const void* data, size_t size
 
 /**
  * \brief Combines a seed with a hash value.
+ *
+ * \details The result depends on the order of the arguments, and every bit of
+ * it depends on every bit of both of them.
  * 
  * \param[in] seed The seed.
  * \param[in] hash The hash to combine with the seed.
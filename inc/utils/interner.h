@@ -0,0 +1,81 @@
+/**
+ * \file
+ *
+ * \brief String interner.
+ *
+ * \details The string interner is a per-thread singleton which maps every
+ * distinct string to a unique integer identifier. Interned strings are copied into memory
+ * owned by the interner and their hash is computed once, so comparing or
+ * hashing interned strings only involves their identifiers. The lexer interns
+ * every identifier it produces. Identifiers are only meaningful on the thread
+ * which interned them.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_INTERNER_H
+#define TAU_INTERNER_H
+
+#include "utils/common.h"
+#include "utils/str_view.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Identifier which does not belong to any interned string.
+ */
+#define TAU_INTERNER_NULL_ID ((uint32_t)0)
+
+/**
+ * \brief Interns a string.
+ *
+ * \param[in] str Pointer to the first character of the string.
+ * \param[in] len The length of the string.
+ * \returns The identifier of the string. Equal strings always yield the same
+ * identifier, which is never `TAU_INTERNER_NULL_ID`.
+ */
+uint32_t tau_interner_intern(const char* str, size_t len);
+
+/**
+ * \brief Looks up the identifier of a string without interning it.
+ *
+ * \param[in] str Pointer to the first character of the string.
+ * \param[in] len The length of the string.
+ * \returns The identifier of the string or `TAU_INTERNER_NULL_ID` if it was
+ * not interned.
+ */
+uint32_t tau_interner_find(const char* str, size_t len);
+
+/**
+ * \brief Retrieves an interned string.
+ *
+ * \param[in] id The identifier of the string.
+ * \returns String view of the interned string.
+ */
+tau_string_view_t tau_interner_view(uint32_t id);
+
+/**
+ * \brief Retrieves the precomputed hash of an interned string.
+ *
+ * \param[in] id The identifier of the string.
+ * \returns The hash of the string.
+ */
+uint64_t tau_interner_hash(uint32_t id);
+
+/**
+ * \brief Returns the number of interned strings.
+ *
+ * \returns The number of interned strings.
+ */
+size_t tau_interner_size(void);
+
+/**
+ * \brief Frees all interned strings. Previously returned identifiers become
+ * invalid.
+ */
+void tau_interner_free(void);
+
+TAU_EXTERN_C_END
+
+#endif
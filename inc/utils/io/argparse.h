@@ -92,6 +92,9 @@ void tau_argparse_ctx_free(tau_argparse_ctx_t* ctx);
 /**
  * \brief Fetches the next option from the argument list.
  *
+ * \details Long options also match in the form `--name=value`, in which case
+ * the value is returned by the next call to `tau_argparse_next_arg`.
+ *
  * \param[in,out] ctx Pointer to the argument parser context to be used.
  * \returns The identifier of the fetched option.
  */
@@ -141,6 +144,9 @@ const char* tau_argparse_get_arg_at(tau_argparse_ctx_t* ctx, size_t idx);
 /**
  * \brief Retrieves the current argument from the argument list and moves to the next.
  *
+ * \details If the last fetched option was given as `--name=value`, returns the
+ * value instead.
+ *
  * \param[in] ctx Pointer to the argument parser context to be used.
  * \returns The current argument or NULL if there are no more arguments.
  */
@@ -5,7 +5,14 @@
  * 
  * \details This file system utility library provides functions for common file
  * system operations. It includes functions to read file contents, identify
- * various file types and check if a file exists or is empty.
+ * various file types and check if a file exists or is empty, as well as to
+ * create, list, rename and remove files and directories.
+ *
+ * File views provide read-only access to the contents of a file. Regular files
+ * are memory-mapped where the operating system supports it, other files such
+ * as pipes are read into a buffer. The contents of a view are always followed
+ * by at least `TAU_FILE_VIEW_PADDING` null bytes, so scanners can treat the
+ * contents as a null-terminated string and read slightly past its end.
  *
  * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
@@ -16,11 +23,23 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include "utils/collections/vector.h"
 #include "utils/io/path.h"
 
 TAU_EXTERN_C_BEGIN
 
+/**
+ * \brief The minimum number of null bytes following the contents of a file view.
+ */
+#define TAU_FILE_VIEW_PADDING ((size_t)64)
+
+/**
+ * \brief Represents a read-only view of the contents of a file.
+ */
+typedef struct tau_file_view_t tau_file_view_t;
+
 /**
  * \brief Checks whether a path refers to a directory.
  *
@@ -109,12 +128,106 @@ size_t tau_file_size(tau_path_t* path);
  * 
  * \param[in] path The path to the file.
  * \param[out] buf Pointer to the buffer where the file contents will be stored.
- * \param[in] len The length of the buffer.
+ * \param[in] len The length of the buffer, including the null-terminator.
  * \returns The number of characters written into the buffer, excluding the
  * null-terminator.
  */
 size_t tau_file_read(tau_path_t* path, char* buf, size_t len);
 
+/**
+ * \brief Retrieves the time a file was last modified.
+ *
+ * \param[in] path Pointer to the path to be used.
+ * \returns The modification time in an unspecified unit, only meaningful when
+ * compared to other modification times, or 0 if an error occurred.
+ */
+uint64_t tau_file_modification_time(tau_path_t* path);
+
+/**
+ * \brief Sets the modification time of a file to the current time.
+ *
+ * \param[in] path Pointer to the path to be used.
+ * \returns `true` if the modification time was set, `false` otherwise.
+ */
+bool tau_file_touch(tau_path_t* path);
+
+/**
+ * \brief Renames a file, replacing the destination if it exists.
+ *
+ * \details On the same file system the destination is replaced atomically, so
+ * other processes either see the old file or the new one.
+ *
+ * \param[in] from Pointer to the path of the file to be renamed.
+ * \param[in] to Pointer to the new path of the file.
+ * \returns `true` if the file was renamed, `false` otherwise.
+ */
+bool tau_file_rename(tau_path_t* from, tau_path_t* to);
+
+/**
+ * \brief Removes a file.
+ *
+ * \param[in] path Pointer to the path of the file to be removed.
+ * \returns `true` if the file was removed, `false` otherwise.
+ */
+bool tau_file_remove(tau_path_t* path);
+
+/**
+ * \brief Creates a directory along with its missing parents.
+ *
+ * \param[in] path Pointer to the path of the directory.
+ * \returns `true` if the directory exists afterwards, `false` otherwise.
+ */
+bool tau_file_create_directory(tau_path_t* path);
+
+/**
+ * \brief Lists the entries of a directory.
+ *
+ * \details The entries `.` and `..` are not listed. The caller is responsible
+ * for freeing the paths and the vector.
+ *
+ * \param[in] path Pointer to the path of the directory.
+ * \returns Vector of paths to the entries of the directory, or `NULL` if the
+ * directory could not be read.
+ */
+tau_vector_t* tau_file_list_directory(tau_path_t* path);
+
+/**
+ * \brief Opens a read-only view of the contents of a file.
+ *
+ * \details Regular files are memory-mapped where supported, so their contents
+ * are not copied. Other files, and regular files which cannot be mapped, are
+ * read into a buffer until the end of the file.
+ *
+ * \param[in] path The path to the file.
+ * \returns Pointer to the newly opened file view, or `NULL` if the file could
+ * not be read.
+ */
+tau_file_view_t* tau_file_view_open(tau_path_t* path);
+
+/**
+ * \brief Closes a file view and releases its contents.
+ *
+ * \param[in] view Pointer to the file view to be closed.
+ */
+void tau_file_view_close(tau_file_view_t* view);
+
+/**
+ * \brief Retrieves the contents of a file view.
+ *
+ * \param[in] view Pointer to the file view.
+ * \returns Pointer to the contents, followed by at least
+ * `TAU_FILE_VIEW_PADDING` null bytes.
+ */
+const char* tau_file_view_data(tau_file_view_t* view);
+
+/**
+ * \brief Retrieves the size of the contents of a file view.
+ *
+ * \param[in] view Pointer to the file view.
+ * \returns The size of the contents in bytes, excluding the padding.
+ */
+size_t tau_file_view_size(tau_file_view_t* view);
+
 TAU_EXTERN_C_END
 
 #endif
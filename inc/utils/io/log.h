@@ -126,7 +126,7 @@ void tau_log_set_level(tau_log_level_t lvl);
 tau_log_level_t tau_log_get_level(void);
 
 /**
- * \brief Sets the output stream for logging messages.
+ * \brief Sets the output stream for logging messages on the current thread.
  *
  * \param[in] stream The output stream to set.
  */
@@ -12,6 +12,13 @@
  * in bulk for the entire group. This improves memory allocation and
  * deallocation efficiency by reducing the overhead associated with frequent
  * memory management operations.
+ *
+ * Allocations are served by bumping a pointer in the current chunk. When the
+ * current chunk is exhausted a new one is added whose capacity is double the
+ * capacity of the previous one, so the number of chunks grows logarithmically
+ * with the number of allocated bytes. Allocations larger than a fraction of
+ * the chunk capacity get a dedicated chunk of their own and leave the current
+ * chunk untouched.
  * 
  * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
@@ -32,6 +39,30 @@ TAU_EXTERN_C_BEGIN
  */
 typedef struct tau_arena_t tau_arena_t;
 
+/**
+ * \brief Represents a position in an arena allocator that it can be rolled
+ * back to.
+ *
+ * \details The members are internal to the arena allocator.
+ */
+typedef struct tau_arena_mark_t
+{
+  void* top; // Pointer to the most recently added chunk.
+  void* current; // Pointer to the chunk allocations were served from.
+  size_t size; // Number of used bytes in the current chunk.
+} tau_arena_mark_t;
+
+/**
+ * \brief Represents the statistics of an arena allocator.
+ */
+typedef struct tau_arena_stats_t
+{
+  size_t used; // Number of bytes handed out, including alignment padding.
+  size_t reserved; // Number of bytes reserved by the chunks.
+  size_t chunk_count; // Number of chunks.
+  size_t large_chunk_count; // Number of chunks dedicated to a single allocation.
+} tau_arena_stats_t;
+
 /**
  * \brief Initializes a new arena allocator.
  * 
@@ -42,7 +73,7 @@ tau_arena_t* tau_arena_init(void);
 /**
  * \brief Initializes a new arena allocator with a specified capacity.
  * 
- * \param[in] cap The capacity of the arena in bytes.
+ * \param[in] cap The capacity of the first chunk of the arena in bytes.
  * \returns Pointer to the initialized arena allocator.
  */
 tau_arena_t* tau_arena_init_with_capacity(size_t cap);
@@ -54,11 +85,23 @@ tau_arena_t* tau_arena_init_with_capacity(size_t cap);
  */
 void tau_arena_free(tau_arena_t* arena);
 
+/**
+ * \brief Moves all memory of an arena allocator into another. The source
+ * arena is freed in the process, its allocations stay valid until the
+ * destination arena is freed.
+ * 
+ * \param[in,out] dest Pointer to the arena allocator to merge into.
+ * \param[in] src Pointer to the arena allocator to be merged.
+ *
+ * \note Marks taken on either arena before the merge are invalidated.
+ */
+void tau_arena_merge(tau_arena_t* dest, tau_arena_t* src);
+
 /**
  * \brief Retrieves the capacity of an arena allocator.
  * 
  * \param[in] arena Pointer to the arena allocator.
- * \returns The capacity of the arena allocator in bytes.
+ * \returns The capacity of the first chunk of the arena allocator in bytes.
  */
 size_t tau_arena_capacity(tau_arena_t* arena);
 
@@ -77,7 +120,7 @@ bool tau_arena_owns(tau_arena_t* arena, void* ptr);
  *
  * \param[in] arena Pointer to the arena allocator.
  * \param[in] size The number of bytes to be allocated.
- * \returns Pointer to the newly allocated memory or `NULL`.
+ * \returns Pointer to the newly allocated memory.
  */
 void* tau_arena_alloc(tau_arena_t* arena, size_t size);
 
@@ -86,11 +129,48 @@ void* tau_arena_alloc(tau_arena_t* arena, size_t size);
  *
  * \param[in] arena Pointer to the arena allocator.
  * \param[in] size The number of bytes to be allocated.
- * \param[in] alignment The alignment requirement.
- * \returns Pointer to the newly allocated memory or `NULL`.
+ * \param[in] alignment The alignment requirement, must be a power of two.
+ * \returns Pointer to the newly allocated memory.
  */
 void* tau_arena_alloc_aligned(tau_arena_t* arena, size_t size, size_t alignment);
 
+/**
+ * \brief Records the current position of an arena allocator.
+ *
+ * \param[in] arena Pointer to the arena allocator.
+ * \returns The mark of the current position.
+ */
+tau_arena_mark_t tau_arena_mark(tau_arena_t* arena);
+
+/**
+ * \brief Releases every allocation made since a mark was taken.
+ *
+ * \details Chunks added after the mark are freed. Marks taken after `mark`
+ * are invalidated.
+ *
+ * \param[in,out] arena Pointer to the arena allocator.
+ * \param[in] mark The mark to roll back to.
+ */
+void tau_arena_rollback(tau_arena_t* arena, tau_arena_mark_t mark);
+
+/**
+ * \brief Releases every allocation of an arena allocator for reuse.
+ *
+ * \details The chunk allocations are served from is kept so that refilling
+ * the arena does not allocate right away, every other chunk is freed.
+ *
+ * \param[in,out] arena Pointer to the arena allocator.
+ */
+void tau_arena_reset(tau_arena_t* arena);
+
+/**
+ * \brief Retrieves the statistics of an arena allocator.
+ *
+ * \param[in] arena Pointer to the arena allocator.
+ * \returns The statistics of the arena allocator.
+ */
+tau_arena_stats_t tau_arena_stats(tau_arena_t* arena);
+
 TAU_EXTERN_C_END
 
 #endif
@@ -0,0 +1,191 @@
+/**
+ * \file
+ *
+ * \brief Memory accounting library interface.
+ *
+ * \details The memory accounting library is a lightweight counting allocator
+ * that attributes every allocation to an owner, such as the tokens or the AST
+ * of the file being compiled. Each thread has its own owner and its own
+ * counters of current and peak bytes per owner, so counting needs no
+ * synchronization. Allocations are prefixed with a small header holding their
+ * size and owner, which lets deallocations be attributed as well.
+ *
+ * In release builds the standard allocation functions are replaced by the
+ * counting ones, in debug builds the memory tracing library allocates through
+ * them. Counting is disabled until it is enabled, in which case the allocator
+ * only writes the header.
+ *
+ * Memory allocated by LLVM does not go through the allocator. Where the C
+ * library can report the size of its heap, the part of the heap not allocated
+ * through the allocator is attributed to LLVM. The heap is shared by every
+ * thread, so this is only accurate when a single file is compiled at a time.
+ *
+ * A memory report records the counters of the calling thread after each stage
+ * of compiling a file and prints the bytes retained after and the peak bytes
+ * during every stage, broken down by owner.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_MEMSTAT_H
+#define TAU_MEMSTAT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils/extern_c.h"
+
+#if !TAU_DEBUG
+# if !defined(TAU_MEMSTAT_IMPL) && !defined(TAU_MEMTRACE_IMPL)
+/**
+ * \brief Macro for memory allocation using tau_memstat_malloc.
+ *
+ * \param[in] SIZE The size of the memory to allocate.
+ * \returns A pointer to the allocated memory.
+ */
+#   define malloc(SIZE) tau_memstat_malloc((SIZE))
+
+/**
+ * \brief Macro for array allocation using tau_memstat_calloc.
+ *
+ * \param[in] COUNT The number of elements in the array.
+ * \param[in] SIZE The size of each element in the array.
+ * \returns A pointer to the allocated memory.
+ */
+#   define calloc(COUNT, SIZE) tau_memstat_calloc((COUNT), (SIZE))
+
+/**
+ * \brief Macro for memory reallocation using tau_memstat_realloc.
+ *
+ * \param[in] PTR A pointer to the previously allocated memory block.
+ * \param[in] SIZE The new size of the memory block.
+ * \returns A pointer to the reallocated memory block.
+ */
+#   define realloc(PTR, SIZE) tau_memstat_realloc((PTR), (SIZE))
+
+/**
+ * \brief Macro for memory deallocation using tau_memstat_free.
+ *
+ * \param[in] PTR A pointer to the memory block to deallocate.
+ */
+#   define free(PTR) tau_memstat_free((PTR))
+# endif
+#endif
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Enumeration of memory owners.
+ */
+typedef enum tau_memstat_owner_t
+{
+  TAU_MEMSTAT_OWNER_TOKENS, // Tokens and the strings they refer to.
+  TAU_MEMSTAT_OWNER_AST, // Abstract syntax tree nodes.
+  TAU_MEMSTAT_OWNER_SYMTABLE, // Symbol tables and symbols.
+  TAU_MEMSTAT_OWNER_TYPETABLE, // Type tables.
+  TAU_MEMSTAT_OWNER_TYPEDESC, // Type descriptors.
+  TAU_MEMSTAT_OWNER_LLVM, // Memory allocated by LLVM.
+  TAU_MEMSTAT_OWNER_OTHER, // Everything else.
+  TAU_MEMSTAT_OWNER_COUNT // Number of owners.
+} tau_memstat_owner_t;
+
+/**
+ * \brief Allocates memory of the specified size and counts it towards the
+ * owner of the calling thread.
+ *
+ * \param[in] size The size of the memory to allocate.
+ * \returns A pointer to the allocated memory or `NULL` on failure.
+ */
+void* tau_memstat_malloc(size_t size);
+
+/**
+ * \brief Allocates zero-initialized memory for an array of elements and counts
+ * it towards the owner of the calling thread.
+ *
+ * \param[in] count The number of elements in the array.
+ * \param[in] size The size of each element in the array.
+ * \returns A pointer to the allocated memory or `NULL` on failure.
+ */
+void* tau_memstat_calloc(size_t count, size_t size);
+
+/**
+ * \brief Changes the size of a memory block. The block keeps its owner.
+ *
+ * \param[in] ptr A pointer to the previously allocated memory block.
+ * \param[in] size The new size of the memory block.
+ * \returns A pointer to the reallocated memory block or `NULL` on failure.
+ */
+void* tau_memstat_realloc(void* ptr, size_t size);
+
+/**
+ * \brief Deallocates a memory block.
+ *
+ * \param[in] ptr A pointer to the memory block to deallocate.
+ */
+void tau_memstat_free(void* ptr);
+
+/**
+ * \brief Returns the size of a memory block.
+ *
+ * \param[in] ptr A pointer to a memory block allocated by the allocator.
+ * \returns The size of the memory block in bytes.
+ */
+size_t tau_memstat_size(const void* ptr);
+
+/**
+ * \brief Enables counting. Must be called before other threads allocate.
+ */
+void tau_memstat_enable(void);
+
+/**
+ * \brief Checks whether allocations are counted.
+ *
+ * \returns `true` if allocations are counted, `false` otherwise.
+ */
+bool tau_memstat_is_enabled(void);
+
+/**
+ * \brief Sets the owner of the allocations of the calling thread.
+ *
+ * \param[in] owner The new owner, other than LLVM.
+ * \returns The previous owner.
+ */
+tau_memstat_owner_t tau_memstat_set_owner(tau_memstat_owner_t owner);
+
+/**
+ * \brief Returns the name of an owner.
+ *
+ * \param[in] owner The owner.
+ * \returns The name of the owner.
+ */
+const char* tau_memstat_owner_to_cstr(tau_memstat_owner_t owner);
+
+/**
+ * \brief Begins a memory report on the calling thread. Does nothing if counting
+ * is disabled.
+ */
+void tau_memstat_report_begin(void);
+
+/**
+ * \brief Records the memory used by the stage that just finished in the
+ * memory report of the calling thread. Does nothing if there is none.
+ *
+ * \param[in] stage The name of the stage, which must outlive the report.
+ */
+void tau_memstat_report_stage(const char* stage);
+
+/**
+ * \brief Prints and ends the memory report of the calling thread. Does nothing
+ * if there is none.
+ *
+ * \param[in] stream The stream to be written to.
+ * \param[in] title The title of the report.
+ */
+void tau_memstat_report_end(FILE* stream, const char* title);
+
+TAU_EXTERN_C_END
+
+#endif
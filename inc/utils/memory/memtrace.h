@@ -13,6 +13,18 @@
  * library is a useful tool for diagnosing memory-related issues and improving
  * the overall memory management of the application.
  * 
+ * Live allocations are kept in a hash table keyed by their pointers and
+ * aggregated by the source location that allocated them. At program exit the
+ * allocation sites with the most bytes and the most allocations are logged,
+ * along with the sites of leaked memory.
+ * 
+ * The behavior can be tuned with environment variables read on the first
+ * allocation. `TAU_MEMTRACE_SAMPLE=N` records only 1 in N allocations, which
+ * lowers the overhead but leaves unrecorded memory out of leak detection and
+ * the checks for invalid pointers. The statistics still cover every
+ * allocation. `TAU_MEMTRACE_TOP=N` sets the number of allocation sites logged
+ * at exit, 10 by default.
+ * 
  * \copyright Copyright (c) Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
 */
@@ -0,0 +1,69 @@
+/**
+ * \file
+ *
+ * \brief Byte scanning library interface.
+ *
+ * \details The scanning functions search a byte range for the first byte
+ * which does or does not belong to a character class. On x86 targets they
+ * examine 16 (SSE2) or 32 (AVX2) bytes at a time, with AVX2 selected at
+ * runtime when the processor supports it. Other targets fall back to scalar
+ * loops. Every function only reads bytes inside `[begin, end)`.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_SCAN_H
+#define TAU_SCAN_H
+
+#include "utils/extern_c.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Skips blank characters.
+ *
+ * \details Blank characters are the whitespace characters other than the line
+ * feed: space, horizontal tab, vertical tab, form feed and carriage return.
+ *
+ * \param[in] begin Pointer to the first byte of the range.
+ * \param[in] end Pointer past the last byte of the range.
+ * \returns Pointer to the first non-blank byte, or `end` if there is none.
+ */
+const char* tau_scan_skip_blank(const char* begin, const char* end);
+
+/**
+ * \brief Skips word characters.
+ *
+ * \details Word characters are ASCII letters, decimal digits and underscores.
+ *
+ * \param[in] begin Pointer to the first byte of the range.
+ * \param[in] end Pointer past the last byte of the range.
+ * \returns Pointer to the first non-word byte, or `end` if there is none.
+ */
+const char* tau_scan_skip_word(const char* begin, const char* end);
+
+/**
+ * \brief Finds the first line feed.
+ *
+ * \param[in] begin Pointer to the first byte of the range.
+ * \param[in] end Pointer past the last byte of the range.
+ * \returns Pointer to the first line feed, or `end` if there is none.
+ */
+const char* tau_scan_find_newline(const char* begin, const char* end);
+
+/**
+ * \brief Finds the first occurrence of either of two bytes.
+ *
+ * \param[in] begin Pointer to the first byte of the range.
+ * \param[in] end Pointer past the last byte of the range.
+ * \param[in] a The first byte to be searched for.
+ * \param[in] b The second byte to be searched for.
+ * \returns Pointer to the first byte equal to `a` or `b`, or `end` if there
+ * is none.
+ */
+const char* tau_scan_find_either(const char* begin, const char* end, char a, char b);
+
+TAU_EXTERN_C_END
+
+#endif
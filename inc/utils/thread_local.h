@@ -0,0 +1,27 @@
+/**
+ * \file
+ *
+ * \brief TAU_THREAD_LOCAL utility macro.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_THREAD_LOCAL_H
+#define TAU_THREAD_LOCAL_H
+
+#include "utils/compiler_detect.h"
+
+#if TAU_COMPILER_MSVC
+
+/// Gives a variable thread storage duration.
+# define TAU_THREAD_LOCAL __declspec(thread)
+
+#else
+
+/// Gives a variable thread storage duration.
+# define TAU_THREAD_LOCAL _Thread_local
+
+#endif
+
+#endif
@@ -16,24 +16,34 @@
 #ifndef TAU_TIMER_H
 #define TAU_TIMER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "utils/esc_seq.h"
+#include "utils/trace.h"
 #include "utils/io/log.h"
 
 /**
- * \brief Measures the execution time of a given statement and logs the elapsed
- * time in milliseconds.
+ * \brief Measures the execution time of a given statement, logs the elapsed
+ * time in milliseconds and records it as a time trace span.
+ *
+ * \details If neither debug logging nor time tracing is enabled, the statement
+ * is executed without reading the timer.
  *
  * \param[in] NAME The name for identifying the measurement.
  * \param[in] STMT The statement to be executed and timed.
  */
 #define tau_time_it(NAME, STMT)\
   do {\
+    bool time_it_logged = tau_log_get_level() <= TAU_LOG_LEVEL_DEBUG;\
+    bool time_it_traced = tau_trace_is_enabled();\
+    if (!time_it_logged && !time_it_traced) { STMT; break; }\
+    if (time_it_traced) tau_trace_begin(NAME);\
     uint64_t time_it_begin = tau_timer_now();\
     { STMT; }\
     uint64_t time_it_end = tau_timer_now();\
-    tau_log_debug("timer", "[" TAU_ESC_FG_BRIGHT_BLACK NAME TAU_ESC_RESET "] Elapsed time: %.6g ms", (double)(time_it_end - time_it_begin) / (double)tau_timer_freq() * 1000.0);\
+    if (time_it_traced) tau_trace_end();\
+    if (time_it_logged) tau_log_debug("timer", "[" TAU_ESC_FG_BRIGHT_BLACK NAME TAU_ESC_RESET "] Elapsed time: %.6g ms", (double)(time_it_end - time_it_begin) / (double)tau_timer_freq() * 1000.0);\
   } while (0)\
 
 TAU_EXTERN_C_BEGIN
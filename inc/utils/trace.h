@@ -0,0 +1,80 @@
+/**
+ * \file
+ *
+ * \brief Time trace library interface.
+ *
+ * \details The time trace library records nested spans of time on every thread
+ * and writes them as a JSON file in the Chrome trace event format, which can be
+ * viewed in `chrome://tracing` or Perfetto. Spans on the same thread must be
+ * properly nested, each begin is matched by an end on the same thread.
+ *
+ * Recording is disabled until the library is initialized, in which case
+ * beginning and ending a span only checks a flag.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_TRACE_H
+#define TAU_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "utils/extern_c.h"
+
+TAU_EXTERN_C_BEGIN
+
+/**
+ * \brief Enables recording. Must be called before spans are recorded on other
+ * threads.
+ */
+void tau_trace_init(void);
+
+/**
+ * \brief Disables recording and frees every recorded span. Must be called when
+ * no other thread records spans.
+ */
+void tau_trace_free(void);
+
+/**
+ * \brief Checks whether spans are recorded.
+ *
+ * \returns `true` if spans are recorded, `false` otherwise.
+ */
+bool tau_trace_is_enabled(void);
+
+/**
+ * \brief Begins a span on the calling thread.
+ *
+ * \param[in] name The name of the span, which must outlive the library.
+ */
+void tau_trace_begin(const char* name);
+
+/**
+ * \brief Begins a span on the calling thread with a detail shown alongside its
+ * name, such as the file or declaration it belongs to.
+ *
+ * \param[in] name The name of the span, which must outlive the library.
+ * \param[in] detail Pointer to the detail, which is copied.
+ * \param[in] len The length of the detail.
+ */
+void tau_trace_begin_with_detail(const char* name, const char* detail, size_t len);
+
+/**
+ * \brief Ends the innermost span of the calling thread.
+ */
+void tau_trace_end(void);
+
+/**
+ * \brief Writes every recorded span to a file. Spans still open are written
+ * as if they ended now. Must be called when no other thread records spans.
+ *
+ * \param[in] path Path to the file to be written.
+ * \returns `true` if the file was written, `false` otherwise.
+ */
+bool tau_trace_write(const char* path);
+
+TAU_EXTERN_C_END
+
+#endif
@@ -7,36 +7,18 @@
 
 #include "ast/decl/enum_constant.h"
 
-#include "ast/registry.h"
-
-tau_ast_decl_enum_constant_t* tau_ast_decl_enum_constant_init(void)
-{
-  tau_ast_decl_enum_constant_t* node = (tau_ast_decl_enum_constant_t*)malloc(sizeof(tau_ast_decl_enum_constant_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_DECL_ENUM_CONSTANT;
-
-  return node;
-}
-
-void tau_ast_decl_enum_constant_free(tau_ast_decl_enum_constant_t* node)
+tau_ast_decl_enum_constant_t* tau_ast_decl_enum_constant_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_decl_enum_constant_t*)tau_ast_node_init(arena, sizeof(tau_ast_decl_enum_constant_t), TAU_AST_DECL_ENUM_CONSTANT);
 }
 
 void tau_ast_decl_enum_constant_nameres(tau_nameres_ctx_t* ctx, tau_ast_decl_enum_constant_t* node)
 {
-  tau_symtable_t* scope = tau_nameres_ctx_scope_cur(ctx);
-
-  tau_string_view_t id_view = tau_token_to_string_view(node->id->tok);
-  tau_symbol_t* sym = tau_symbol_init_with_str_view(id_view, (tau_ast_node_t*)node);
-  tau_symbol_t* collision = tau_symtable_insert(scope, sym);
+  tau_ast_node_t* collision = tau_nameres_ctx_declare(ctx, node->id->tok->id, (tau_ast_node_t*)node);
 
   if (collision != NULL)
   {
-    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->node->tok));
+    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->tok));
   }
 }
 
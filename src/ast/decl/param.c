@@ -8,23 +8,10 @@
 #include "ast/decl/param.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_decl_param_t* tau_ast_decl_param_init(void)
+tau_ast_decl_param_t* tau_ast_decl_param_init(tau_arena_t* arena)
 {
-  tau_ast_decl_param_t* node = (tau_ast_decl_param_t*)malloc(sizeof(tau_ast_decl_param_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_DECL_PARAM;
-
-  return node;
-}
-
-void tau_ast_decl_param_free(tau_ast_decl_param_t* node)
-{
-  free(node);
+  return (tau_ast_decl_param_t*)tau_ast_node_init(arena, sizeof(tau_ast_decl_param_t), TAU_AST_DECL_PARAM);
 }
 
 void tau_ast_decl_param_nameres(tau_nameres_ctx_t* ctx, tau_ast_decl_param_t* node)
@@ -36,16 +23,11 @@ void tau_ast_decl_param_nameres(tau_nameres_ctx_t* ctx, tau_ast_decl_param_t* no
     tau_ast_node_nameres(ctx, node->expr);
   }
 
-  tau_symtable_t* scope = tau_nameres_ctx_scope_cur(ctx);
-
-  tau_string_view_t id_view = tau_token_to_string_view(node->id->tok);
-  tau_symbol_t* sym = tau_symbol_init_with_str_view(id_view, (tau_ast_node_t*)node);
-
-  tau_symbol_t* collision = tau_symtable_insert(scope, sym);
+  tau_ast_node_t* collision = tau_nameres_ctx_declare(ctx, node->id->tok->id, (tau_ast_node_t*)node);
 
-  if (collision != NULL && collision->node->kind == TAU_AST_DECL_PARAM)
+  if (collision != NULL && collision->kind == TAU_AST_DECL_PARAM)
   {
-    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->node->tok));
+    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->tok));
   }
 }
 
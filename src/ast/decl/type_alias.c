@@ -7,41 +7,22 @@
 
 #include "ast/decl/type_alias.h"
 
-#include "ast/registry.h"
-
-tau_ast_decl_type_alias_t* tau_ast_decl_type_alias_init(void)
+tau_ast_decl_type_alias_t* tau_ast_decl_type_alias_init(tau_arena_t* arena)
 {
-  tau_ast_decl_type_alias_t* node = (tau_ast_decl_type_alias_t*)malloc(sizeof(tau_ast_decl_type_alias_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_DECL_TYPE_ALIAS;
-
-  return node;
-}
-
-void tau_ast_decl_type_alias_free(tau_ast_decl_type_alias_t* node)
-{
-  free(node);
+  return (tau_ast_decl_type_alias_t*)tau_ast_node_init(arena, sizeof(tau_ast_decl_type_alias_t), TAU_AST_DECL_TYPE_ALIAS);
 }
 
 void tau_ast_decl_type_alias_nameres(tau_nameres_ctx_t* ctx, tau_ast_decl_type_alias_t* node)
 {
-  tau_symtable_t* scope = tau_nameres_ctx_scope_cur(ctx);
-
-  tau_string_view_t id_view = tau_token_to_string_view(node->id->tok);
-  tau_symbol_t* sym = tau_symbol_init_with_str_view(id_view, (tau_ast_node_t*)node);
-
-  tau_symbol_t* collision = tau_symtable_insert(scope, sym);
+  tau_ast_node_t* collision = tau_nameres_ctx_declare(ctx, node->id->tok->id, (tau_ast_node_t*)node);
 
   if (collision != NULL)
   {
-    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->node->tok));
+    tau_error_bag_put_nameres_symbol_collision(ctx->errors, tau_token_location(node->tok), tau_token_location(collision->tok));
     return;
   }
 
-  node->scope = tau_nameres_ctx_scope_begin(ctx);
+  tau_nameres_ctx_scope_begin(ctx);
 
   tau_ast_node_nameres(ctx, node->type);
 
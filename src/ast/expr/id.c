@@ -8,39 +8,23 @@
 #include "ast/expr/id.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_id_t* tau_ast_expr_id_init(void)
+tau_ast_expr_id_t* tau_ast_expr_id_init(tau_arena_t* arena)
 {
-  tau_ast_expr_id_t* node = (tau_ast_expr_id_t*)malloc(sizeof(tau_ast_expr_id_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_ID;
-
-  return node;
-}
-
-void tau_ast_expr_id_free(tau_ast_expr_id_t* node)
-{
-  free(node);
+  return (tau_ast_expr_id_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_id_t), TAU_AST_EXPR_ID);
 }
 
 void tau_ast_expr_id_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_id_t* node)
 {
-  tau_symtable_t* scope = tau_nameres_ctx_scope_cur(ctx);
-
-  tau_string_view_t id_view = tau_token_to_string_view(node->tok);
-  tau_symbol_t* sym = tau_symtable_lookup_with_str_view(scope, id_view);
+  tau_ast_node_t* decl = tau_nameres_ctx_lookup(ctx, node->tok->id);
 
-  if (sym == NULL)
+  if (decl == NULL)
   {
     tau_error_bag_put_nameres_undefined_symbol(ctx->errors, tau_token_location(node->tok));
     return;
   }
 
-  switch (sym->node->kind)
+  switch (decl->kind)
   {
   case TAU_AST_DECL_VAR:
   case TAU_AST_DECL_PARAM:
@@ -53,7 +37,7 @@ void tau_ast_expr_id_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_id_t* node)
   }
   }
 
-  node->decl = sym->node;
+  node->decl = decl;
 }
 
 void tau_ast_expr_id_typecheck(tau_typecheck_ctx_t* ctx, tau_ast_expr_id_t* node)
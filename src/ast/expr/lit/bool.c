@@ -7,23 +7,9 @@
 
 #include "ast/expr/lit/bool.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_lit_bool_t* tau_ast_expr_lit_bool_init(void)
-{
-  tau_ast_expr_lit_bool_t* node = (tau_ast_expr_lit_bool_t*)malloc(sizeof(tau_ast_expr_lit_bool_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_LIT_BOOL;
-
-  return node;
-}
-
-void tau_ast_expr_lit_bool_free(tau_ast_expr_lit_bool_t* node)
+tau_ast_expr_lit_bool_t* tau_ast_expr_lit_bool_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_expr_lit_bool_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_lit_bool_t), TAU_AST_EXPR_LIT_BOOL);
 }
 
 void tau_ast_expr_lit_bool_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_expr_lit_bool_t* TAU_UNUSED(node))
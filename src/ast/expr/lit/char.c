@@ -7,23 +7,9 @@
 
 #include "ast/expr/lit/char.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_lit_char_t* tau_ast_expr_lit_char_init(void)
-{
-  tau_ast_expr_lit_char_t* node = (tau_ast_expr_lit_char_t*)malloc(sizeof(tau_ast_expr_lit_char_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_LIT_CHAR;
-
-  return node;
-}
-
-void tau_ast_expr_lit_char_free(tau_ast_expr_lit_char_t* node)
+tau_ast_expr_lit_char_t* tau_ast_expr_lit_char_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_expr_lit_char_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_lit_char_t), TAU_AST_EXPR_LIT_CHAR);
 }
 
 void tau_ast_expr_lit_char_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_expr_lit_char_t* TAU_UNUSED(node))
@@ -7,23 +7,9 @@
 
 #include "ast/expr/lit/int.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_lit_int_t* tau_ast_expr_lit_int_init(void)
-{
-  tau_ast_expr_lit_int_t* node = (tau_ast_expr_lit_int_t*)malloc(sizeof(tau_ast_expr_lit_int_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_LIT_INT;
-
-  return node;
-}
-
-void tau_ast_expr_lit_int_free(tau_ast_expr_lit_int_t* node)
+tau_ast_expr_lit_int_t* tau_ast_expr_lit_int_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_expr_lit_int_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_lit_int_t), TAU_AST_EXPR_LIT_INT);
 }
 
 void tau_ast_expr_lit_int_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_expr_lit_int_t* TAU_UNUSED(node))
@@ -7,24 +7,9 @@
 
 #include "ast/expr/lit/str.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_lit_str_t* tau_ast_expr_lit_str_init(void)
-{
-  tau_ast_expr_lit_str_t* node = (tau_ast_expr_lit_str_t*)malloc(sizeof(tau_ast_expr_lit_str_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_LIT_STR;
-
-  return node;
-}
-
-void tau_ast_expr_lit_str_free(tau_ast_expr_lit_str_t* node)
+tau_ast_expr_lit_str_t* tau_ast_expr_lit_str_init(tau_arena_t* arena)
 {
-  free(node->value);
-  free(node);
+  return (tau_ast_expr_lit_str_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_lit_str_t), TAU_AST_EXPR_LIT_STR);
 }
 
 void tau_ast_expr_lit_str_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_expr_lit_str_t* TAU_UNUSED(node))
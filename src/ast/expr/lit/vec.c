@@ -7,27 +7,14 @@
 
 #include "ast/expr/lit/vec.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_lit_vec_t* tau_ast_expr_lit_vec_init(void)
+tau_ast_expr_lit_vec_t* tau_ast_expr_lit_vec_init(tau_arena_t* arena)
 {
-  tau_ast_expr_lit_vec_t* node = (tau_ast_expr_lit_vec_t*)malloc(sizeof(tau_ast_expr_lit_vec_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_LIT_VEC;
-  node->values = tau_vector_init();
+  tau_ast_expr_lit_vec_t* node = (tau_ast_expr_lit_vec_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_lit_vec_t), TAU_AST_EXPR_LIT_VEC);
+  node->values = tau_vector_init_with_arena(arena);
 
   return node;
 }
 
-void tau_ast_expr_lit_vec_free(tau_ast_expr_lit_vec_t* node)
-{
-  tau_vector_free(node->values);
-  free(node);
-}
-
 void tau_ast_expr_lit_vec_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_lit_vec_t* node)
 {
   TAU_VECTOR_FOR_LOOP(i, node->values)
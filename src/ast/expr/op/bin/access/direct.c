@@ -8,16 +8,10 @@
 #include "ast/expr/op/bin/access/direct.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_bin_access_direct_t* tau_ast_expr_op_bin_access_direct_init(void)
+tau_ast_expr_op_bin_access_direct_t* tau_ast_expr_op_bin_access_direct_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_access_direct_t* node = (tau_ast_expr_op_bin_access_direct_t*)malloc(sizeof(tau_ast_expr_op_bin_access_direct_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_access_direct_t* node = (tau_ast_expr_op_bin_access_direct_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_access_direct_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ACCESS_DIRECT;
 
   return node;
@@ -47,8 +41,7 @@ void tau_ast_expr_op_bin_access_direct_typecheck(tau_typecheck_ctx_t* ctx, tau_a
 
     node->decl = (tau_ast_node_t*)enum_node;
 
-    tau_string_view_t id_view = tau_token_to_string_view(node->rhs->tok);
-    tau_symbol_t* mbr_sym = tau_symtable_get_with_str_view(enum_node->scope, id_view);
+    tau_symbol_t* mbr_sym = tau_symtable_get(enum_node->scope, node->rhs->tok->id);
 
     if (mbr_sym == NULL)
     {
@@ -95,8 +88,7 @@ void tau_ast_expr_op_bin_access_direct_typecheck(tau_typecheck_ctx_t* ctx, tau_a
       TAU_UNREACHABLE();
     }
 
-    tau_string_view_t id_view = tau_token_to_string_view(node->rhs->tok);
-    tau_symbol_t* mbr_sym = tau_symtable_get_with_str_view(decl_scope, id_view);
+    tau_symbol_t* mbr_sym = tau_symtable_get(decl_scope, node->rhs->tok->id);
 
     if (mbr_sym == NULL)
     {
@@ -8,7 +8,6 @@
 #include "ast/expr/op/bin/arit/add.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 #include "utils/diagnostics.h"
 
 static void tau_ast_expr_op_bin_arit_add_typecheck_scalar(tau_typecheck_ctx_t* ctx, tau_ast_expr_op_bin_arit_add_t* node, tau_typedesc_t* lhs_desc, tau_typedesc_t* rhs_desc)
@@ -110,14 +109,9 @@ static void tau_ast_expr_op_bin_arit_add_typecheck_matrix(tau_typecheck_ctx_t* c
   node->op_subkind = OP_ARIT_ADD_MATRIX;
 }
 
-tau_ast_expr_op_bin_arit_add_t* tau_ast_expr_op_bin_arit_add_init(void)
+tau_ast_expr_op_bin_arit_add_t* tau_ast_expr_op_bin_arit_add_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_arit_add_t* node = (tau_ast_expr_op_bin_arit_add_t*)malloc(sizeof(tau_ast_expr_op_bin_arit_add_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_arit_add_t* node = (tau_ast_expr_op_bin_arit_add_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_arit_add_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ARIT_ADD;
 
   return node;
@@ -8,17 +8,11 @@
 #include "ast/expr/op/bin/arit/div.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 #include "utils/diagnostics.h"
 
-tau_ast_expr_op_bin_arit_div_t* tau_ast_expr_op_bin_arit_div_init(void)
+tau_ast_expr_op_bin_arit_div_t* tau_ast_expr_op_bin_arit_div_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_arit_div_t* node = (tau_ast_expr_op_bin_arit_div_t*)malloc(sizeof(tau_ast_expr_op_bin_arit_div_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_arit_div_t* node = (tau_ast_expr_op_bin_arit_div_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_arit_div_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ARIT_DIV;
 
   return node;
@@ -8,7 +8,6 @@
 #include "ast/expr/op/bin/arit/mul.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 #include "utils/diagnostics.h"
 
 static void tau_ast_expr_op_bin_arit_mul_typecheck_scalar(tau_typecheck_ctx_t* ctx, tau_ast_expr_op_bin_arit_mul_t* node, tau_typedesc_t* lhs_desc, tau_typedesc_t* rhs_desc)
@@ -168,14 +167,9 @@ static void tau_ast_expr_op_bin_arit_mul_codegen_matrix_scalar(tau_codegen_ctx_t
   node->llvm_value = tau_codegen_build_matrix_mul_scalar(ctx, desc, llvm_lhs_value, llvm_rhs_value);
 }
 
-tau_ast_expr_op_bin_arit_mul_t* tau_ast_expr_op_bin_arit_mul_init(void)
+tau_ast_expr_op_bin_arit_mul_t* tau_ast_expr_op_bin_arit_mul_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_arit_mul_t* node = (tau_ast_expr_op_bin_arit_mul_t*)malloc(sizeof(tau_ast_expr_op_bin_arit_mul_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_arit_mul_t* node = (tau_ast_expr_op_bin_arit_mul_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_arit_mul_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ARIT_MUL;
 
   return node;
@@ -8,7 +8,6 @@
 #include "ast/expr/op/bin/arit/sub.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 #include "utils/diagnostics.h"
 
 static void tau_ast_expr_op_bin_arit_sub_typecheck_scalar(tau_typecheck_ctx_t* ctx, tau_ast_expr_op_bin_arit_sub_t* node, tau_typedesc_t* lhs_desc, tau_typedesc_t* rhs_desc)
@@ -110,14 +109,9 @@ static void tau_ast_expr_op_bin_arit_sub_typecheck_matrix(tau_typecheck_ctx_t* c
   node->op_subkind = OP_ARIT_SUB_MATRIX;
 }
 
-tau_ast_expr_op_bin_arit_sub_t* tau_ast_expr_op_bin_arit_sub_init(void)
+tau_ast_expr_op_bin_arit_sub_t* tau_ast_expr_op_bin_arit_sub_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_arit_sub_t* node = (tau_ast_expr_op_bin_arit_sub_t*)malloc(sizeof(tau_ast_expr_op_bin_arit_sub_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_arit_sub_t* node = (tau_ast_expr_op_bin_arit_sub_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_arit_sub_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ARIT_SUB;
 
   return node;
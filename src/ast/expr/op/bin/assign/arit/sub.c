@@ -8,16 +8,10 @@
 #include "ast/expr/op/bin/assign/arit/sub.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_bin_assign_arit_sub_t* tau_ast_expr_op_bin_assign_arit_sub_init(void)
+tau_ast_expr_op_bin_assign_arit_sub_t* tau_ast_expr_op_bin_assign_arit_sub_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_assign_arit_sub_t* node = (tau_ast_expr_op_bin_assign_arit_sub_t*)malloc(sizeof(tau_ast_expr_op_bin_assign_arit_sub_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_assign_arit_sub_t* node = (tau_ast_expr_op_bin_assign_arit_sub_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_assign_arit_sub_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_ASSIGN_ARIT_SUB;
 
   return node;
@@ -8,23 +8,10 @@
 #include "ast/expr/op/bin/bin.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_bin_t* tau_ast_expr_op_bin_init(void)
+tau_ast_expr_op_bin_t* tau_ast_expr_op_bin_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_t* node = (tau_ast_expr_op_bin_t*)malloc(sizeof(tau_ast_expr_op_bin_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
-
-  return node;
-}
-
-void tau_ast_expr_op_bin_free(tau_ast_expr_op_bin_t* node)
-{
-  free(node);
+  return (tau_ast_expr_op_bin_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_t), TAU_AST_EXPR_OP_BINARY);
 }
 
 void tau_ast_expr_op_bin_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_op_bin_t* node)
@@ -8,7 +8,6 @@
 #include "ast/expr/op/bin/cmp/eq.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
 static void tau_ast_expr_op_bin_cmp_eq_typecheck_scalar(tau_typecheck_ctx_t* ctx, tau_ast_expr_op_bin_cmp_eq_t* node, tau_typedesc_t* lhs_desc, tau_typedesc_t* rhs_desc)
 {
@@ -94,14 +93,9 @@ static void tau_ast_expr_op_bin_cmp_eq_codegen_vector(tau_codegen_ctx_t* ctx, ta
   node->llvm_value = tau_codegen_build_vector_eq(ctx, promoted_vec_desc, llvm_lhs_value, llvm_rhs_value);
 }
 
-tau_ast_expr_op_bin_cmp_eq_t* tau_ast_expr_op_bin_cmp_eq_init(void)
+tau_ast_expr_op_bin_cmp_eq_t* tau_ast_expr_op_bin_cmp_eq_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_bin_cmp_eq_t* node = (tau_ast_expr_op_bin_cmp_eq_t*)malloc(sizeof(tau_ast_expr_op_bin_cmp_eq_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_BINARY;
+  tau_ast_expr_op_bin_cmp_eq_t* node = (tau_ast_expr_op_bin_cmp_eq_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_bin_cmp_eq_t), TAU_AST_EXPR_OP_BINARY);
   node->op_kind = OP_CMP_EQ;
 
   return node;
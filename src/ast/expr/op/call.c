@@ -7,27 +7,14 @@
 
 #include "ast/expr/op/call.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_op_call_t* tau_ast_expr_op_call_init(void)
+tau_ast_expr_op_call_t* tau_ast_expr_op_call_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_call_t* node = (tau_ast_expr_op_call_t*)malloc(sizeof(tau_ast_expr_op_call_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_CALL;
-  node->params = tau_vector_init();
+  tau_ast_expr_op_call_t* node = (tau_ast_expr_op_call_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_call_t), TAU_AST_EXPR_OP_CALL);
+  node->params = tau_vector_init_with_arena(arena);
 
   return node;
 }
 
-void tau_ast_expr_op_call_free(tau_ast_expr_op_call_t* node)
-{
-  tau_vector_free(node->params);
-  free(node);
-}
-
 void tau_ast_expr_op_call_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_op_call_t* node)
 {
   tau_ast_node_nameres(ctx, node->callee);
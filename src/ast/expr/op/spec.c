@@ -7,28 +7,15 @@
 
 #include "ast/expr/op/spec.h"
 
-#include "ast/registry.h"
-
-tau_ast_expr_op_spec_t* tau_ast_expr_op_spec_init(void)
+tau_ast_expr_op_spec_t* tau_ast_expr_op_spec_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_spec_t* node = (tau_ast_expr_op_spec_t*)malloc(sizeof(tau_ast_expr_op_spec_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_SPEC;
+  tau_ast_expr_op_spec_t* node = (tau_ast_expr_op_spec_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_spec_t), TAU_AST_EXPR_OP_SPEC);
   node->op_kind = OP_SPEC;
-  node->params = tau_vector_init();
+  node->params = tau_vector_init_with_arena(arena);
 
   return node;
 }
 
-void tau_ast_expr_op_spec_free(tau_ast_expr_op_spec_t* node)
-{
-  tau_vector_free(node->params);
-  free(node);
-}
-
 void tau_ast_expr_op_spec_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_expr_op_spec_t* TAU_UNUSED(node))
 {
   TAU_UNREACHABLE();
@@ -8,16 +8,10 @@
 #include "ast/expr/op/un/ind.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_un_ind_t* tau_ast_expr_op_un_ind_init(void)
+tau_ast_expr_op_un_ind_t* tau_ast_expr_op_un_ind_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_un_ind_t* node = (tau_ast_expr_op_un_ind_t*)malloc(sizeof(tau_ast_expr_op_un_ind_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_UNARY;
+  tau_ast_expr_op_un_ind_t* node = (tau_ast_expr_op_un_ind_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_un_ind_t), TAU_AST_EXPR_OP_UNARY);
   node->op_kind = OP_IND;
 
   return node;
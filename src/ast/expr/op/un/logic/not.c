@@ -8,16 +8,10 @@
 #include "ast/expr/op/un/logic/not.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_un_logic_not_t* tau_ast_expr_op_un_logic_not_init(void)
+tau_ast_expr_op_un_logic_not_t* tau_ast_expr_op_un_logic_not_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_un_logic_not_t* node = (tau_ast_expr_op_un_logic_not_t*)malloc(sizeof(tau_ast_expr_op_un_logic_not_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_UNARY;
+  tau_ast_expr_op_un_logic_not_t* node = (tau_ast_expr_op_un_logic_not_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_un_logic_not_t), TAU_AST_EXPR_OP_UNARY);
   node->op_kind = OP_LOGIC_NOT;
 
   return node;
@@ -8,23 +8,10 @@
 #include "ast/expr/op/un/un.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_expr_op_un_t* tau_ast_expr_op_un_init(void)
+tau_ast_expr_op_un_t* tau_ast_expr_op_un_init(tau_arena_t* arena)
 {
-  tau_ast_expr_op_un_t* node = (tau_ast_expr_op_un_t*)malloc(sizeof(tau_ast_expr_op_un_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_EXPR_OP_UNARY;
-
-  return node;
-}
-
-void tau_ast_expr_op_un_free(tau_ast_expr_op_un_t* node)
-{
-  free(node);
+  return (tau_ast_expr_op_un_t*)tau_ast_node_init(arena, sizeof(tau_ast_expr_op_un_t), TAU_AST_EXPR_OP_UNARY);
 }
 
 void tau_ast_expr_op_un_nameres(tau_nameres_ctx_t* ctx, tau_ast_expr_op_un_t* node)
@@ -7,23 +7,9 @@
 
 #include "ast/id.h"
 
-#include "ast/registry.h"
-
-tau_ast_id_t* tau_ast_id_init(void)
-{
-  tau_ast_id_t* node = (tau_ast_id_t*)malloc(sizeof(tau_ast_id_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_ID;
-
-  return node;
-}
-
-void tau_ast_id_free(tau_ast_id_t* node)
+tau_ast_id_t* tau_ast_id_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_id_t*)tau_ast_node_init(arena, sizeof(tau_ast_id_t), TAU_AST_ID);
 }
 
 void tau_ast_id_dump_json(FILE* stream, tau_ast_id_t* node)
@@ -9,86 +9,30 @@
 
 #include "ast/ast.h"
 
-void tau_ast_node_free(tau_ast_node_t* node)
+/// The number of AST nodes created so far on the current thread.
+static TAU_THREAD_LOCAL uint32_t g_ast_node_count = 0;
+
+tau_ast_node_t* tau_ast_node_init(tau_arena_t* arena, size_t size, tau_ast_kind_t kind)
 {
-  TAU_ASSERT(node != NULL);
+  TAU_ASSERT(g_ast_node_count < UINT32_MAX);
 
-  switch (node->kind)
-  {
-  case TAU_AST_ID:                 tau_ast_id_free                ((tau_ast_id_t*                )node); break;
-  case TAU_AST_POISON:             tau_ast_poison_free            ((tau_ast_poison_t*            )node); break;
-  case TAU_AST_TYPE_ID:            tau_ast_type_id_free           ((tau_ast_type_id_t*           )node); break;
-  case TAU_AST_TYPE_MUT:           tau_ast_type_mut_free          ((tau_ast_type_mut_t*          )node); break;
-  case TAU_AST_TYPE_PTR:           tau_ast_type_ptr_free          ((tau_ast_type_ptr_t*          )node); break;
-  case TAU_AST_TYPE_ARRAY:         tau_ast_type_array_free        ((tau_ast_type_array_t*        )node); break;
-  case TAU_AST_TYPE_REF:           tau_ast_type_ref_free          ((tau_ast_type_ref_t*          )node); break;
-  case TAU_AST_TYPE_OPT:           tau_ast_type_opt_free          ((tau_ast_type_opt_t*          )node); break;
-  case TAU_AST_TYPE_FUN:           tau_ast_type_fun_free          ((tau_ast_type_fun_t*          )node); break;
-  case TAU_AST_TYPE_VEC:           tau_ast_type_vec_free          ((tau_ast_type_vec_t*          )node); break;
-  case TAU_AST_TYPE_MAT:           tau_ast_type_mat_free          ((tau_ast_type_mat_t*          )node); break;
-  case TAU_AST_TYPE_PRIM_I8:
-  case TAU_AST_TYPE_PRIM_I16:
-  case TAU_AST_TYPE_PRIM_I32:
-  case TAU_AST_TYPE_PRIM_I64:
-  case TAU_AST_TYPE_PRIM_ISIZE:
-  case TAU_AST_TYPE_PRIM_U8:
-  case TAU_AST_TYPE_PRIM_U16:
-  case TAU_AST_TYPE_PRIM_U32:
-  case TAU_AST_TYPE_PRIM_U64:
-  case TAU_AST_TYPE_PRIM_USIZE:
-  case TAU_AST_TYPE_PRIM_F32:
-  case TAU_AST_TYPE_PRIM_F64:
-  case TAU_AST_TYPE_PRIM_C64:
-  case TAU_AST_TYPE_PRIM_C128:
-  case TAU_AST_TYPE_PRIM_CHAR:
-  case TAU_AST_TYPE_PRIM_BOOL:
-  case TAU_AST_TYPE_PRIM_UNIT:     tau_ast_type_prim_free         ((tau_ast_type_prim_t*         )node); break;
-  case TAU_AST_TYPE_MEMBER:        tau_ast_type_mbr_free          ((tau_ast_type_mbr_t*          )node); break;
-  case TAU_AST_TYPE_TYPE:          tau_ast_type_type_free         ((tau_ast_type_type_t*         )node); break;
-  case TAU_AST_EXPR_ID:            tau_ast_expr_id_free           ((tau_ast_expr_id_t*           )node); break;
-  case TAU_AST_EXPR_LIT_INT:       tau_ast_expr_lit_int_free      ((tau_ast_expr_lit_int_t*      )node); break;
-  case TAU_AST_EXPR_LIT_FLT:       tau_ast_expr_lit_flt_free      ((tau_ast_expr_lit_flt_t*      )node); break;
-  case TAU_AST_EXPR_LIT_STR:       tau_ast_expr_lit_str_free      ((tau_ast_expr_lit_str_t*      )node); break;
-  case TAU_AST_EXPR_LIT_CHAR:      tau_ast_expr_lit_char_free     ((tau_ast_expr_lit_char_t*     )node); break;
-  case TAU_AST_EXPR_LIT_BOOL:      tau_ast_expr_lit_bool_free     ((tau_ast_expr_lit_bool_t*     )node); break;
-  case TAU_AST_EXPR_LIT_NULL:      tau_ast_expr_lit_null_free     ((tau_ast_expr_lit_null_t*     )node); break;
-  case TAU_AST_EXPR_LIT_VEC:       tau_ast_expr_lit_vec_free      ((tau_ast_expr_lit_vec_t*      )node); break;
-  case TAU_AST_EXPR_LIT_MAT:       tau_ast_expr_lit_mat_free      ((tau_ast_expr_lit_mat_t*      )node); break;
-  case TAU_AST_EXPR_OP_UNARY:      tau_ast_expr_op_un_free        ((tau_ast_expr_op_un_t*        )node); break;
-  case TAU_AST_EXPR_OP_BINARY:     tau_ast_expr_op_bin_free       ((tau_ast_expr_op_bin_t*       )node); break;
-  case TAU_AST_EXPR_OP_CALL:       tau_ast_expr_op_call_free      ((tau_ast_expr_op_call_t*      )node); break;
-  case TAU_AST_EXPR_OP_SPEC:       tau_ast_expr_op_spec_free      ((tau_ast_expr_op_spec_t*      )node); break;
-  case TAU_AST_STMT_IF:            tau_ast_stmt_if_free           ((tau_ast_stmt_if_t*           )node); break;
-  case TAU_AST_STMT_FOR:           tau_ast_stmt_for_free          ((tau_ast_stmt_for_t*          )node); break;
-  case TAU_AST_STMT_WHILE:         tau_ast_stmt_while_free        ((tau_ast_stmt_while_t*        )node); break;
-  case TAU_AST_STMT_DO_WHILE:      tau_ast_stmt_do_while_free     ((tau_ast_stmt_do_while_t*     )node); break;
-  case TAU_AST_STMT_LOOP:          tau_ast_stmt_loop_free         ((tau_ast_stmt_loop_t*         )node); break;
-  case TAU_AST_STMT_BREAK:         tau_ast_stmt_break_free        ((tau_ast_stmt_break_t*        )node); break;
-  case TAU_AST_STMT_CONTINUE:      tau_ast_stmt_continue_free     ((tau_ast_stmt_continue_t*     )node); break;
-  case TAU_AST_STMT_RETURN:        tau_ast_stmt_return_free       ((tau_ast_stmt_return_t*       )node); break;
-  case TAU_AST_STMT_DEFER:         tau_ast_stmt_defer_free        ((tau_ast_stmt_defer_t*        )node); break;
-  case TAU_AST_STMT_BLOCK:         tau_ast_stmt_block_free        ((tau_ast_stmt_block_t*        )node); break;
-  case TAU_AST_STMT_EXPR:          tau_ast_stmt_expr_free         ((tau_ast_stmt_expr_t*         )node); break;
-  case TAU_AST_DECL_VAR:           tau_ast_decl_var_free          ((tau_ast_decl_var_t*          )node); break;
-  case TAU_AST_DECL_PARAM:         tau_ast_decl_param_free        ((tau_ast_decl_param_t*        )node); break;
-  case TAU_AST_DECL_FUN:           tau_ast_decl_fun_free          ((tau_ast_decl_fun_t*          )node); break;
-  case TAU_AST_DECL_STRUCT:        tau_ast_decl_struct_free       ((tau_ast_decl_struct_t*       )node); break;
-  case TAU_AST_DECL_UNION:         tau_ast_decl_union_free        ((tau_ast_decl_union_t*        )node); break;
-  case TAU_AST_DECL_ENUM:          tau_ast_decl_enum_free         ((tau_ast_decl_enum_t*         )node); break;
-  case TAU_AST_DECL_ENUM_CONSTANT: tau_ast_decl_enum_constant_free((tau_ast_decl_enum_constant_t*)node); break;
-  case TAU_AST_DECL_MOD:           tau_ast_decl_mod_free          ((tau_ast_decl_mod_t*          )node); break;
-  case TAU_AST_DECL_TYPE_ALIAS:    tau_ast_decl_type_alias_free   ((tau_ast_decl_type_alias_t*   )node); break;
-  case TAU_AST_DECL_GENERIC_FUN:   tau_ast_decl_generic_fun_free  ((tau_ast_decl_generic_fun_t*  )node); break;
-  case TAU_AST_DECL_GENERIC_PARAM: tau_ast_decl_generic_param_free((tau_ast_decl_generic_param_t*)node); break;
-  case TAU_AST_PATH_SEGMENT:       tau_ast_path_segment_free      ((tau_ast_path_segment_t*      )node); break;
-  case TAU_AST_PATH_ACCESS:        tau_ast_path_access_free       ((tau_ast_path_access_t*       )node); break;
-  case TAU_AST_PATH_LIST:          tau_ast_path_list_free         ((tau_ast_path_list_t*         )node); break;
-  case TAU_AST_PATH_WILDCARD:      tau_ast_path_wildcard_free     ((tau_ast_path_wildcard_t*     )node); break;
-  case TAU_AST_PATH_ALIAS:         tau_ast_path_alias_free        ((tau_ast_path_alias_t*        )node); break;
-  case TAU_AST_USE:                tau_ast_use_free               ((tau_ast_use_t*               )node); break;
-  case TAU_AST_PROG:               tau_ast_prog_free              ((tau_ast_prog_t*              )node); break;
-  default: TAU_UNREACHABLE();
-  }
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_arena_alloc(arena, size);
+  memset(node, 0, size);
+
+  node->kind = kind;
+  node->uid = g_ast_node_count++;
+
+  return node;
+}
+
+size_t tau_ast_node_count(void)
+{
+  return (size_t)g_ast_node_count;
+}
+
+void tau_ast_node_reset_count(void)
+{
+  g_ast_node_count = 0;
 }
 
 void tau_ast_node_nameres(tau_nameres_ctx_t* ctx, tau_ast_node_t* node)
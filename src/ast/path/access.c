@@ -7,23 +7,9 @@
 
 #include "ast/path/access.h"
 
-#include "ast/registry.h"
-
-tau_ast_path_access_t* tau_ast_path_access_init(void)
-{
-  tau_ast_path_access_t* node = (tau_ast_path_access_t*)malloc(sizeof(tau_ast_path_access_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_PATH_ACCESS;
-
-  return node;
-}
-
-void tau_ast_path_access_free(tau_ast_path_access_t* node)
+tau_ast_path_access_t* tau_ast_path_access_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_path_access_t*)tau_ast_node_init(arena, sizeof(tau_ast_path_access_t), TAU_AST_PATH_ACCESS);
 }
 
 void tau_ast_path_access_dump_json(FILE* stream, tau_ast_path_access_t* node)
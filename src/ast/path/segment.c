@@ -7,23 +7,9 @@
 
 #include "ast/path/segment.h"
 
-#include "ast/registry.h"
-
-tau_ast_path_segment_t* tau_ast_path_segment_init(void)
-{
-  tau_ast_path_segment_t* node = (tau_ast_path_segment_t*)malloc(sizeof(tau_ast_path_segment_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_PATH_SEGMENT;
-
-  return node;
-}
-
-void tau_ast_path_segment_free(tau_ast_path_segment_t* node)
+tau_ast_path_segment_t* tau_ast_path_segment_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_path_segment_t*)tau_ast_node_init(arena, sizeof(tau_ast_path_segment_t), TAU_AST_PATH_SEGMENT);
 }
 
 void tau_ast_path_segment_dump_json(FILE* stream, tau_ast_path_segment_t* node)
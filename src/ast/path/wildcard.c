@@ -7,23 +7,9 @@
 
 #include "ast/path/wildcard.h"
 
-#include "ast/registry.h"
-
-tau_ast_path_wildcard_t* tau_ast_path_wildcard_init(void)
-{
-  tau_ast_path_wildcard_t* node = (tau_ast_path_wildcard_t*)malloc(sizeof(tau_ast_path_wildcard_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_PATH_WILDCARD;
-
-  return node;
-}
-
-void tau_ast_path_wildcard_free(tau_ast_path_wildcard_t* node)
+tau_ast_path_wildcard_t* tau_ast_path_wildcard_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_path_wildcard_t*)tau_ast_node_init(arena, sizeof(tau_ast_path_wildcard_t), TAU_AST_PATH_WILDCARD);
 }
 
 void tau_ast_path_wildcard_dump_json(FILE* stream, tau_ast_path_wildcard_t* node)
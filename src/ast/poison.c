@@ -7,23 +7,9 @@
 
 #include "ast/poison.h"
 
-#include "ast/registry.h"
-
-tau_ast_poison_t* tau_ast_poison_init(void)
-{
-  tau_ast_poison_t* node = (tau_ast_poison_t*)malloc(sizeof(tau_ast_poison_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_POISON;
-
-  return node;
-}
-
-void tau_ast_poison_free(tau_ast_poison_t* node)
+tau_ast_poison_t* tau_ast_poison_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_poison_t*)tau_ast_node_init(arena, sizeof(tau_ast_poison_t), TAU_AST_POISON);
 }
 
 void tau_ast_poison_dump_json(FILE* stream, tau_ast_poison_t* node)
@@ -7,53 +7,108 @@
 
 #include "ast/prog.h"
 
-#include "ast/registry.h"
+#include "ast/decl/decl.h"
+#include "utils/trace.h"
 
-tau_ast_prog_t* tau_ast_prog_init(void)
+/**
+ * \brief Begins the time trace span of a stage processing a top-level
+ * declaration, detailed with the name of the declaration.
+ */
+static void tau_ast_prog_trace_begin(const char* stage, tau_ast_node_t* node)
 {
-  tau_ast_prog_t* node = (tau_ast_prog_t*)malloc(sizeof(tau_ast_prog_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
+  if (!tau_ast_is_decl(node))
+  {
+    tau_trace_begin(stage);
+    return;
+  }
 
-  node->kind = TAU_AST_PROG;
-  node->decls = tau_vector_init();
+  tau_string_view_t name = tau_token_to_string_view(((tau_ast_decl_t*)node)->id->tok);
 
-  return node;
+  tau_trace_begin_with_detail(stage, tau_string_view_begin(name), tau_string_view_length(name));
 }
 
-void tau_ast_prog_free(tau_ast_prog_t* node)
+tau_ast_prog_t* tau_ast_prog_init(tau_arena_t* arena)
 {
-  tau_vector_free(node->decls);
-  free(node);
+  tau_ast_prog_t* node = (tau_ast_prog_t*)tau_ast_node_init(arena, sizeof(tau_ast_prog_t), TAU_AST_PROG);
+  node->decls = tau_vector_init_with_arena(arena);
+
+  return node;
 }
 
 void tau_ast_prog_nameres(tau_nameres_ctx_t* ctx, tau_ast_prog_t* node)
 {
-  node->scope = tau_nameres_ctx_scope_begin(ctx);
+  tau_nameres_ctx_scope_begin(ctx);
+
+  bool is_traced = tau_trace_is_enabled();
 
   TAU_VECTOR_FOR_LOOP(i, node->decls)
-    tau_ast_node_nameres(ctx, (tau_ast_node_t*)tau_vector_get(node->decls, i));
+  {
+    tau_ast_node_t* decl = (tau_ast_node_t*)tau_vector_get(node->decls, i);
+
+    if (is_traced)
+      tau_ast_prog_trace_begin("nameres", decl);
+
+    tau_ast_node_nameres(ctx, decl);
+
+    if (is_traced)
+      tau_trace_end();
+  }
 
   tau_nameres_ctx_scope_end(ctx);
 }
 
 void tau_ast_prog_typecheck(tau_typecheck_ctx_t* ctx, tau_ast_prog_t* node)
 {
+  bool is_traced = tau_trace_is_enabled();
+
   TAU_VECTOR_FOR_LOOP(i, node->decls)
-    tau_ast_node_typecheck(ctx, (tau_ast_node_t*)tau_vector_get(node->decls, i));
+  {
+    tau_ast_node_t* decl = (tau_ast_node_t*)tau_vector_get(node->decls, i);
+
+    if (is_traced)
+      tau_ast_prog_trace_begin("typecheck", decl);
+
+    tau_ast_node_typecheck(ctx, decl);
+
+    if (is_traced)
+      tau_trace_end();
+  }
 }
 
 void tau_ast_prog_ctrlflow(tau_ctrlflow_ctx_t* ctx, tau_ast_prog_t* node)
 {
+  bool is_traced = tau_trace_is_enabled();
+
   TAU_VECTOR_FOR_LOOP(i, node->decls)
-    tau_ast_node_ctrlflow(ctx, (tau_ast_node_t*)tau_vector_get(node->decls, i));
+  {
+    tau_ast_node_t* decl = (tau_ast_node_t*)tau_vector_get(node->decls, i);
+
+    if (is_traced)
+      tau_ast_prog_trace_begin("ctrlflow", decl);
+
+    tau_ast_node_ctrlflow(ctx, decl);
+
+    if (is_traced)
+      tau_trace_end();
+  }
 }
 
 void tau_ast_prog_codegen(tau_codegen_ctx_t* ctx, tau_ast_prog_t* node)
 {
+  bool is_traced = tau_trace_is_enabled();
+
   TAU_VECTOR_FOR_LOOP(i, node->decls)
-    tau_ast_node_codegen(ctx, (tau_ast_node_t*)tau_vector_get(node->decls, i));
+  {
+    tau_ast_node_t* decl = (tau_ast_node_t*)tau_vector_get(node->decls, i);
+
+    if (is_traced)
+      tau_ast_prog_trace_begin("codegen", decl);
+
+    tau_ast_node_codegen(ctx, decl);
+
+    if (is_traced)
+      tau_trace_end();
+  }
 }
 
 void tau_ast_prog_dump_json(FILE* stream, tau_ast_prog_t* node)
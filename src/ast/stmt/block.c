@@ -7,30 +7,17 @@
 
 #include "ast/stmt/block.h"
 
-#include "ast/registry.h"
-
-tau_ast_stmt_block_t* tau_ast_stmt_block_init(void)
+tau_ast_stmt_block_t* tau_ast_stmt_block_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_block_t* node = (tau_ast_stmt_block_t*)malloc(sizeof(tau_ast_stmt_block_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_BLOCK;
-  node->stmts = tau_vector_init();
+  tau_ast_stmt_block_t* node = (tau_ast_stmt_block_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_block_t), TAU_AST_STMT_BLOCK);
+  node->stmts = tau_vector_init_with_arena(arena);
 
   return node;
 }
 
-void tau_ast_stmt_block_free(tau_ast_stmt_block_t* node)
-{
-  tau_vector_free(node->stmts);
-  free(node);
-}
-
 void tau_ast_stmt_block_nameres(tau_nameres_ctx_t* ctx, tau_ast_stmt_block_t* node)
 {
-  node->scope = tau_nameres_ctx_scope_begin(ctx);
+  tau_nameres_ctx_scope_begin(ctx);
 
   TAU_VECTOR_FOR_LOOP(i, node->stmts)
   {
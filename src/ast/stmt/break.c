@@ -8,23 +8,10 @@
 #include "ast/stmt/break.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_stmt_break_t* tau_ast_stmt_break_init(void)
+tau_ast_stmt_break_t* tau_ast_stmt_break_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_break_t* node = (tau_ast_stmt_break_t*)malloc(sizeof(tau_ast_stmt_break_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_BREAK;
-
-  return node;
-}
-
-void tau_ast_stmt_break_free(tau_ast_stmt_break_t* node)
-{
-  free(node);
+  return (tau_ast_stmt_break_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_break_t), TAU_AST_STMT_BREAK);
 }
 
 void tau_ast_stmt_break_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_stmt_break_t* TAU_UNUSED(node))
@@ -8,23 +8,10 @@
 #include "ast/stmt/continue.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_stmt_continue_t* tau_ast_stmt_continue_init(void)
+tau_ast_stmt_continue_t* tau_ast_stmt_continue_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_continue_t* node = (tau_ast_stmt_continue_t*)malloc(sizeof(tau_ast_stmt_continue_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_CONTINUE;
-
-  return node;
-}
-
-void tau_ast_stmt_continue_free(tau_ast_stmt_continue_t* node)
-{
-  free(node);
+  return (tau_ast_stmt_continue_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_continue_t), TAU_AST_STMT_CONTINUE);
 }
 
 void tau_ast_stmt_continue_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_stmt_continue_t* TAU_UNUSED(node))
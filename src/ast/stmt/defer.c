@@ -7,23 +7,9 @@
 
 #include "ast/stmt/defer.h"
 
-#include "ast/registry.h"
-
-tau_ast_stmt_defer_t* tau_ast_stmt_defer_init(void)
-{
-  tau_ast_stmt_defer_t* node = (tau_ast_stmt_defer_t*)malloc(sizeof(tau_ast_stmt_defer_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_DEFER;
-
-  return node;
-}
-
-void tau_ast_stmt_defer_free(tau_ast_stmt_defer_t* node)
+tau_ast_stmt_defer_t* tau_ast_stmt_defer_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_stmt_defer_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_defer_t), TAU_AST_STMT_DEFER);
 }
 
 void tau_ast_stmt_defer_nameres(tau_nameres_ctx_t* ctx, tau_ast_stmt_defer_t* node)
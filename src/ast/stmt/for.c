@@ -7,23 +7,9 @@
 
 #include "ast/stmt/for.h"
 
-#include "ast/registry.h"
-
-tau_ast_stmt_for_t* tau_ast_stmt_for_init(void)
-{
-  tau_ast_stmt_for_t* node = (tau_ast_stmt_for_t*)malloc(sizeof(tau_ast_stmt_for_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_FOR;
-
-  return node;
-}
-
-void tau_ast_stmt_for_free(tau_ast_stmt_for_t* node)
+tau_ast_stmt_for_t* tau_ast_stmt_for_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_stmt_for_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_for_t), TAU_AST_STMT_FOR);
 }
 
 void tau_ast_stmt_for_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_stmt_for_t* TAU_UNUSED(node))
@@ -8,28 +8,15 @@
 #include "ast/stmt/if.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_stmt_if_t* tau_ast_stmt_if_init(void)
+tau_ast_stmt_if_t* tau_ast_stmt_if_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_if_t* node = (tau_ast_stmt_if_t*)malloc(sizeof(tau_ast_stmt_if_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_IF;
-
-  return node;
-}
-
-void tau_ast_stmt_if_free(tau_ast_stmt_if_t* node)
-{
-  free(node);
+  return (tau_ast_stmt_if_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_if_t), TAU_AST_STMT_IF);
 }
 
 void tau_ast_stmt_if_nameres(tau_nameres_ctx_t* ctx, tau_ast_stmt_if_t* node)
 {
-  node->scope = tau_nameres_ctx_scope_begin(ctx);
+  tau_nameres_ctx_scope_begin(ctx);
 
   tau_ast_node_nameres(ctx, node->cond);
   tau_ast_node_nameres(ctx, node->stmt);
@@ -8,28 +8,15 @@
 #include "ast/stmt/loop.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_stmt_loop_t* tau_ast_stmt_loop_init(void)
+tau_ast_stmt_loop_t* tau_ast_stmt_loop_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_loop_t* node = (tau_ast_stmt_loop_t*)malloc(sizeof(tau_ast_stmt_loop_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_LOOP;
-
-  return node;
-}
-
-void tau_ast_stmt_loop_free(tau_ast_stmt_loop_t* node)
-{
-  free(node);
+  return (tau_ast_stmt_loop_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_loop_t), TAU_AST_STMT_LOOP);
 }
 
 void tau_ast_stmt_loop_nameres(tau_nameres_ctx_t* ctx, tau_ast_stmt_loop_t* node)
 {
-  node->scope = tau_nameres_ctx_scope_begin(ctx);
+  tau_nameres_ctx_scope_begin(ctx);
 
   tau_ast_node_nameres(ctx, node->stmt);
 
@@ -8,23 +8,10 @@
 #include "ast/stmt/return.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_stmt_return_t* tau_ast_stmt_return_init(void)
+tau_ast_stmt_return_t* tau_ast_stmt_return_init(tau_arena_t* arena)
 {
-  tau_ast_stmt_return_t* node = (tau_ast_stmt_return_t*)malloc(sizeof(tau_ast_stmt_return_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_STMT_RETURN;
-
-  return node;
-}
-
-void tau_ast_stmt_return_free(tau_ast_stmt_return_t* node)
-{
-  free(node);
+  return (tau_ast_stmt_return_t*)tau_ast_node_init(arena, sizeof(tau_ast_stmt_return_t), TAU_AST_STMT_RETURN);
 }
 
 void tau_ast_stmt_return_nameres(tau_nameres_ctx_t* ctx, tau_ast_stmt_return_t* node)
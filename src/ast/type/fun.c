@@ -7,27 +7,14 @@
 
 #include "ast/type/fun.h"
 
-#include "ast/registry.h"
-
-tau_ast_type_fun_t* tau_ast_type_fun_init(void)
+tau_ast_type_fun_t* tau_ast_type_fun_init(tau_arena_t* arena)
 {
-  tau_ast_type_fun_t* node = (tau_ast_type_fun_t*)malloc(sizeof(tau_ast_type_fun_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_FUN;
-  node->params = tau_vector_init();
+  tau_ast_type_fun_t* node = (tau_ast_type_fun_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_fun_t), TAU_AST_TYPE_FUN);
+  node->params = tau_vector_init_with_arena(arena);
 
   return node;
 }
 
-void tau_ast_type_fun_free(tau_ast_type_fun_t* node)
-{
-  tau_vector_free(node->params);
-  free(node);
-}
-
 void tau_ast_type_fun_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_fun_t* node)
 {
   TAU_VECTOR_FOR_LOOP(i, node->params)
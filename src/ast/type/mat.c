@@ -7,23 +7,9 @@
 
 #include "ast/type/mat.h"
 
-#include "ast/registry.h"
-
-tau_ast_type_mat_t* tau_ast_type_mat_init(void)
-{
-  tau_ast_type_mat_t* node = (tau_ast_type_mat_t*)malloc(sizeof(tau_ast_type_mat_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_MAT;
-
-  return node;
-}
-
-void tau_ast_type_mat_free(tau_ast_type_mat_t* node)
+tau_ast_type_mat_t* tau_ast_type_mat_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_type_mat_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_mat_t), TAU_AST_TYPE_MAT);
 }
 
 void tau_ast_type_mat_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_type_mat_t* TAU_UNUSED(node))
@@ -8,23 +8,10 @@
 #include "ast/type/mbr.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_type_mbr_t* tau_ast_type_mbr_init(void)
+tau_ast_type_mbr_t* tau_ast_type_mbr_init(tau_arena_t* arena)
 {
-  tau_ast_type_mbr_t* node = (tau_ast_type_mbr_t*)malloc(sizeof(tau_ast_type_mbr_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_MEMBER;
-
-  return node;
-}
-
-void tau_ast_type_mbr_free(tau_ast_type_mbr_t* node)
-{
-  free(node);
+  return (tau_ast_type_mbr_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_mbr_t), TAU_AST_TYPE_MEMBER);
 }
 
 void tau_ast_type_mbr_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_mbr_t* node)
@@ -45,8 +32,7 @@ void tau_ast_type_mbr_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_mbr_t* node)
 
   tau_ast_type_id_t* member_node = (tau_ast_type_id_t*)node->member;
 
-  tau_string_view_t id_view = tau_token_to_string_view(member_node->tok);
-  tau_symbol_t* mbr_sym = tau_symtable_get_with_str_view(mod_node->scope, id_view);
+  tau_symbol_t* mbr_sym = tau_symtable_get(mod_node->scope, member_node->tok->id);
 
   if (mbr_sym == NULL)
   {
@@ -8,23 +8,10 @@
 #include "ast/type/modif/array.h"
 
 #include "ast/ast.h"
-#include "ast/registry.h"
 
-tau_ast_type_array_t* tau_ast_type_array_init(void)
+tau_ast_type_array_t* tau_ast_type_array_init(tau_arena_t* arena)
 {
-  tau_ast_type_array_t* node = (tau_ast_type_array_t*)malloc(sizeof(tau_ast_type_array_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_ARRAY;
-
-  return node;
-}
-
-void tau_ast_type_array_free(tau_ast_type_array_t* node)
-{
-  free(node);
+  return (tau_ast_type_array_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_array_t), TAU_AST_TYPE_ARRAY);
 }
 
 void tau_ast_type_array_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_array_t* node)
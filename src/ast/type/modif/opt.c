@@ -7,23 +7,9 @@
 
 #include "ast/type/modif/opt.h"
 
-#include "ast/registry.h"
-
-tau_ast_type_opt_t* tau_ast_type_opt_init(void)
-{
-  tau_ast_type_opt_t* node = (tau_ast_type_opt_t*)malloc(sizeof(tau_ast_type_opt_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_OPT;
-
-  return node;
-}
-
-void tau_ast_type_opt_free(tau_ast_type_opt_t* node)
+tau_ast_type_opt_t* tau_ast_type_opt_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_type_opt_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_opt_t), TAU_AST_TYPE_OPT);
 }
 
 void tau_ast_type_opt_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_opt_t* node)
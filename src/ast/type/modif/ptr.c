@@ -7,23 +7,9 @@
 
 #include "ast/type/modif/ptr.h"
 
-#include "ast/registry.h"
-
-tau_ast_type_ptr_t* tau_ast_type_ptr_init(void)
-{
-  tau_ast_type_ptr_t* node = (tau_ast_type_ptr_t*)malloc(sizeof(tau_ast_type_ptr_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_PTR;
-
-  return node;
-}
-
-void tau_ast_type_ptr_free(tau_ast_type_ptr_t* node)
+tau_ast_type_ptr_t* tau_ast_type_ptr_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_type_ptr_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_ptr_t), TAU_AST_TYPE_PTR);
 }
 
 void tau_ast_type_ptr_nameres(tau_nameres_ctx_t* ctx, tau_ast_type_ptr_t* node)
@@ -7,108 +7,94 @@
 
 #include "ast/type/prim.h"
 
-#include "ast/registry.h"
-
-static tau_ast_type_prim_t* tau_ast_type_prim_init(tau_ast_kind_t kind)
-{
-  tau_ast_type_prim_t* node = (tau_ast_type_prim_t*)malloc(sizeof(tau_ast_type_prim_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = kind;
-
-  return node;
-}
-
-tau_ast_type_prim_t* tau_ast_type_prim_i8_init(void)
+static tau_ast_type_prim_t* tau_ast_type_prim_init(tau_arena_t* arena, tau_ast_kind_t kind)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_I8);
+  return (tau_ast_type_prim_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_prim_t), kind);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_i16_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_i8_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_I16);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_I8);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_i32_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_i16_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_I32);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_I16);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_i64_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_i32_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_I64);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_I32);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_isize_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_i64_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_ISIZE);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_I64);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_u8_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_isize_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_U8);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_ISIZE);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_u16_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_u8_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_U16);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_U8);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_u32_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_u16_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_U32);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_U16);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_u64_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_u32_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_U64);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_U32);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_usize_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_u64_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_USIZE);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_U64);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_f32_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_usize_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_F32);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_USIZE);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_f64_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_f32_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_F64);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_F32);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_c64_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_f64_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_C64);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_F64);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_c128_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_c64_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_C128);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_C64);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_char_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_c128_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_CHAR);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_C128);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_bool_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_char_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_BOOL);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_CHAR);
 }
 
-tau_ast_type_prim_t* tau_ast_type_prim_unit_init(void)
+tau_ast_type_prim_t* tau_ast_type_prim_bool_init(tau_arena_t* arena)
 {
-  return tau_ast_type_prim_init(TAU_AST_TYPE_PRIM_UNIT);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_BOOL);
 }
 
-void tau_ast_type_prim_free(tau_ast_type_prim_t* node)
+tau_ast_type_prim_t* tau_ast_type_prim_unit_init(tau_arena_t* arena)
 {
-  free(node);
+  return tau_ast_type_prim_init(arena, TAU_AST_TYPE_PRIM_UNIT);
 }
 
 void tau_ast_type_prim_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_type_prim_t* TAU_UNUSED(node))
@@ -7,23 +7,9 @@
 
 #include "ast/type/vec.h"
 
-#include "ast/registry.h"
-
-tau_ast_type_vec_t* tau_ast_type_vec_init(void)
-{
-  tau_ast_type_vec_t* node = (tau_ast_type_vec_t*)malloc(sizeof(tau_ast_type_vec_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_TYPE_VEC;
-
-  return node;
-}
-
-void tau_ast_type_vec_free(tau_ast_type_vec_t* node)
+tau_ast_type_vec_t* tau_ast_type_vec_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_type_vec_t*)tau_ast_node_init(arena, sizeof(tau_ast_type_vec_t), TAU_AST_TYPE_VEC);
 }
 
 void tau_ast_type_vec_nameres(tau_nameres_ctx_t* TAU_UNUSED(ctx), tau_ast_type_vec_t* TAU_UNUSED(node))
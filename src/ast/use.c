@@ -7,23 +7,9 @@
 
 #include "ast/use.h"
 
-#include "ast/registry.h"
-
-tau_ast_use_t* tau_ast_use_init(void)
-{
-  tau_ast_use_t* node = (tau_ast_use_t*)malloc(sizeof(tau_ast_use_t));
-  TAU_CLEAROBJ(node);
-
-  tau_ast_registry_register((tau_ast_node_t*)node);
-
-  node->kind = TAU_AST_USE;
-
-  return node;
-}
-
-void tau_ast_use_free(tau_ast_use_t* node)
+tau_ast_use_t* tau_ast_use_init(tau_arena_t* arena)
 {
-  free(node);
+  return (tau_ast_use_t*)tau_ast_node_init(arena, sizeof(tau_ast_use_t), TAU_AST_USE);
 }
 
 void tau_ast_use_dump_json(FILE* stream, tau_ast_use_t* node)
@@ -0,0 +1,578 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "compiler/cache.h"
+
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+#include "utils/hash.h"
+#include "utils/concurrency/mutex.h"
+#include "utils/io/file.h"
+
+/// Magic bytes at the beginning of every cache entry.
+#define CACHE_MAGIC "TAUCACHE"
+
+/// Version of the cache entry format.
+#define CACHE_VERSION 1
+
+/// Extension of cache entries.
+#define CACHE_ENTRY_EXTENSION ".tcache"
+
+/// Name of the file holding the accumulated statistics.
+#define CACHE_STATS_FILENAME "stats"
+
+/// Size of buffers holding file names generated by the cache.
+#define CACHE_NAME_BUFFER_SIZE 64
+
+struct tau_cache_t
+{
+  tau_path_t* dir; // Path to the cache directory.
+  size_t max_size; // Size limit of the cache in bytes.
+  tau_mutex_t mutex; // Mutex guarding the statistics.
+  tau_cache_stats_t stats; // Statistics since initialization.
+  tau_cache_stats_t prev_stats; // Statistics accumulated before initialization.
+};
+
+/**
+ * \brief Represents a cursor into the contents of a cache entry.
+ */
+typedef struct tau_cache_reader_t
+{
+  const char* data; // Pointer to the contents of the entry.
+  size_t size; // Size of the entry in bytes.
+  size_t pos; // Offset of the next byte to be read.
+  bool is_failed; // Whether a read went past the end of the entry.
+} tau_cache_reader_t;
+
+/**
+ * \brief Represents an entry found while trimming the cache.
+ */
+typedef struct tau_cache_entry_t
+{
+  tau_path_t* path; // Path to the entry.
+  size_t size; // Size of the entry in bytes.
+  uint64_t time; // Time the entry was last used.
+} tau_cache_entry_t;
+
+static const void* tau_cache_read(tau_cache_reader_t* reader, size_t size)
+{
+  if (reader->is_failed || size > reader->size - reader->pos)
+  {
+    reader->is_failed = true;
+    return NULL;
+  }
+
+  const void* data = reader->data + reader->pos;
+  reader->pos += size;
+
+  return data;
+}
+
+static uint64_t tau_cache_read_u64(tau_cache_reader_t* reader)
+{
+  const void* data = tau_cache_read(reader, sizeof(uint64_t));
+
+  uint64_t value = 0;
+
+  if (data != NULL)
+    memcpy(&value, data, sizeof(uint64_t));
+
+  return value;
+}
+
+static void tau_cache_write_u64(FILE* stream, uint64_t value)
+{
+  fwrite(&value, sizeof(uint64_t), 1, stream);
+}
+
+/**
+ * \brief Opens a uniquely named temporary file next to a path for writing.
+ *
+ * \param[in] path Pointer to the path the file will be renamed to.
+ * \param[out] temp_path Pointer to the path of the temporary file, to be freed
+ * by the caller.
+ * \returns The opened stream or `NULL` on error.
+ */
+static FILE* tau_cache_open_temp(tau_path_t* path, tau_path_t** temp_path)
+{
+  char suffix[CACHE_NAME_BUFFER_SIZE];
+
+  // Threads use different stacks and processes differ in their clocks and
+  // address space layouts, which makes collisions unlikely. Exclusive creation
+  // catches the rest.
+  uint64_t nonce = tau_hash_combine_with_hash((uint64_t)time(NULL), (uint64_t)(uintptr_t)suffix);
+  nonce = tau_hash_combine_with_hash(nonce, (uint64_t)clock());
+
+  snprintf(suffix, sizeof(suffix), ".%016" PRIx64 ".tmp", nonce);
+
+  *temp_path = tau_path_copy(path);
+  tau_path_append_cstr(*temp_path, suffix);
+
+  tau_string_t* temp_path_str = tau_path_to_string(*temp_path);
+
+  FILE* stream = fopen(tau_string_begin(temp_path_str), "wbx");
+
+  tau_string_free(temp_path_str);
+
+  if (stream == NULL)
+  {
+    tau_path_free(*temp_path);
+    *temp_path = NULL;
+  }
+
+  return stream;
+}
+
+/**
+ * \brief Closes a temporary file and renames it to its final path, or removes
+ * it if anything failed.
+ *
+ * \param[in] stream The stream of the temporary file.
+ * \param[in] temp_path Pointer to the path of the temporary file, which is
+ * freed.
+ * \param[in] path Pointer to the final path.
+ * \returns `true` if the file was renamed, `false` otherwise.
+ */
+static bool tau_cache_commit_temp(FILE* stream, tau_path_t* temp_path, tau_path_t* path)
+{
+  bool is_written = !ferror(stream);
+  is_written = fclose(stream) == 0 && is_written;
+  is_written = is_written && tau_file_rename(temp_path, path);
+
+  if (!is_written)
+    tau_file_remove(temp_path);
+
+  tau_path_free(temp_path);
+
+  return is_written;
+}
+
+static tau_path_t* tau_cache_entry_path(tau_cache_t* cache, const char* config, const char* src, size_t src_size)
+{
+  uint64_t key = tau_hash_combine_with_hash(tau_hash_digest(config, strlen(config)), tau_hash_digest(src, src_size));
+
+  char filename[CACHE_NAME_BUFFER_SIZE];
+  snprintf(filename, sizeof(filename), "%016" PRIx64 CACHE_ENTRY_EXTENSION, key);
+
+  return tau_path_join_cstr(cache->dir, filename);
+}
+
+/**
+ * \brief Reads the header of a cache entry, checks that it belongs to an
+ * input file and retrieves the number of outputs it contains.
+ */
+static bool tau_cache_read_header(tau_cache_reader_t* reader, const char* config, size_t src_size, size_t* file_count)
+{
+  const void* magic = tau_cache_read(reader, sizeof(CACHE_MAGIC) - 1);
+
+  if (magic == NULL || memcmp(magic, CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1) != 0)
+    return false;
+
+  if (tau_cache_read_u64(reader) != CACHE_VERSION)
+    return false;
+
+  // Keys are hashes, so the configuration and input size are compared too.
+  size_t config_len = (size_t)tau_cache_read_u64(reader);
+  const void* entry_config = tau_cache_read(reader, config_len);
+
+  if (entry_config == NULL || config_len != strlen(config) || memcmp(entry_config, config, config_len) != 0)
+    return false;
+
+  if (tau_cache_read_u64(reader) != src_size)
+    return false;
+
+  *file_count = (size_t)tau_cache_read_u64(reader);
+
+  return !reader->is_failed;
+}
+
+/**
+ * \brief Reads the next output of a cache entry and checks that its extension
+ * is one of the requested ones.
+ */
+static const char* tau_cache_read_file(tau_cache_reader_t* reader, tau_vector_t* extensions, const char** ext, size_t* size)
+{
+  size_t ext_len = (size_t)tau_cache_read_u64(reader);
+  const void* entry_ext = tau_cache_read(reader, ext_len);
+
+  if (entry_ext == NULL)
+    return NULL;
+
+  *ext = NULL;
+
+  TAU_VECTOR_FOR_LOOP(i, extensions)
+  {
+    const char* requested_ext = (const char*)tau_vector_get(extensions, i);
+
+    if (ext_len == strlen(requested_ext) && memcmp(entry_ext, requested_ext, ext_len) == 0)
+    {
+      *ext = requested_ext;
+      break;
+    }
+  }
+
+  if (*ext == NULL)
+    return NULL;
+
+  *size = (size_t)tau_cache_read_u64(reader);
+
+  return (const char*)tau_cache_read(reader, *size);
+}
+
+static bool tau_cache_write_output(tau_path_t* path, const char* ext, const char* data, size_t size)
+{
+  tau_path_t* output_path = tau_path_replace_extension(path, ext);
+  tau_path_t* temp_path = NULL;
+
+  FILE* stream = tau_cache_open_temp(output_path, &temp_path);
+
+  bool is_written = false;
+
+  if (stream != NULL)
+  {
+    fwrite(data, 1, size, stream);
+    is_written = tau_cache_commit_temp(stream, temp_path, output_path);
+  }
+
+  tau_path_free(output_path);
+
+  return is_written;
+}
+
+static bool tau_cache_restore_view(tau_file_view_t* view, const char* config, size_t src_size, tau_path_t* path, tau_vector_t* extensions)
+{
+  tau_cache_reader_t reader = {
+    .data = tau_file_view_data(view),
+    .size = tau_file_view_size(view),
+    .pos = 0,
+    .is_failed = false
+  };
+
+  size_t file_count = 0;
+
+  if (!tau_cache_read_header(&reader, config, src_size, &file_count) || file_count > tau_vector_size(extensions))
+    return false;
+
+  size_t files_pos = reader.pos;
+
+  // The whole entry is validated before any output is written.
+  for (size_t i = 0; i < file_count; i++)
+  {
+    const char* ext = NULL;
+    size_t size = 0;
+
+    if (tau_cache_read_file(&reader, extensions, &ext, &size) == NULL)
+      return false;
+  }
+
+  reader.pos = files_pos;
+
+  for (size_t i = 0; i < file_count; i++)
+  {
+    const char* ext = NULL;
+    size_t size = 0;
+    const char* data = tau_cache_read_file(&reader, extensions, &ext, &size);
+
+    if (!tau_cache_write_output(path, ext, data, size))
+      return false;
+  }
+
+  return true;
+}
+
+static tau_path_t* tau_cache_stats_path(tau_cache_t* cache)
+{
+  return tau_path_join_cstr(cache->dir, CACHE_STATS_FILENAME);
+}
+
+static void tau_cache_load_stats(tau_cache_t* cache)
+{
+  tau_path_t* stats_path = tau_cache_stats_path(cache);
+  tau_string_t* stats_path_str = tau_path_to_string(stats_path);
+
+  FILE* stream = fopen(tau_string_begin(stats_path_str), "r");
+
+  if (stream != NULL)
+  {
+    tau_cache_stats_t* stats = &cache->prev_stats;
+
+    if (fscanf(stream, "%zu %zu %zu %zu", &stats->hit_count, &stats->miss_count, &stats->store_count, &stats->evict_count) != 4)
+      memset(stats, 0, sizeof(tau_cache_stats_t));
+
+    fclose(stream);
+  }
+
+  tau_string_free(stats_path_str);
+  tau_path_free(stats_path);
+}
+
+static void tau_cache_save_stats(tau_cache_t* cache)
+{
+  tau_cache_stats_t* stats = &cache->stats;
+
+  if (stats->hit_count + stats->miss_count + stats->store_count + stats->evict_count == 0)
+    return;
+
+  tau_path_t* stats_path = tau_cache_stats_path(cache);
+  tau_path_t* temp_path = NULL;
+
+  // Compilers finishing at the same time may lose each other's counts, which
+  // is acceptable for statistics.
+  FILE* stream = tau_cache_open_temp(stats_path, &temp_path);
+
+  if (stream != NULL)
+  {
+    fprintf(stream, "%zu %zu %zu %zu\n",
+      cache->prev_stats.hit_count + stats->hit_count,
+      cache->prev_stats.miss_count + stats->miss_count,
+      cache->prev_stats.store_count + stats->store_count,
+      cache->prev_stats.evict_count + stats->evict_count
+    );
+
+    tau_cache_commit_temp(stream, temp_path, stats_path);
+  }
+
+  tau_path_free(stats_path);
+}
+
+tau_cache_t* tau_cache_init(const char* dir, size_t max_size)
+{
+  tau_path_t* dir_path = tau_path_init_with_cstr(dir);
+
+  if (!tau_file_create_directory(dir_path))
+  {
+    tau_log_warn("cache", "Failed to create cache directory, compiling without cache: %s", dir);
+    tau_path_free(dir_path);
+    return NULL;
+  }
+
+  tau_cache_t* cache = (tau_cache_t*)malloc(sizeof(tau_cache_t));
+  TAU_ASSERT(cache != NULL);
+
+  cache->dir = dir_path;
+  cache->max_size = max_size;
+  memset(&cache->stats, 0, sizeof(tau_cache_stats_t));
+  memset(&cache->prev_stats, 0, sizeof(tau_cache_stats_t));
+
+  tau_mutex_init(&cache->mutex);
+
+  tau_cache_load_stats(cache);
+
+  return cache;
+}
+
+void tau_cache_free(tau_cache_t* cache)
+{
+  tau_cache_save_stats(cache);
+
+  tau_mutex_free(&cache->mutex);
+  tau_path_free(cache->dir);
+  free(cache);
+}
+
+bool tau_cache_restore(tau_cache_t* cache, const char* config, const char* src, size_t src_size, tau_path_t* path, tau_vector_t* extensions)
+{
+  tau_path_t* entry_path = tau_cache_entry_path(cache, config, src, src_size);
+
+  tau_file_view_t* view = tau_file_view_open(entry_path);
+
+  bool is_hit = false;
+
+  if (view != NULL)
+  {
+    is_hit = tau_cache_restore_view(view, config, src_size, path, extensions);
+    tau_file_view_close(view);
+  }
+
+  // The modification time of an entry is the time it was last used.
+  if (is_hit)
+    tau_file_touch(entry_path);
+
+  tau_path_free(entry_path);
+
+  tau_mutex_lock(&cache->mutex);
+
+  if (is_hit)
+    cache->stats.hit_count++;
+  else
+    cache->stats.miss_count++;
+
+  tau_mutex_unlock(&cache->mutex);
+
+  return is_hit;
+}
+
+void tau_cache_store(tau_cache_t* cache, const char* config, const char* src, size_t src_size, tau_path_t* path, tau_vector_t* extensions)
+{
+  tau_vector_t* views = tau_vector_init();
+
+  TAU_VECTOR_FOR_LOOP(i, extensions)
+  {
+    tau_path_t* output_path = tau_path_replace_extension(path, (const char*)tau_vector_get(extensions, i));
+
+    tau_file_view_t* view = tau_file_view_open(output_path);
+
+    tau_path_free(output_path);
+
+    if (view == NULL)
+      break;
+
+    tau_vector_push(views, view);
+  }
+
+  bool is_stored = false;
+
+  if (tau_vector_size(views) == tau_vector_size(extensions))
+  {
+    tau_path_t* entry_path = tau_cache_entry_path(cache, config, src, src_size);
+    tau_path_t* temp_path = NULL;
+
+    FILE* stream = tau_cache_open_temp(entry_path, &temp_path);
+
+    if (stream != NULL)
+    {
+      fwrite(CACHE_MAGIC, 1, sizeof(CACHE_MAGIC) - 1, stream);
+      tau_cache_write_u64(stream, CACHE_VERSION);
+      tau_cache_write_u64(stream, strlen(config));
+      fwrite(config, 1, strlen(config), stream);
+      tau_cache_write_u64(stream, src_size);
+      tau_cache_write_u64(stream, tau_vector_size(extensions));
+
+      TAU_VECTOR_FOR_LOOP(i, extensions)
+      {
+        const char* ext = (const char*)tau_vector_get(extensions, i);
+        tau_file_view_t* view = (tau_file_view_t*)tau_vector_get(views, i);
+
+        tau_cache_write_u64(stream, strlen(ext));
+        fwrite(ext, 1, strlen(ext), stream);
+        tau_cache_write_u64(stream, tau_file_view_size(view));
+        fwrite(tau_file_view_data(view), 1, tau_file_view_size(view), stream);
+      }
+
+      is_stored = tau_cache_commit_temp(stream, temp_path, entry_path);
+    }
+
+    if (!is_stored)
+    {
+      tau_string_t* entry_path_str = tau_path_to_string(entry_path);
+      tau_log_warn("cache", "Failed to write cache entry: %s", tau_string_begin(entry_path_str));
+      tau_string_free(entry_path_str);
+    }
+
+    tau_path_free(entry_path);
+  }
+
+  TAU_VECTOR_FOR_LOOP(i, views)
+  {
+    tau_file_view_close((tau_file_view_t*)tau_vector_get(views, i));
+  }
+
+  tau_vector_free(views);
+
+  if (is_stored)
+  {
+    tau_mutex_lock(&cache->mutex);
+    cache->stats.store_count++;
+    tau_mutex_unlock(&cache->mutex);
+  }
+}
+
+static int tau_cache_entry_compare(const void* lhs, const void* rhs)
+{
+  uint64_t lhs_time = ((const tau_cache_entry_t*)lhs)->time;
+  uint64_t rhs_time = ((const tau_cache_entry_t*)rhs)->time;
+
+  return lhs_time < rhs_time ? -1 : (lhs_time > rhs_time ? 1 : 0);
+}
+
+void tau_cache_trim(tau_cache_t* cache)
+{
+  tau_vector_t* paths = tau_file_list_directory(cache->dir);
+
+  if (paths == NULL)
+    return;
+
+  tau_cache_entry_t* entries = (tau_cache_entry_t*)malloc(sizeof(tau_cache_entry_t) * (tau_vector_size(paths) + 1));
+  TAU_ASSERT(entries != NULL);
+
+  size_t entry_count = 0;
+  size_t total_size = 0;
+
+  TAU_VECTOR_FOR_LOOP(i, paths)
+  {
+    tau_path_t* path = (tau_path_t*)tau_vector_get(paths, i);
+
+    tau_string_view_t path_view = tau_path_to_string_view(path);
+    size_t path_len = tau_string_view_length(path_view);
+    size_t ext_len = sizeof(CACHE_ENTRY_EXTENSION) - 1;
+
+    if (path_len < ext_len || strcmp(tau_string_view_begin(path_view) + path_len - ext_len, CACHE_ENTRY_EXTENSION) != 0)
+    {
+      tau_path_free(path);
+      continue;
+    }
+
+    entries[entry_count].path = path;
+    entries[entry_count].size = tau_file_size(path);
+    entries[entry_count].time = tau_file_modification_time(path);
+
+    total_size += entries[entry_count].size;
+    entry_count++;
+  }
+
+  tau_vector_free(paths);
+
+  if (total_size > cache->max_size)
+  {
+    // Trimming below the limit keeps every following compilation from having
+    // to trim again right away.
+    size_t target_size = cache->max_size / 10 * 9;
+
+    qsort(entries, entry_count, sizeof(tau_cache_entry_t), tau_cache_entry_compare);
+
+    for (size_t i = 0; i < entry_count && total_size > target_size; i++)
+      if (tau_file_remove(entries[i].path))
+      {
+        total_size -= entries[i].size;
+        cache->stats.evict_count++;
+      }
+  }
+
+  for (size_t i = 0; i < entry_count; i++)
+    tau_path_free(entries[i].path);
+
+  free(entries);
+}
+
+tau_cache_stats_t tau_cache_get_stats(tau_cache_t* cache)
+{
+  tau_mutex_lock(&cache->mutex);
+  tau_cache_stats_t stats = cache->stats;
+  tau_mutex_unlock(&cache->mutex);
+
+  return stats;
+}
+
+void tau_cache_print_stats(tau_cache_t* cache, FILE* stream)
+{
+  tau_cache_stats_t stats = tau_cache_get_stats(cache);
+
+  tau_cache_stats_t total = {
+    .hit_count = cache->prev_stats.hit_count + stats.hit_count,
+    .miss_count = cache->prev_stats.miss_count + stats.miss_count,
+    .store_count = cache->prev_stats.store_count + stats.store_count,
+    .evict_count = cache->prev_stats.evict_count + stats.evict_count
+  };
+
+  size_t lookup_count = total.hit_count + total.miss_count;
+  double hit_rate = lookup_count == 0 ? 0.0 : 100.0 * (double)total.hit_count / (double)lookup_count;
+
+  fprintf(stream, "cache: %zu hits, %zu misses, %zu stores, %zu evictions\n", stats.hit_count, stats.miss_count, stats.store_count, stats.evict_count);
+  fprintf(stream, "cache (total): %zu hits, %zu misses, %zu stores, %zu evictions, %.1f%% hit rate\n", total.hit_count, total.miss_count, total.store_count, total.evict_count, hit_rate);
+}
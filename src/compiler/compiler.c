@@ -7,10 +7,14 @@
 
 #include "compiler/compiler.h"
 
+#include <string.h>
+
 #include "llvm.h"
 #include "ast/ast.h"
-#include "ast/registry.h"
+#include "compiler/cache.h"
+#include "compiler/lto.h"
 #include "compiler/options.h"
+#include "compiler/split.h"
 #include "stages/analysis/ctrlflow.h"
 #include "stages/analysis/symtable.h"
 #include "stages/lexer/lexer.h"
@@ -19,14 +23,112 @@
 #include "stages/parser/parser.h"
 #include "utils/common.h"
 #include "utils/crumb.h"
+#include "utils/interner.h"
 #include "utils/timer.h"
+#include "utils/trace.h"
+#include "utils/concurrency/threadpool.h"
 #include "utils/io/file.h"
 
 struct tau_compiler_t
 {
   tau_options_ctx_t* options;
+  tau_threadpool_t* pool; // Thread pool shared by parallel work or `NULL`.
+  tau_cache_t* cache; // Compilation cache or `NULL`.
+  tau_string_t* cache_config; // Configuration the outputs of a job depend on.
+  tau_vector_t* cache_extensions; // Vector of the extensions of every output a job may have.
 };
 
+/**
+ * \brief Represents the compilation of a single input file.
+ */
+typedef struct tau_compiler_job_t
+{
+  tau_compiler_t* compiler; // Pointer to the compiler context.
+  const char* path; // Path to the input file.
+  FILE* stream; // Stream the diagnostics of the job are written to.
+  bool is_failed; // Whether the input file failed to compile.
+} tau_compiler_job_t;
+
+static void tau_compiler_env_free(tau_environment_t* env)
+{
+  TAU_VECTOR_FOR_LOOP(i, env->paths)
+  {
+    free(tau_vector_get(env->paths, i));
+  }
+
+  TAU_VECTOR_FOR_LOOP(i, env->sources)
+  {
+    tau_file_view_close((tau_file_view_t*)tau_vector_get(env->sources, i));
+  }
+
+  LLVMDisposeBuilder(env->llvm_builder);
+  LLVMDisposeModule(env->llvm_module);
+
+  tau_typetable_free(env->typetable);
+  tau_typebuilder_free(env->typebuilder);
+  tau_symtable_free(env->symtable);
+
+  tau_environment_free(env);
+}
+
+/// Size of buffers holding the name of a pass pipeline.
+#define COMPILER_PIPELINE_BUFFER_SIZE 32
+
+/// Size of buffers holding parts of the configuration of cached outputs.
+#define COMPILER_CACHE_BUFFER_SIZE 64
+
+/**
+ * \brief Returns the name of an optimization level as used in LLVM pass
+ * pipelines.
+ */
+static const char* tau_compiler_opt_level_to_string(tau_opt_level_t level)
+{
+  switch (level)
+  {
+  case TAU_OPT_LEVEL_O0: return "O0";
+  case TAU_OPT_LEVEL_O1: return "O1";
+  case TAU_OPT_LEVEL_O2: return "O2";
+  case TAU_OPT_LEVEL_O3: return "O3";
+  case TAU_OPT_LEVEL_OS: return "Os";
+  case TAU_OPT_LEVEL_OZ: return "Oz";
+  default: TAU_UNREACHABLE();
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Returns the target machine code generation level of an optimization
+ * level.
+ */
+static LLVMCodeGenOptLevel tau_compiler_opt_level_to_codegen_level(tau_opt_level_t level)
+{
+  switch (level)
+  {
+  case TAU_OPT_LEVEL_O0: return LLVMCodeGenLevelNone;
+  case TAU_OPT_LEVEL_O1: return LLVMCodeGenLevelLess;
+  case TAU_OPT_LEVEL_O2:
+  case TAU_OPT_LEVEL_OS:
+  case TAU_OPT_LEVEL_OZ: return LLVMCodeGenLevelDefault;
+  case TAU_OPT_LEVEL_O3: return LLVMCodeGenLevelAggressive;
+  default: TAU_UNREACHABLE();
+  }
+
+  return LLVMCodeGenLevelDefault;
+}
+
+/**
+ * \brief Records a finished stage of compiling a file in the memory report of
+ * the calling thread and attributes further allocations to no owner.
+ *
+ * \param[in] stage The name of the stage.
+ */
+static void tau_compiler_memstat_stage(const char* stage)
+{
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_OTHER);
+  tau_memstat_report_stage(stage);
+}
+
 static void tau_compiler_dump_tokens(tau_path_t* path, tau_vector_t* tokens)
 {
   tau_path_t* tokens_path = tau_path_replace_extension(path, "tokens.json");
@@ -141,10 +243,21 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
     return NULL;
   }
 
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_SYMTABLE);
+  tau_symtable_t* symtable = tau_symtable_init(NULL);
+
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_TYPEDESC);
+  tau_typebuilder_t* typebuilder = tau_typebuilder_init(tau_llvm_get_context(), tau_llvm_get_data());
+
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_TYPETABLE);
+  tau_typetable_t* typetable = tau_typetable_init();
+
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_OTHER);
+
   tau_environment_t* env = tau_environment_init(
-    tau_symtable_init(NULL),
-    tau_typebuilder_init(tau_llvm_get_context(), tau_llvm_get_data()),
-    tau_typetable_init(),
+    symtable,
+    typebuilder,
+    typetable,
     tau_llvm_get_context(),
     tau_llvm_get_data(),
     LLVMModuleCreateWithNameInContext("module", tau_llvm_get_context()),
@@ -157,26 +270,46 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
 
   tau_vector_push(env->paths, tau_path_cstr);
 
-  size_t src_len = tau_file_read(path, NULL, 0);
-  char* src_cstr = (char*)malloc((src_len + 1) * sizeof(char));
-  tau_file_read(path, src_cstr, src_len + 1);
+  tau_file_view_t* src_view = tau_file_view_open(path);
+
+  if (src_view == NULL)
+  {
+    tau_log_error("main", "Failed to read file: %s", tau_path_cstr);
+    tau_compiler_env_free(env);
+    return NULL;
+  }
 
-  tau_vector_push(env->sources, src_cstr);
+  tau_vector_push(env->sources, src_view);
+
+  // Token positions are 32-bit offsets into the source.
+  if (tau_file_view_size(src_view) > UINT32_MAX)
+  {
+    tau_log_error("main", "Source file too large: %s", tau_path_cstr);
+    tau_compiler_env_free(env);
+    return NULL;
+  }
+
+  const char* src_cstr = tau_file_view_data(src_view);
 
   tau_error_bag_t* errors = tau_error_bag_init(10);
 
   {
+    tau_memstat_set_owner(TAU_MEMSTAT_OWNER_TOKENS);
+
     tau_lexer_t* lexer = tau_lexer_init();
 
     tau_time_it("lexer", tau_lexer_lex(lexer, tau_path_cstr, src_cstr, env->tokens, errors));
 
     tau_lexer_free(lexer);
 
+    tau_compiler_memstat_stage("lexer");
+
     if (!tau_error_bag_empty(errors))
     {
       tau_error_bag_print(errors);
       tau_error_bag_free(errors);
-      exit(EXIT_FAILURE);
+      tau_compiler_env_free(env);
+      return NULL;
     }
   }
 
@@ -186,17 +319,22 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
   tau_ast_node_t* root_node = NULL;
 
   {
+    tau_memstat_set_owner(TAU_MEMSTAT_OWNER_AST);
+
     tau_parser_t* parser = tau_parser_init();
 
-    tau_time_it("parser", root_node = tau_parser_parse(parser, env->tokens, errors));
+    tau_time_it("parser", root_node = tau_parser_parse(parser, env->tokens, env->ast_arena, errors));
 
     tau_parser_free(parser);
 
+    tau_compiler_memstat_stage("parser");
+
     if (!tau_error_bag_empty(errors))
     {
       tau_error_bag_print(errors);
       tau_error_bag_free(errors);
-      exit(EXIT_FAILURE);
+      tau_compiler_env_free(env);
+      return NULL;
     }
   }
 
@@ -204,32 +342,42 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
     tau_compiler_dump_ast(path, root_node);
 
   {
+    tau_memstat_set_owner(TAU_MEMSTAT_OWNER_SYMTABLE);
+
     tau_nameres_ctx_t* tau_nameres_ctx = tau_nameres_ctx_init(env->symtable, errors);
 
     tau_time_it("analysis:nameres", tau_ast_node_nameres(tau_nameres_ctx, root_node));
 
     tau_nameres_ctx_free(tau_nameres_ctx);
 
+    tau_compiler_memstat_stage("nameres");
+
     if (!tau_error_bag_empty(errors))
     {
       tau_error_bag_print(errors);
       tau_error_bag_free(errors);
-      exit(EXIT_FAILURE);
+      tau_compiler_env_free(env);
+      return NULL;
     }
   }
 
   {
+    tau_memstat_set_owner(TAU_MEMSTAT_OWNER_TYPEDESC);
+
     tau_typecheck_ctx_t* tau_typecheck_ctx = tau_typecheck_ctx_init(env->typebuilder, env->typetable, errors);
 
     tau_time_it("analysis:typecheck", tau_ast_node_typecheck(tau_typecheck_ctx, root_node));
 
     tau_typecheck_ctx_free(tau_typecheck_ctx);
 
+    tau_compiler_memstat_stage("typecheck");
+
     if (!tau_error_bag_empty(errors))
     {
       tau_error_bag_print(errors);
       tau_error_bag_free(errors);
-      exit(EXIT_FAILURE);
+      tau_compiler_env_free(env);
+      return NULL;
     }
   }
 
@@ -240,11 +388,14 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
 
     tau_ctrlflow_ctx_free(tau_ctrlflow_ctx);
 
+    tau_compiler_memstat_stage("ctrlflow");
+
     if (!tau_error_bag_empty(errors))
     {
       tau_error_bag_print(errors);
       tau_error_bag_free(errors);
-      exit(EXIT_FAILURE);
+      tau_compiler_env_free(env);
+      return NULL;
     }
   }
 
@@ -261,37 +412,324 @@ tau_environment_t* tau_compiler_process_file(tau_compiler_t* compiler, tau_path_
     tau_time_it("codegen", tau_ast_node_codegen(tau_codegen_ctx, root_node));
 
     tau_codegen_ctx_free(tau_codegen_ctx);
+
+    tau_compiler_memstat_stage("codegen");
   }
 
   tau_error_bag_free(errors);
 
-  if (tau_options_get_dump_ll(compiler->options))
-    tau_compiler_emit_ll(path, env->llvm_module);
-
   LLVMVerifyModule(env->llvm_module, LLVMAbortProcessAction, NULL);
 
-  LLVMPassBuilderOptionsRef llvm_pass_builder_options = LLVMCreatePassBuilderOptions();
-  LLVMPassBuilderOptionsSetVerifyEach(llvm_pass_builder_options, true);
+  {
+    LLVMPassBuilderOptionsRef llvm_pass_builder_options = LLVMCreatePassBuilderOptions();
+    LLVMPassBuilderOptionsSetVerifyEach(llvm_pass_builder_options, tau_options_get_verify_each(compiler->options));
+    LLVMPassBuilderOptionsSetDebugLogging(llvm_pass_builder_options, tau_log_get_level() == TAU_LOG_LEVEL_TRACE);
 
-#if TAU_DEBUG
-  LLVMPassBuilderOptionsSetDebugLogging(llvm_pass_builder_options, true);
-#endif
+    const char* passes = tau_options_get_passes(compiler->options);
+    char default_passes[COMPILER_PIPELINE_BUFFER_SIZE];
 
-  // LLVMRunPasses(llvm_module, "default<O3>", tau_llvm_get_machine(), llvm_pass_builder_options);
+    if (passes == NULL)
+    {
+      // With link time optimization part of the work is left to the link step.
+      const char* pipeline = NULL;
+
+      switch (tau_options_get_lto_mode(compiler->options))
+      {
+      case TAU_LTO_MODE_NONE: pipeline = "default";          break;
+      case TAU_LTO_MODE_THIN: pipeline = "thinlto-pre-link"; break;
+      case TAU_LTO_MODE_FULL: pipeline = "lto-pre-link";     break;
+      default: TAU_UNREACHABLE();
+      }
+
+      snprintf(default_passes, sizeof(default_passes), "%s<%s>", pipeline, tau_compiler_opt_level_to_string(tau_options_get_opt_level(compiler->options)));
+      passes = default_passes;
+    }
+
+    LLVMErrorRef llvm_error = NULL;
 
-  LLVMDisposePassBuilderOptions(llvm_pass_builder_options);
+    tau_time_it("LLVM:passes", llvm_error = LLVMRunPasses(env->llvm_module, passes, tau_llvm_get_machine(), llvm_pass_builder_options));
+
+    LLVMDisposePassBuilderOptions(llvm_pass_builder_options);
+
+    if (llvm_error != NULL)
+    {
+      char* tau_error_str = LLVMGetErrorMessage(llvm_error);
+      tau_log_error("LLVM", "Failed to run passes (%s): %s", passes, tau_error_str);
+      LLVMDisposeErrorMessage(tau_error_str);
+
+      tau_compiler_env_free(env);
+      return NULL;
+    }
+  }
+
+  if (tau_options_get_dump_ll(compiler->options))
+    tau_compiler_emit_ll(path, env->llvm_module);
+
+  // The link step generates the machine code from the bitcode.
+  if (tau_options_get_lto_mode(compiler->options) != TAU_LTO_MODE_NONE)
+  {
+    tau_compiler_emit_bc(path, env->llvm_module);
+    tau_memstat_report_stage("llvm");
+    return env;
+  }
 
   if (tau_options_get_dump_bc(compiler->options))
     tau_compiler_emit_bc(path, env->llvm_module);
 
-  if (tau_options_get_dump_asm(compiler->options))
-    tau_compiler_emit_asm(path, env->llvm_module);
+  size_t split_count = tau_options_get_split_count(compiler->options);
 
-  tau_compiler_emit_obj(path, env->llvm_module);
+  if (split_count > 1)
+    tau_time_it("LLVM:split", tau_split_emit(env->llvm_module, path, split_count, tau_options_get_dump_asm(compiler->options), compiler->pool));
+  else
+  {
+    if (tau_options_get_dump_asm(compiler->options))
+      tau_time_it("LLVM:codegen", tau_compiler_emit_asm(path, env->llvm_module));
+
+    tau_time_it("LLVM:codegen", tau_compiler_emit_obj(path, env->llvm_module));
+  }
+
+  tau_memstat_report_stage("llvm");
 
   return env;
 }
 
+static void tau_compiler_push_cache_extension(tau_vector_t* extensions, const char* ext)
+{
+  size_t len = strlen(ext);
+
+  char* copy = (char*)malloc(sizeof(char) * (len + 1));
+  TAU_ASSERT(copy != NULL);
+
+  memcpy(copy, ext, len + 1);
+
+  tau_vector_push(extensions, copy);
+}
+
+/**
+ * \brief Lists the extensions of the outputs of a job.
+ *
+ * \param[in] options Pointer to the compiler options.
+ * \param[in] partition_count The number of partitions split modules are
+ * emitted as.
+ * \returns Vector of the extensions, to be freed with
+ * `tau_compiler_free_cache_extensions`.
+ */
+static tau_vector_t* tau_compiler_cache_extensions(tau_options_ctx_t* options, size_t partition_count)
+{
+  tau_vector_t* extensions = tau_vector_init();
+
+  if (tau_options_get_dump_tokens(options))
+    tau_compiler_push_cache_extension(extensions, "tokens.json");
+
+  if (tau_options_get_dump_ast(options))
+    tau_compiler_push_cache_extension(extensions, "ast.json");
+
+  if (tau_options_get_dump_ll(options))
+    tau_compiler_push_cache_extension(extensions, "ll");
+
+  if (tau_options_get_dump_bc(options) || tau_options_get_lto_mode(options) != TAU_LTO_MODE_NONE)
+    tau_compiler_push_cache_extension(extensions, "bc");
+
+  if (tau_options_get_lto_mode(options) == TAU_LTO_MODE_NONE)
+  {
+    if (tau_options_get_split_count(options) > 1)
+      for (size_t i = 0; i < partition_count; i++)
+      {
+        char ext[COMPILER_CACHE_BUFFER_SIZE];
+
+        if (tau_options_get_dump_asm(options))
+        {
+          snprintf(ext, sizeof(ext), "%zu.asm", i);
+          tau_compiler_push_cache_extension(extensions, ext);
+        }
+
+        snprintf(ext, sizeof(ext), "%zu.obj", i);
+        tau_compiler_push_cache_extension(extensions, ext);
+      }
+    else
+    {
+      if (tau_options_get_dump_asm(options))
+        tau_compiler_push_cache_extension(extensions, "asm");
+
+      tau_compiler_push_cache_extension(extensions, "obj");
+    }
+  }
+
+  return extensions;
+}
+
+static void tau_compiler_free_cache_extensions(tau_vector_t* extensions)
+{
+  TAU_VECTOR_FOR_LOOP(i, extensions)
+  {
+    free(tau_vector_get(extensions, i));
+  }
+
+  tau_vector_free(extensions);
+}
+
+/**
+ * \brief Initializes the compilation cache and describes everything the
+ * outputs of a job depend on apart from the input file.
+ */
+static void tau_compiler_cache_init(tau_compiler_t* compiler)
+{
+  compiler->cache = tau_cache_init(tau_options_get_cache_dir(compiler->options), tau_options_get_cache_size(compiler->options));
+
+  if (compiler->cache == NULL)
+    return;
+
+  tau_options_ctx_t* options = compiler->options;
+
+  // Split modules may be emitted as fewer partitions, so this lists every
+  // output a job may have.
+  tau_vector_t* extensions = tau_compiler_cache_extensions(options, tau_options_get_split_count(options));
+
+  const char* passes = tau_options_get_passes(options);
+
+  char config[COMPILER_CACHE_BUFFER_SIZE];
+  snprintf(config, sizeof(config), ";opt=%s;lto=%d;split=%zu;passes=",
+    tau_compiler_opt_level_to_string(tau_options_get_opt_level(options)),
+    (int)tau_options_get_lto_mode(options),
+    tau_options_get_split_count(options)
+  );
+
+  compiler->cache_config = tau_string_init_with_cstr("tauc " TAU_VERSION ";triple=");
+  tau_string_append_cstr(compiler->cache_config, tau_llvm_get_target_triple());
+  tau_string_append_cstr(compiler->cache_config, ";cpu=");
+  tau_string_append_cstr(compiler->cache_config, tau_llvm_get_cpu_name());
+  tau_string_append_cstr(compiler->cache_config, ";features=");
+  tau_string_append_cstr(compiler->cache_config, tau_llvm_get_cpu_features());
+  tau_string_append_cstr(compiler->cache_config, config);
+  tau_string_append_cstr(compiler->cache_config, passes == NULL ? "" : passes);
+  tau_string_append_cstr(compiler->cache_config, ";outputs=");
+
+  TAU_VECTOR_FOR_LOOP(i, extensions)
+  {
+    tau_string_append_cstr(compiler->cache_config, i == 0 ? "" : ",");
+    tau_string_append_cstr(compiler->cache_config, (const char*)tau_vector_get(extensions, i));
+  }
+
+  compiler->cache_extensions = extensions;
+}
+
+/**
+ * \brief Compiles the input file of a job and releases every per-thread
+ * resource the compilation acquired.
+ *
+ * \details If the outputs of the input file are found in the compilation
+ * cache, they are restored instead.
+ *
+ * \param[in,out] job Pointer to the job.
+ */
+static void tau_compiler_job_run(tau_compiler_job_t* job)
+{
+  tau_log_set_stream(job->stream);
+  tau_crumb_set_stream(job->stream);
+
+  tau_trace_begin_with_detail("file", job->path, strlen(job->path));
+
+  tau_path_t* path = tau_path_init_with_cstr(job->path);
+
+  tau_compiler_t* compiler = job->compiler;
+  tau_file_view_t* src_view = NULL;
+  tau_string_t* config = NULL;
+
+  if (compiler->cache != NULL)
+  {
+    src_view = tau_file_view_open(path);
+    config = tau_string_copy(compiler->cache_config);
+
+    // Token and syntax tree dumps and symbols promoted for split code
+    // generation name the input file, so the outputs are only valid for the
+    // same path.
+    tau_string_append_cstr(config, ";path=");
+    tau_string_append_cstr(config, job->path);
+  }
+
+  bool is_restored = false;
+
+  if (src_view != NULL)
+    tau_time_it("cache:restore", is_restored = tau_cache_restore(compiler->cache, tau_string_begin(config), tau_file_view_data(src_view), tau_file_view_size(src_view), path, compiler->cache_extensions));
+
+  if (!is_restored)
+  {
+    tau_memstat_report_begin();
+
+    tau_environment_t* env = tau_compiler_process_file(compiler, path);
+
+    tau_memstat_report_end(job->stream, job->path);
+
+    job->is_failed = env == NULL;
+
+    if (!job->is_failed && src_view != NULL)
+    {
+      size_t partition_count = 1;
+
+      if (tau_options_get_split_count(compiler->options) > 1)
+        partition_count = tau_split_partition_count(env->llvm_module, tau_options_get_split_count(compiler->options));
+
+      tau_vector_t* extensions = tau_compiler_cache_extensions(compiler->options, partition_count);
+
+      tau_time_it("cache:store", tau_cache_store(compiler->cache, tau_string_begin(config), tau_file_view_data(src_view), tau_file_view_size(src_view), path, extensions));
+
+      tau_compiler_free_cache_extensions(extensions);
+    }
+
+    if (env != NULL)
+      tau_compiler_env_free(env);
+  }
+
+  if (src_view != NULL)
+    tau_file_view_close(src_view);
+
+  if (config != NULL)
+    tau_string_free(config);
+
+  tau_path_free(path);
+
+  tau_trace_end();
+
+  // Nothing created while compiling the file is referenced anymore, so the
+  // next job on this thread can start from a clean state.
+  tau_token_registry_free();
+  tau_interner_free();
+  tau_ast_node_reset_count();
+  tau_llvm_thread_free();
+}
+
+/**
+ * \brief Runs a subrange of jobs.
+ *
+ * \param[in,out] arg Pointer to the array of jobs.
+ * \param[in] begin Index of the first job.
+ * \param[in] end One past the index of the last job.
+ */
+static void tau_compiler_job_run_range(void* arg, size_t begin, size_t end)
+{
+  tau_compiler_job_t* jobs = (tau_compiler_job_t*)arg;
+
+  for (size_t i = begin; i < end; i++)
+    tau_compiler_job_run(&jobs[i]);
+}
+
+/**
+ * \brief Writes the recorded time trace next to the output file.
+ */
+static void tau_compiler_write_trace(tau_compiler_t* compiler)
+{
+  tau_path_t* output_path = tau_path_init_with_cstr(tau_options_get_output_file(compiler->options));
+  tau_path_t* trace_path = tau_path_replace_extension(output_path, "time-trace.json");
+  tau_string_t* trace_path_str = tau_path_to_string(trace_path);
+
+  if (!tau_trace_write(tau_string_begin(trace_path_str)))
+    tau_log_error("main", "Failed to write time trace: %s", tau_string_begin(trace_path_str));
+
+  tau_string_free(trace_path_str);
+  tau_path_free(trace_path);
+  tau_path_free(output_path);
+}
+
 tau_compiler_t* tau_compiler_init(void)
 {
   tau_compiler_t* compiler = (tau_compiler_t*)malloc(sizeof(tau_compiler_t));
@@ -300,19 +738,35 @@ tau_compiler_t* tau_compiler_init(void)
   tau_crumb_set_stream(stdout);
 
   compiler->options = tau_options_ctx_init();
+  compiler->pool = NULL;
+  compiler->cache = NULL;
+  compiler->cache_config = NULL;
+  compiler->cache_extensions = NULL;
 
   return compiler;
 }
 
 void tau_compiler_free(tau_compiler_t* compiler)
 {
+  if (compiler->pool != NULL)
+    tau_threadpool_free(compiler->pool);
+
+  if (compiler->cache != NULL)
+  {
+    tau_cache_free(compiler->cache);
+    tau_string_free(compiler->cache_config);
+    tau_compiler_free_cache_extensions(compiler->cache_extensions);
+  }
+
   if (!tau_options_get_should_exit(compiler->options))
   {
-    tau_ast_registry_free();
     tau_token_registry_free();
+    tau_interner_free();
     tau_llvm_free();
   }
 
+  tau_trace_free();
+
   tau_options_ctx_free(compiler->options);
 
   free(compiler);
@@ -328,7 +782,13 @@ int tau_compiler_main(tau_compiler_t* compiler, int argc, const char* argv[])
   tau_log_set_verbose(tau_options_get_is_verbose(compiler->options));
   tau_log_set_level(tau_options_get_log_level(compiler->options));
 
-  tau_time_it("LLVM:init", tau_llvm_init());
+  if (tau_options_get_time_trace(compiler->options))
+    tau_trace_init();
+
+  if (tau_options_get_mem_report(compiler->options))
+    tau_memstat_enable();
+
+  tau_time_it("LLVM:init", tau_llvm_init(tau_compiler_opt_level_to_codegen_level(tau_options_get_opt_level(compiler->options))));
 
   if (tau_vector_empty(tau_options_get_input_files(compiler->options)))
   {
@@ -338,34 +798,102 @@ int tau_compiler_main(tau_compiler_t* compiler, int argc, const char* argv[])
 
   tau_vector_t* input_files = tau_options_get_input_files(compiler->options);
 
-  TAU_VECTOR_FOR_LOOP(i, input_files)
-  {
-    const char* tau_path_cstr = (const char*)tau_vector_get(input_files, i);
-    tau_path_t* path = tau_path_init_with_cstr(tau_path_cstr);
+  if (tau_options_get_cache_dir(compiler->options) != NULL && compiler->cache == NULL)
+    tau_compiler_cache_init(compiler);
 
-    tau_environment_t* env = tau_compiler_process_file(compiler, path);
+  size_t job_count = tau_vector_size(input_files);
+  size_t max_thread_count = tau_options_get_job_count(compiler->options);
+  size_t thread_count = TAU_MIN(max_thread_count, job_count);
+
+  // The pool also runs the partitions of split modules, so it is sized by the
+  // job limit rather than by the number of input files. The calling thread
+  // takes part in the work, so one fewer worker is needed.
+  if (max_thread_count > 1 && compiler->pool == NULL)
+    compiler->pool = tau_threadpool_init(max_thread_count - 1);
 
-    TAU_VECTOR_FOR_LOOP(i, env->paths)
+  tau_compiler_job_t* jobs = (tau_compiler_job_t*)malloc(sizeof(tau_compiler_job_t) * job_count);
+  TAU_ASSERT(jobs != NULL);
+
+  TAU_VECTOR_FOR_LOOP(i, input_files)
+  {
+    jobs[i].compiler = compiler;
+    jobs[i].path = (const char*)tau_vector_get(input_files, i);
+    jobs[i].stream = stdout;
+    jobs[i].is_failed = false;
+
+    // Parallel jobs buffer their diagnostics, so that they can be printed in
+    // input order once every job has finished.
+    if (thread_count > 1)
     {
-      free(tau_vector_get(env->paths, i));
+      FILE* stream = tmpfile();
+
+      if (stream != NULL)
+        jobs[i].stream = stream;
     }
+  }
+
+  if (thread_count > 1)
+    tau_threadpool_parallel_for(compiler->pool, 0, job_count, 1, tau_compiler_job_run_range, jobs);
+  else
+    tau_compiler_job_run_range(jobs, 0, job_count);
 
-    TAU_VECTOR_FOR_LOOP(i, env->sources)
+  tau_log_set_stream(stdout);
+  tau_crumb_set_stream(stdout);
+
+  int status = EXIT_SUCCESS;
+
+  for (size_t i = 0; i < job_count; i++)
+  {
+    if (jobs[i].stream != stdout)
     {
-      free(tau_vector_get(env->sources, i));
+      rewind(jobs[i].stream);
+
+      char buf[4096];
+      size_t len;
+
+      while ((len = fread(buf, 1, sizeof(buf), jobs[i].stream)) > 0)
+        fwrite(buf, 1, len, stdout);
+
+      fclose(jobs[i].stream);
     }
 
-    LLVMDisposeBuilder(env->llvm_builder);
-    LLVMDisposeModule(env->llvm_module);
+    if (jobs[i].is_failed)
+      status = EXIT_FAILURE;
+  }
 
-    tau_typetable_free(env->typetable);
-    tau_typebuilder_free(env->typebuilder);
-    tau_symtable_free(env->symtable);
+  free(jobs);
 
-    tau_environment_free(env);
+  if (compiler->cache != NULL)
+  {
+    tau_time_it("cache:trim", tau_cache_trim(compiler->cache));
 
-    tau_path_free(path);
+    if (tau_options_get_cache_stats(compiler->options))
+      tau_cache_print_stats(compiler->cache, stdout);
   }
 
-  return EXIT_SUCCESS;
+  tau_lto_mode_t lto_mode = tau_options_get_lto_mode(compiler->options);
+
+  if (status == EXIT_SUCCESS && lto_mode != TAU_LTO_MODE_NONE)
+  {
+    char passes[COMPILER_PIPELINE_BUFFER_SIZE];
+    snprintf(passes, sizeof(passes), "%s<%s>", lto_mode == TAU_LTO_MODE_THIN ? "thinlto" : "lto", tau_compiler_opt_level_to_string(tau_options_get_opt_level(compiler->options)));
+
+    tau_path_t* output_path = tau_path_init_with_cstr(tau_options_get_output_file(compiler->options));
+    tau_path_t* obj_path = tau_path_replace_extension(output_path, "obj");
+
+    bool is_linked = false;
+
+    tau_time_it("LLVM:lto", is_linked = tau_lto_link(lto_mode, input_files, passes, obj_path, compiler->pool));
+
+    if (!is_linked)
+      status = EXIT_FAILURE;
+
+    tau_path_free(obj_path);
+    tau_path_free(output_path);
+  }
+
+  if (tau_trace_is_enabled())
+    tau_compiler_write_trace(compiler);
+
+  return status;
 }
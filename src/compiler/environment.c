@@ -17,6 +17,7 @@ tau_environment_t* tau_environment_init(tau_symtable_t* symtable, tau_typebuilde
   env->paths = tau_vector_init();
   env->sources = tau_vector_init();
   env->tokens = tau_vector_init();
+  env->ast_arena = tau_arena_init();
   env->symtable = symtable;
   env->typebuilder = typebuilder;
   env->typetable = typetable;
@@ -33,18 +34,9 @@ void tau_environment_free(tau_environment_t* env)
   tau_vector_free(env->paths);
   tau_vector_free(env->sources);
   tau_vector_free(env->tokens);
-  free(env);
-}
 
-void tau_environment_merge(tau_environment_t* dest, tau_environment_t* src)
-{
-  tau_symtable_merge(dest->symtable, src->symtable);
-  tau_typetable_merge(dest->typetable, src->typetable);
+  if (env->ast_arena != NULL)
+    tau_arena_free(env->ast_arena);
 
-  if (LLVMLinkModules2(dest->llvm_module, src->llvm_module))
-  {
-    tau_log_error("env", "Failed to link modules.");
-  }
-
-  tau_environment_free(src);
+  free(env);
 }
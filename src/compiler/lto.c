@@ -0,0 +1,427 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "compiler/lto.h"
+
+#include <string.h>
+
+#include "compiler/split.h"
+#include "utils/str.h"
+#include "utils/timer.h"
+#include "utils/trace.h"
+#include "utils/io/log.h"
+
+/// Maximum number of instructions of a function imported by other modules.
+#define LTO_IMPORT_INSTR_LIMIT 100
+
+/**
+ * \brief Represents the data shared by the modules of a link.
+ */
+typedef struct tau_lto_ctx_t
+{
+  tau_vector_t* input_files; // Vector of paths to the input files.
+  LLVMMemoryBufferRef* bitcodes; // The bitcode of every input file.
+  const char* passes; // The post-link pass pipeline.
+  bool* results; // Whether linking succeeded for every input file.
+  FILE* log_stream; // The log stream of the thread which started the link.
+} tau_lto_ctx_t;
+
+/**
+ * \brief Logs the diagnostics of LLVM contexts used for linking.
+ *
+ * \details Without a handler LLVM exits the process on errors.
+ */
+static void tau_lto_diagnostic_handler(LLVMDiagnosticInfoRef llvm_info, void* TAU_UNUSED(ctx))
+{
+  LLVMDiagnosticSeverity severity = LLVMGetDiagInfoSeverity(llvm_info);
+
+  if (severity != LLVMDSError && severity != LLVMDSWarning)
+    return;
+
+  char* tau_desc_str = LLVMGetDiagInfoDescription(llvm_info);
+
+  if (severity == LLVMDSError)
+    tau_log_error("LLVM", "%s", tau_desc_str);
+  else
+    tau_log_warn("LLVM", "%s", tau_desc_str);
+
+  LLVMDisposeMessage(tau_desc_str);
+}
+
+/**
+ * \brief Creates an LLVM context for linking.
+ */
+static LLVMContextRef tau_lto_context_create(void)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMContextSetDiagnosticHandler(llvm_context, tau_lto_diagnostic_handler, NULL);
+  return llvm_context;
+}
+
+/**
+ * \brief Reads the bitcode of an input file.
+ *
+ * \param[in] path_cstr Path to the input file.
+ * \returns The bitcode or `NULL` if it could not be read.
+ */
+static LLVMMemoryBufferRef tau_lto_read_bitcode(const char* path_cstr)
+{
+  tau_path_t* path = tau_path_init_with_cstr(path_cstr);
+  tau_path_t* bc_path = tau_path_replace_extension(path, "bc");
+  tau_string_t* bc_path_str = tau_path_to_string(bc_path);
+
+  LLVMMemoryBufferRef llvm_bitcode = NULL;
+  char* tau_error_str = NULL;
+
+  if (LLVMCreateMemoryBufferWithContentsOfFile(tau_string_begin(bc_path_str), &llvm_bitcode, &tau_error_str))
+  {
+    tau_log_error("LLVM", "Failed to read bitcode file (%s): %s", tau_string_begin(bc_path_str), tau_error_str);
+    LLVMDisposeMessage(tau_error_str);
+    llvm_bitcode = NULL;
+  }
+
+  tau_string_free(bc_path_str);
+  tau_path_free(bc_path);
+  tau_path_free(path);
+
+  return llvm_bitcode;
+}
+
+/**
+ * \brief Loads the module of an input file into a context.
+ *
+ * \param[in] llvm_context The context to load the module into.
+ * \param[in] llvm_bitcode The bitcode of the input file.
+ * \param[in] path_cstr Path to the input file.
+ * \param[in] promote Whether to promote symbols with local linkage.
+ * \returns The module or `NULL` if it could not be loaded.
+ */
+static LLVMModuleRef tau_lto_load(LLVMContextRef llvm_context, LLVMMemoryBufferRef llvm_bitcode, const char* path_cstr, bool promote)
+{
+  LLVMModuleRef llvm_module = NULL;
+
+  if (LLVMParseBitcodeInContext2(llvm_context, llvm_bitcode, &llvm_module))
+  {
+    tau_log_error("LLVM", "Failed to load bitcode of %s.", path_cstr);
+    return NULL;
+  }
+
+  if (promote)
+  {
+    tau_path_t* path = tau_path_init_with_cstr(path_cstr);
+    tau_split_promote_locals(llvm_module, path);
+    tau_path_free(path);
+  }
+
+  return llvm_module;
+}
+
+/**
+ * \brief Runs the post-link pipeline on a module and emits it as an object.
+ *
+ * \param[in,out] llvm_module The module to be emitted.
+ * \param[in] passes The post-link pass pipeline.
+ * \param[in] obj_path Pointer to the path of the object.
+ * \returns `true` if the object was emitted, `false` otherwise.
+ */
+static bool tau_lto_emit_obj(LLVMModuleRef llvm_module, const char* passes, tau_path_t* obj_path)
+{
+  LLVMTargetMachineRef llvm_machine = tau_llvm_create_machine();
+
+  if (llvm_machine == NULL)
+  {
+    tau_log_error("LLVM", "Failed to create target machine.");
+    return false;
+  }
+
+  LLVMPassBuilderOptionsRef llvm_pass_builder_options = LLVMCreatePassBuilderOptions();
+  LLVMErrorRef llvm_error = NULL;
+  tau_time_it("LLVM:passes", llvm_error = LLVMRunPasses(llvm_module, passes, llvm_machine, llvm_pass_builder_options));
+  LLVMDisposePassBuilderOptions(llvm_pass_builder_options);
+
+  if (llvm_error != NULL)
+  {
+    char* tau_error_str = LLVMGetErrorMessage(llvm_error);
+    tau_log_error("LLVM", "Failed to run passes (%s): %s", passes, tau_error_str);
+    LLVMDisposeErrorMessage(tau_error_str);
+
+    LLVMDisposeTargetMachine(llvm_machine);
+    return false;
+  }
+
+  tau_string_t* obj_path_str = tau_path_to_string(obj_path);
+
+  char* tau_error_str = NULL;
+  bool result = true;
+  LLVMBool is_failed = false;
+
+  tau_time_it("LLVM:codegen", is_failed = LLVMTargetMachineEmitToFile(llvm_machine, llvm_module, tau_string_begin(obj_path_str), LLVMObjectFile, &tau_error_str));
+
+  if (is_failed)
+  {
+    tau_log_error("LLVM", "Failed to emit object file (%s): %s", tau_string_begin(obj_path_str), tau_error_str);
+    LLVMDisposeMessage(tau_error_str);
+    result = false;
+  }
+
+  tau_string_free(obj_path_str);
+  LLVMDisposeTargetMachine(llvm_machine);
+
+  return result;
+}
+
+/**
+ * \brief Checks whether a function is small enough to be imported.
+ */
+static bool tau_lto_is_importable(LLVMValueRef llvm_function)
+{
+  size_t size = 0;
+
+  for (LLVMBasicBlockRef llvm_block = LLVMGetFirstBasicBlock(llvm_function); llvm_block != NULL; llvm_block = LLVMGetNextBasicBlock(llvm_block))
+    for (LLVMValueRef llvm_inst = LLVMGetFirstInstruction(llvm_block); llvm_inst != NULL; llvm_inst = LLVMGetNextInstruction(llvm_inst))
+      if (++size > LTO_IMPORT_INSTR_LIMIT)
+        return false;
+
+  return true;
+}
+
+/**
+ * \brief Reduces a module to the definitions other modules may import.
+ *
+ * \details Small external functions and external constants become
+ * `available_externally` definitions, every other definition a declaration.
+ * The linker only copies `available_externally` definitions the destination
+ * module refers to.
+ *
+ * \param[in,out] llvm_module The module to be reduced.
+ */
+static void tau_lto_make_import_source(LLVMModuleRef llvm_module)
+{
+  size_t function_count = 0;
+
+  for (LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module); llvm_function != NULL; llvm_function = LLVMGetNextFunction(llvm_function))
+    function_count++;
+
+  // Declarations replacing definitions are appended to the function list, so
+  // only the original functions are visited.
+  LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module);
+
+  for (size_t i = 0; i < function_count; i++)
+  {
+    LLVMValueRef llvm_next = LLVMGetNextFunction(llvm_function);
+    LLVMLinkage linkage = LLVMGetLinkage(llvm_function);
+
+    if (!LLVMIsDeclaration(llvm_function) && linkage != LLVMLinkOnceAnyLinkage && linkage != LLVMLinkOnceODRLinkage)
+    {
+      if (linkage == LLVMExternalLinkage && tau_lto_is_importable(llvm_function))
+        LLVMSetLinkage(llvm_function, LLVMAvailableExternallyLinkage);
+      else
+        tau_split_make_declaration(llvm_module, llvm_function);
+    }
+
+    llvm_function = llvm_next;
+  }
+
+  for (LLVMValueRef llvm_global = LLVMGetFirstGlobal(llvm_module); llvm_global != NULL; llvm_global = LLVMGetNextGlobal(llvm_global))
+  {
+    LLVMLinkage linkage = LLVMGetLinkage(llvm_global);
+
+    if (LLVMIsDeclaration(llvm_global) || linkage == LLVMLinkOnceAnyLinkage || linkage == LLVMLinkOnceODRLinkage)
+      continue;
+
+    // Local constants are only copied along with the functions using them.
+    if (linkage == LLVMInternalLinkage || linkage == LLVMPrivateLinkage)
+      continue;
+
+    if (linkage == LLVMExternalLinkage && LLVMIsGlobalConstant(llvm_global))
+      LLVMSetLinkage(llvm_global, LLVMAvailableExternallyLinkage);
+    else
+    {
+      LLVMSetInitializer(llvm_global, NULL);
+      LLVMSetLinkage(llvm_global, LLVMExternalLinkage);
+    }
+  }
+}
+
+/**
+ * \brief Imports from every other module into the module of an input file,
+ * then optimizes and emits it.
+ *
+ * \param[in] ctx Pointer to the data shared by the modules.
+ * \param[in] idx The index of the input file.
+ * \returns `true` if the object was emitted, `false` otherwise.
+ */
+static bool tau_lto_link_thin_module(tau_lto_ctx_t* ctx, size_t idx)
+{
+  LLVMContextRef llvm_context = tau_lto_context_create();
+
+  const char* path_cstr = (const char*)tau_vector_get(ctx->input_files, idx);
+  LLVMModuleRef llvm_module = tau_lto_load(llvm_context, ctx->bitcodes[idx], path_cstr, true);
+
+  bool result = llvm_module != NULL;
+
+  for (size_t i = 0; result && i < tau_vector_size(ctx->input_files); i++)
+  {
+    if (i == idx)
+      continue;
+
+    const char* src_path_cstr = (const char*)tau_vector_get(ctx->input_files, i);
+    LLVMModuleRef llvm_src_module = tau_lto_load(llvm_context, ctx->bitcodes[i], src_path_cstr, true);
+
+    if (llvm_src_module == NULL)
+    {
+      result = false;
+      break;
+    }
+
+    tau_lto_make_import_source(llvm_src_module);
+
+    // The source module is destroyed even if linking fails.
+    if (LLVMLinkModules2(llvm_module, llvm_src_module))
+    {
+      tau_log_error("LLVM", "Failed to import from %s into %s.", src_path_cstr, path_cstr);
+      result = false;
+    }
+  }
+
+  if (result)
+  {
+    tau_path_t* path = tau_path_init_with_cstr(path_cstr);
+    tau_path_t* obj_path = tau_path_replace_extension(path, "obj");
+
+    result = tau_lto_emit_obj(llvm_module, ctx->passes, obj_path);
+
+    tau_path_free(obj_path);
+    tau_path_free(path);
+  }
+
+  if (llvm_module != NULL)
+    LLVMDisposeModule(llvm_module);
+
+  LLVMContextDispose(llvm_context);
+
+  return result;
+}
+
+/**
+ * \brief Links a range of modules in thin mode.
+ */
+static void tau_lto_link_thin_range(void* arg, size_t begin, size_t end)
+{
+  tau_lto_ctx_t* ctx = (tau_lto_ctx_t*)arg;
+
+  FILE* prev_stream = tau_log_get_stream();
+  tau_log_set_stream(ctx->log_stream);
+
+  for (size_t i = begin; i < end; i++)
+  {
+    const char* path_cstr = (const char*)tau_vector_get(ctx->input_files, i);
+
+    tau_trace_begin_with_detail("LLVM:thinlto", path_cstr, strlen(path_cstr));
+    ctx->results[i] = tau_lto_link_thin_module(ctx, i);
+    tau_trace_end();
+  }
+
+  tau_log_set_stream(prev_stream);
+}
+
+/**
+ * \brief Merges every module into one, then optimizes and emits it.
+ *
+ * \param[in] ctx Pointer to the data shared by the modules.
+ * \param[in] output_path Pointer to the path of the object.
+ * \returns `true` if the object was emitted, `false` otherwise.
+ */
+static bool tau_lto_link_full(tau_lto_ctx_t* ctx, tau_path_t* output_path)
+{
+  LLVMContextRef llvm_context = tau_lto_context_create();
+
+  LLVMModuleRef llvm_module = tau_lto_load(llvm_context, ctx->bitcodes[0], (const char*)tau_vector_get(ctx->input_files, 0), false);
+
+  bool result = llvm_module != NULL;
+
+  for (size_t i = 1; result && i < tau_vector_size(ctx->input_files); i++)
+  {
+    const char* src_path_cstr = (const char*)tau_vector_get(ctx->input_files, i);
+    LLVMModuleRef llvm_src_module = tau_lto_load(llvm_context, ctx->bitcodes[i], src_path_cstr, false);
+
+    if (llvm_src_module == NULL)
+    {
+      result = false;
+      break;
+    }
+
+    if (LLVMLinkModules2(llvm_module, llvm_src_module))
+    {
+      tau_log_error("LLVM", "Failed to link %s.", src_path_cstr);
+      result = false;
+    }
+  }
+
+  if (result)
+    result = tau_lto_emit_obj(llvm_module, ctx->passes, output_path);
+
+  if (llvm_module != NULL)
+    LLVMDisposeModule(llvm_module);
+
+  LLVMContextDispose(llvm_context);
+
+  return result;
+}
+
+bool tau_lto_link(tau_lto_mode_t mode, tau_vector_t* input_files, const char* passes, tau_path_t* output_path, tau_threadpool_t* pool)
+{
+  TAU_ASSERT(mode != TAU_LTO_MODE_NONE);
+  TAU_ASSERT(!tau_vector_empty(input_files));
+
+  size_t input_count = tau_vector_size(input_files);
+
+  LLVMMemoryBufferRef* bitcodes = (LLVMMemoryBufferRef*)malloc(sizeof(LLVMMemoryBufferRef) * input_count);
+  TAU_ASSERT(bitcodes != NULL);
+
+  bool result = true;
+
+  for (size_t i = 0; i < input_count; i++)
+  {
+    bitcodes[i] = tau_lto_read_bitcode((const char*)tau_vector_get(input_files, i));
+    result = result && bitcodes[i] != NULL;
+  }
+
+  tau_lto_ctx_t ctx = {
+    .input_files = input_files,
+    .bitcodes = bitcodes,
+    .passes = passes,
+    .results = NULL,
+    .log_stream = tau_log_get_stream()
+  };
+
+  if (result && mode == TAU_LTO_MODE_FULL)
+    result = tau_lto_link_full(&ctx, output_path);
+  else if (result && mode == TAU_LTO_MODE_THIN)
+  {
+    ctx.results = (bool*)malloc(sizeof(bool) * input_count);
+    TAU_ASSERT(ctx.results != NULL);
+
+    if (pool == NULL)
+      tau_lto_link_thin_range(&ctx, 0, input_count);
+    else
+      tau_threadpool_parallel_for(pool, 0, input_count, 1, tau_lto_link_thin_range, &ctx);
+
+    for (size_t i = 0; i < input_count; i++)
+      result = result && ctx.results[i];
+
+    free(ctx.results);
+  }
+
+  for (size_t i = 0; i < input_count; i++)
+    if (bitcodes[i] != NULL)
+      LLVMDisposeMemoryBuffer(bitcodes[i]);
+
+  free(bitcodes);
+
+  return result;
+}
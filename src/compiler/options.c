@@ -7,8 +7,18 @@
 
 #include "compiler/options.h"
 
+#include <ctype.h>
+#include <errno.h>
+
+#include "utils/concurrency/thread.h"
 #include "utils/io/argparse.h"
 
+/// The largest job count per hardware thread.
+#define OPTIONS_JOBS_PER_HARDWARE_THREAD 4
+
+/// The largest number of partitions a module can be split into.
+#define OPTIONS_MAX_SPLIT_COUNT 256
+
 /**
  * \brief Enumeration of compiler option kinds.
  */
@@ -20,6 +30,22 @@ typedef enum tau_options_option_kind_t
   OPTION_LOG_LEVEL,         ///< --log-level <LEVEL>
   OPTION_OUTPUT,            ///< -o, --output <FILE>
   OPTION_OUTPUT_KIND,       ///< --output-kind <KIND>
+  OPTION_JOBS,              ///< -j, --jobs <N>
+  OPTION_SPLIT_MODULE,      ///< --split-module <N>
+  OPTION_CACHE_DIR,         ///< --cache-dir <DIR>
+  OPTION_CACHE_SIZE,        ///< --cache-size <MIB>
+  OPTION_CACHE_STATS,       ///< --cache-stats
+  OPTION_OPT_O0,            ///< -O0
+  OPTION_OPT_O1,            ///< -O1
+  OPTION_OPT_O2,            ///< -O2
+  OPTION_OPT_O3,            ///< -O3
+  OPTION_OPT_OS,            ///< -Os
+  OPTION_OPT_OZ,            ///< -Oz
+  OPTION_LTO,               ///< --lto <MODE>
+  OPTION_PASSES,            ///< --passes <PIPELINE>
+  OPTION_VERIFY_EACH,       ///< --verify-each
+  OPTION_TIME_TRACE,        ///< --time-trace
+  OPTION_MEM_REPORT,        ///< --mem-report
   OPTION_DUMP_TOKENS,       ///< --dump-tokens
   OPTION_DUMP_AST,          ///< --dump-ast
   OPTION_DUMP_LL,           ///< --dump-ll
@@ -43,6 +69,22 @@ static const tau_argparse_option_t g_argparse_opts[] = {
   TAU_ARGPARSE_OPTION(OPTION_LOG_LEVEL,         NULL, "log-level",   "LEVEL", "Set the logging level (e.g., debug, info, warn, error)."),
   TAU_ARGPARSE_OPTION(OPTION_OUTPUT,            "o",  "output",      "FILE",  "Specify the output file name."),
   TAU_ARGPARSE_OPTION(OPTION_OUTPUT_KIND,       NULL, "output-kind", "KIND",  "Specify the type of output (e.g., exec, pie, dyn)."),
+  TAU_ARGPARSE_OPTION(OPTION_JOBS,              "j",  "jobs",        "N",     "Compile up to N input files in parallel."),
+  TAU_ARGPARSE_OPTION(OPTION_SPLIT_MODULE,      NULL, "split-module", "N",     "Generate code for each module as N objects in parallel."),
+  TAU_ARGPARSE_OPTION(OPTION_CACHE_DIR,         NULL, "cache-dir",   "DIR",   "Reuse the outputs of earlier compilations stored in DIR."),
+  TAU_ARGPARSE_OPTION(OPTION_CACHE_SIZE,        NULL, "cache-size",  "MIB",   "Limit the size of the cache directory (default 1024)."),
+  TAU_ARGPARSE_OPTION(OPTION_CACHE_STATS,       NULL, "cache-stats", NULL,    "Print cache statistics after compiling."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_O0,            "O0", NULL,          NULL,    "Disable optimizations (default)."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_O1,            "O1", NULL,          NULL,    "Enable basic optimizations."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_O2,            "O2", NULL,          NULL,    "Enable most optimizations."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_O3,            "O3", NULL,          NULL,    "Enable all optimizations."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_OS,            "Os", NULL,          NULL,    "Optimize for code size."),
+  TAU_ARGPARSE_OPTION(OPTION_OPT_OZ,            "Oz", NULL,          NULL,    "Optimize aggressively for code size."),
+  TAU_ARGPARSE_OPTION(OPTION_LTO,               NULL, "lto",         "MODE",  "Enable link time optimization (thin, full)."),
+  TAU_ARGPARSE_OPTION(OPTION_PASSES,            NULL, "passes",      "PIPELINE", "Run the specified LLVM pass pipeline instead of the default one."),
+  TAU_ARGPARSE_OPTION(OPTION_VERIFY_EACH,       NULL, "verify-each", NULL,    "Verify the module after every optimization pass."),
+  TAU_ARGPARSE_OPTION(OPTION_TIME_TRACE,        NULL, "time-trace",  NULL,    "Write a Chrome trace of compile time to <output>.time-trace.json."),
+  TAU_ARGPARSE_OPTION(OPTION_MEM_REPORT,        NULL, "mem-report",  NULL,    "Print the memory used by each stage of compiling a file."),
   TAU_ARGPARSE_OPTION(OPTION_DUMP_TOKENS,       NULL, "dump-tokens", NULL,    "Output the list of tokens generated by the lexer."),
   TAU_ARGPARSE_OPTION(OPTION_DUMP_AST,          NULL, "dump-ast",    NULL,    "Output the abstract syntax tree (AST) after parsing."),
   TAU_ARGPARSE_OPTION(OPTION_DUMP_LL,           NULL, "dump-ll",     NULL,    "Output the generated LLVM intermediate representation (IR)."),
@@ -84,6 +126,20 @@ struct tau_options_ctx_t
   tau_vector_t* search_dirs;
   tau_vector_t* input_files;
 
+  size_t job_count;
+  size_t split_count;
+
+  const char* cache_dir;
+  size_t cache_size;
+  bool cache_stats;
+
+  tau_opt_level_t opt_level;
+  tau_lto_mode_t lto_mode;
+  const char* passes;
+  bool verify_each;
+  bool time_trace;
+  bool mem_report;
+
   bool is_verbose;
   bool dump_tokens;
   bool dump_ast;
@@ -153,6 +209,137 @@ static void tau_options_option_output_kind(tau_options_ctx_t* ctx, tau_argparse_
     TAU_UNREACHABLE();
 }
 
+/**
+ * \brief Parses a positive decimal count.
+ *
+ * \details Signs and leading whitespace are rejected, since `strtoull` would
+ * silently wrap negative numbers around.
+ *
+ * \param[in] arg The argument to be parsed or `NULL`.
+ * \param[out] count Pointer to the parsed count.
+ * \returns `true` if the argument is a positive count, `false` otherwise.
+ */
+static bool tau_options_parse_count(const char* arg, size_t* count)
+{
+  if (arg == NULL || !isdigit((unsigned char)*arg))
+    return false;
+
+  char* end = NULL;
+
+  errno = 0;
+  unsigned long long value = strtoull(arg, &end, 10);
+
+  if (errno == ERANGE || *end != '\0' || value == 0 || value > SIZE_MAX)
+    return false;
+
+  *count = (size_t)value;
+
+  return true;
+}
+
+static void tau_options_option_jobs(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  const char* arg = tau_argparse_next_arg(argp_ctx);
+  size_t count = 0;
+
+  if (!tau_options_parse_count(arg, &count))
+  {
+    tau_log_warn("options", "Invalid job count, compiling on a single thread.");
+    count = 1;
+  }
+
+  size_t max_count = tau_thread_hardware_concurrency() * OPTIONS_JOBS_PER_HARDWARE_THREAD;
+
+  if (count > max_count)
+  {
+    tau_log_warn("options", "Job count is too large, compiling on %zu threads.", max_count);
+    count = max_count;
+  }
+
+  ctx->job_count = count;
+}
+
+static void tau_options_option_split_module(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  const char* arg = tau_argparse_next_arg(argp_ctx);
+  size_t count = 0;
+
+  if (!tau_options_parse_count(arg, &count))
+  {
+    tau_log_warn("options", "Invalid split count, emitting a single object per module.");
+    count = 1;
+  }
+
+  if (count > OPTIONS_MAX_SPLIT_COUNT)
+  {
+    tau_log_warn("options", "Split count is too large, emitting at most %d objects per module.", OPTIONS_MAX_SPLIT_COUNT);
+    count = OPTIONS_MAX_SPLIT_COUNT;
+  }
+
+  ctx->split_count = count;
+}
+
+static void tau_options_option_cache_dir(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  ctx->cache_dir = tau_argparse_next_arg(argp_ctx);
+}
+
+static void tau_options_option_cache_size(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  const char* arg = tau_argparse_next_arg(argp_ctx);
+  size_t size = 0;
+
+  if (!tau_options_parse_count(arg, &size) || size > SIZE_MAX / (1024 * 1024))
+  {
+    tau_log_warn("options", "Invalid cache size, using the default size.");
+    return;
+  }
+
+  ctx->cache_size = size * 1024 * 1024;
+}
+
+static void tau_options_option_cache_stats(tau_options_ctx_t* ctx)
+{
+  ctx->cache_stats = true;
+}
+
+static void tau_options_option_opt_level(tau_options_ctx_t* ctx, tau_opt_level_t level)
+{
+  ctx->opt_level = level;
+}
+
+static void tau_options_option_lto(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  const char* arg = tau_argparse_next_arg(argp_ctx);
+
+  if (arg != NULL && strcmp("thin", arg) == 0)
+    ctx->lto_mode = TAU_LTO_MODE_THIN;
+  else if (arg != NULL && strcmp("full", arg) == 0)
+    ctx->lto_mode = TAU_LTO_MODE_FULL;
+  else
+    tau_log_warn("options", "Invalid link time optimization mode, expected `thin` or `full`.");
+}
+
+static void tau_options_option_passes(tau_options_ctx_t* ctx, tau_argparse_ctx_t* argp_ctx)
+{
+  ctx->passes = tau_argparse_next_arg(argp_ctx);
+}
+
+static void tau_options_option_verify_each(tau_options_ctx_t* ctx)
+{
+  ctx->verify_each = true;
+}
+
+static void tau_options_option_time_trace(tau_options_ctx_t* ctx)
+{
+  ctx->time_trace = true;
+}
+
+static void tau_options_option_mem_report(tau_options_ctx_t* ctx)
+{
+  ctx->mem_report = true;
+}
+
 static void tau_options_option_dump_tokens(tau_options_ctx_t* ctx)
 {
   ctx->dump_tokens = true;
@@ -224,6 +411,17 @@ tau_options_ctx_t* tau_options_ctx_init(void)
   ctx->libs = tau_vector_init();
   ctx->search_dirs = tau_vector_init();
   ctx->input_files = tau_vector_init();
+  ctx->job_count = 1;
+  ctx->split_count = 1;
+  ctx->cache_dir = NULL;
+  ctx->cache_size = (size_t)1024 * 1024 * 1024;
+  ctx->cache_stats = false;
+  ctx->opt_level = TAU_OPT_LEVEL_O0;
+  ctx->lto_mode = TAU_LTO_MODE_NONE;
+  ctx->passes = NULL;
+  ctx->verify_each = false;
+  ctx->time_trace = false;
+  ctx->mem_report = false;
   ctx->is_verbose = false;
   ctx->dump_tokens = false;
   ctx->dump_ast = false;
@@ -260,6 +458,22 @@ void tau_options_parse(tau_options_ctx_t* ctx, int argc, const char* argv[])
     case OPTION_LOG_LEVEL:         tau_options_option_log_level        (ctx, argp_ctx); break;
     case OPTION_OUTPUT:            tau_options_option_output           (ctx, argp_ctx); break;
     case OPTION_OUTPUT_KIND:       tau_options_option_output_kind      (ctx, argp_ctx); break;
+    case OPTION_JOBS:              tau_options_option_jobs             (ctx, argp_ctx); break;
+    case OPTION_SPLIT_MODULE:      tau_options_option_split_module     (ctx, argp_ctx); break;
+    case OPTION_CACHE_DIR:         tau_options_option_cache_dir        (ctx, argp_ctx); break;
+    case OPTION_CACHE_SIZE:        tau_options_option_cache_size       (ctx, argp_ctx); break;
+    case OPTION_CACHE_STATS:       tau_options_option_cache_stats      (ctx          ); break;
+    case OPTION_OPT_O0:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_O0); break;
+    case OPTION_OPT_O1:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_O1); break;
+    case OPTION_OPT_O2:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_O2); break;
+    case OPTION_OPT_O3:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_O3); break;
+    case OPTION_OPT_OS:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_OS); break;
+    case OPTION_OPT_OZ:            tau_options_option_opt_level        (ctx, TAU_OPT_LEVEL_OZ); break;
+    case OPTION_LTO:               tau_options_option_lto              (ctx, argp_ctx); break;
+    case OPTION_PASSES:            tau_options_option_passes           (ctx, argp_ctx); break;
+    case OPTION_VERIFY_EACH:       tau_options_option_verify_each      (ctx          ); break;
+    case OPTION_TIME_TRACE:        tau_options_option_time_trace       (ctx          ); break;
+    case OPTION_MEM_REPORT:        tau_options_option_mem_report       (ctx          ); break;
     case OPTION_DUMP_TOKENS:       tau_options_option_dump_tokens      (ctx          ); break;
     case OPTION_DUMP_AST:          tau_options_option_dump_ast         (ctx          ); break;
     case OPTION_DUMP_LL:           tau_options_option_dump_ll          (ctx          ); break;
@@ -326,6 +540,61 @@ tau_vector_t* tau_options_get_input_files(tau_options_ctx_t* ctx)
   return ctx->input_files;
 }
 
+size_t tau_options_get_job_count(tau_options_ctx_t* ctx)
+{
+  return ctx->job_count;
+}
+
+size_t tau_options_get_split_count(tau_options_ctx_t* ctx)
+{
+  return ctx->split_count;
+}
+
+const char* tau_options_get_cache_dir(tau_options_ctx_t* ctx)
+{
+  return ctx->cache_dir;
+}
+
+size_t tau_options_get_cache_size(tau_options_ctx_t* ctx)
+{
+  return ctx->cache_size;
+}
+
+bool tau_options_get_cache_stats(tau_options_ctx_t* ctx)
+{
+  return ctx->cache_stats;
+}
+
+tau_opt_level_t tau_options_get_opt_level(tau_options_ctx_t* ctx)
+{
+  return ctx->opt_level;
+}
+
+tau_lto_mode_t tau_options_get_lto_mode(tau_options_ctx_t* ctx)
+{
+  return ctx->lto_mode;
+}
+
+const char* tau_options_get_passes(tau_options_ctx_t* ctx)
+{
+  return ctx->passes;
+}
+
+bool tau_options_get_verify_each(tau_options_ctx_t* ctx)
+{
+  return ctx->verify_each;
+}
+
+bool tau_options_get_time_trace(tau_options_ctx_t* ctx)
+{
+  return ctx->time_trace;
+}
+
+bool tau_options_get_mem_report(tau_options_ctx_t* ctx)
+{
+  return ctx->mem_report;
+}
+
 bool tau_options_get_is_verbose(tau_options_ctx_t* ctx)
 {
   return ctx->is_verbose;
@@ -0,0 +1,340 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "compiler/split.h"
+
+#include "utils/hash.h"
+#include "utils/str.h"
+#include "utils/timer.h"
+
+/// Partition index of functions kept in every partition.
+#define SPLIT_EVERY_PARTITION SIZE_MAX
+
+/// Room for the suffix appended to the names of promoted values.
+#define SPLIT_NAME_SUFFIX_SIZE 64
+
+/**
+ * \brief Represents the data shared by the partitions of a module.
+ */
+typedef struct tau_split_ctx_t
+{
+  const char* bitcode; // The bitcode of the whole module.
+  size_t bitcode_size; // The size of the bitcode in bytes.
+  size_t* partitions; // The partition of every function in module order.
+  size_t function_count; // The number of functions in the module.
+  tau_path_t* path; // Pointer to the path of the source file.
+  bool emit_asm; // Whether to emit assembly files as well.
+  FILE* log_stream; // The log stream of the thread which split the module.
+} tau_split_ctx_t;
+
+/**
+ * \brief Checks whether a global value has local linkage.
+ */
+static bool tau_split_is_local(LLVMValueRef value)
+{
+  LLVMLinkage linkage = LLVMGetLinkage(value);
+  return linkage == LLVMInternalLinkage || linkage == LLVMPrivateLinkage;
+}
+
+/**
+ * \brief Checks whether a global value may be defined in any number of
+ * objects.
+ */
+static bool tau_split_is_discardable(LLVMValueRef value)
+{
+  LLVMLinkage linkage = LLVMGetLinkage(value);
+  return linkage == LLVMLinkOnceAnyLinkage || linkage == LLVMLinkOnceODRLinkage || linkage == LLVMAvailableExternallyLinkage;
+}
+
+/**
+ * \brief Gives a global value with local linkage hidden external linkage and a
+ * name unique to the source file.
+ *
+ * \param[in,out] value The global value.
+ * \param[in] salt The hash of the source file path.
+ * \param[in] idx The index of the value, used if it has no name.
+ */
+static void tau_split_promote(LLVMValueRef value, uint64_t salt, size_t idx)
+{
+  size_t len = 0;
+  const char* name = LLVMGetValueName2(value, &len);
+
+  size_t new_size = len + SPLIT_NAME_SUFFIX_SIZE;
+  char* new_name = (char*)malloc(new_size);
+  TAU_ASSERT(new_name != NULL);
+
+  int new_len = len == 0
+    ? snprintf(new_name, new_size, "__tau_split.%zu.%016" PRIx64, idx, salt)
+    : snprintf(new_name, new_size, "%.*s.%016" PRIx64, (int)len, name, salt);
+
+  LLVMSetValueName2(value, new_name, (size_t)new_len);
+  LLVMSetLinkage(value, LLVMExternalLinkage);
+  LLVMSetVisibility(value, LLVMHiddenVisibility);
+
+  free(new_name);
+}
+
+/**
+ * \brief Returns the number of instructions in a function.
+ */
+static size_t tau_split_function_size(LLVMValueRef llvm_function)
+{
+  size_t size = 0;
+
+  for (LLVMBasicBlockRef llvm_block = LLVMGetFirstBasicBlock(llvm_function); llvm_block != NULL; llvm_block = LLVMGetNextBasicBlock(llvm_block))
+    for (LLVMValueRef llvm_inst = LLVMGetFirstInstruction(llvm_block); llvm_inst != NULL; llvm_inst = LLVMGetNextInstruction(llvm_inst))
+      size++;
+
+  return size;
+}
+
+/**
+ * \brief Emits a partition of a module to a file.
+ */
+static void tau_split_emit_file(LLVMTargetMachineRef llvm_machine, LLVMModuleRef llvm_module, tau_path_t* path, size_t idx, const char* extension, LLVMCodeGenFileType file_type)
+{
+  char partition_extension[SPLIT_NAME_SUFFIX_SIZE];
+  snprintf(partition_extension, sizeof(partition_extension), "%zu.%s", idx, extension);
+
+  tau_path_t* partition_path = tau_path_replace_extension(path, partition_extension);
+  tau_string_t* partition_path_str = tau_path_to_string(partition_path);
+
+  char* tau_error_str = NULL;
+
+  if (LLVMTargetMachineEmitToFile(llvm_machine, llvm_module, tau_string_begin(partition_path_str), file_type, &tau_error_str))
+  {
+    tau_log_error("LLVM", "Failed to emit partition (%s): %s", tau_string_begin(partition_path_str), tau_error_str);
+    LLVMDisposeMessage(tau_error_str);
+  }
+
+  tau_string_free(partition_path_str);
+  tau_path_free(partition_path);
+}
+
+/**
+ * \brief Loads, strips and emits a partition of a module.
+ *
+ * \param[in] ctx Pointer to the data shared by the partitions.
+ * \param[in] idx The index of the partition.
+ */
+static void tau_split_emit_partition(tau_split_ctx_t* ctx, size_t idx)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMMemoryBufferRef llvm_buffer = LLVMCreateMemoryBufferWithMemoryRange(ctx->bitcode, ctx->bitcode_size, "split", false);
+  LLVMModuleRef llvm_module = NULL;
+
+  if (LLVMParseBitcodeInContext2(llvm_context, llvm_buffer, &llvm_module))
+  {
+    tau_log_error("LLVM", "Failed to load partition %zu.", idx);
+    LLVMDisposeMemoryBuffer(llvm_buffer);
+    LLVMContextDispose(llvm_context);
+    return;
+  }
+
+  // Declarations replacing definitions are appended to the function list, so
+  // the original functions are visited in module order.
+  LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module);
+
+  for (size_t i = 0; i < ctx->function_count; i++)
+  {
+    LLVMValueRef llvm_next = LLVMGetNextFunction(llvm_function);
+
+    if (ctx->partitions[i] != SPLIT_EVERY_PARTITION && ctx->partitions[i] != idx)
+      tau_split_make_declaration(llvm_module, llvm_function);
+
+    llvm_function = llvm_next;
+  }
+
+  // Global variables are defined by the first partition, except for local
+  // constants which are duplicated wherever they are used.
+  if (idx > 0)
+    for (LLVMValueRef llvm_global = LLVMGetFirstGlobal(llvm_module); llvm_global != NULL; llvm_global = LLVMGetNextGlobal(llvm_global))
+    {
+      if (LLVMIsDeclaration(llvm_global) || tau_split_is_discardable(llvm_global))
+        continue;
+
+      if (tau_split_is_local(llvm_global) && LLVMIsGlobalConstant(llvm_global))
+        continue;
+
+      LLVMSetInitializer(llvm_global, NULL);
+      LLVMSetLinkage(llvm_global, LLVMExternalLinkage);
+    }
+
+  LLVMTargetMachineRef llvm_machine = tau_llvm_create_machine();
+
+  if (llvm_machine == NULL)
+    tau_log_error("LLVM", "Failed to create target machine for partition %zu.", idx);
+  else
+  {
+    // Drop the local constants and declarations the partition does not use.
+    LLVMPassBuilderOptionsRef llvm_pass_builder_options = LLVMCreatePassBuilderOptions();
+    LLVMErrorRef llvm_error = LLVMRunPasses(llvm_module, "globaldce", llvm_machine, llvm_pass_builder_options);
+    LLVMDisposePassBuilderOptions(llvm_pass_builder_options);
+
+    if (llvm_error != NULL)
+      LLVMConsumeError(llvm_error);
+
+    if (ctx->emit_asm)
+      tau_split_emit_file(llvm_machine, llvm_module, ctx->path, idx, "asm", LLVMAssemblyFile);
+
+    tau_split_emit_file(llvm_machine, llvm_module, ctx->path, idx, "obj", LLVMObjectFile);
+
+    LLVMDisposeTargetMachine(llvm_machine);
+  }
+
+  LLVMDisposeModule(llvm_module);
+  LLVMDisposeMemoryBuffer(llvm_buffer);
+  LLVMContextDispose(llvm_context);
+}
+
+/**
+ * \brief Emits a range of partitions.
+ */
+static void tau_split_emit_range(void* arg, size_t begin, size_t end)
+{
+  tau_split_ctx_t* ctx = (tau_split_ctx_t*)arg;
+
+  // Partitions may run on threads busy with other files, report errors where
+  // the file's other diagnostics go.
+  FILE* prev_stream = tau_log_get_stream();
+  tau_log_set_stream(ctx->log_stream);
+
+  for (size_t i = begin; i < end; i++)
+    tau_time_it("LLVM:partition", tau_split_emit_partition(ctx, i));
+
+  tau_log_set_stream(prev_stream);
+}
+
+void tau_split_make_declaration(LLVMModuleRef llvm_module, LLVMValueRef llvm_function)
+{
+  size_t len = 0;
+  const char* name = LLVMGetValueName2(llvm_function, &len);
+  tau_string_t* name_str = tau_string_init_with_cstr_and_length(name, len);
+
+  LLVMValueRef llvm_decl = LLVMAddFunction(llvm_module, "", LLVMGlobalGetValueType(llvm_function));
+  LLVMSetFunctionCallConv(llvm_decl, LLVMGetFunctionCallConv(llvm_function));
+  LLVMSetVisibility(llvm_decl, LLVMGetVisibility(llvm_function));
+
+  LLVMReplaceAllUsesWith(llvm_function, llvm_decl);
+  LLVMDeleteFunction(llvm_function);
+
+  LLVMSetValueName2(llvm_decl, tau_string_begin(name_str), tau_string_length(name_str));
+
+  tau_string_free(name_str);
+}
+
+void tau_split_promote_locals(LLVMModuleRef llvm_module, tau_path_t* path)
+{
+  tau_string_t* path_str = tau_path_to_string(path);
+  uint64_t salt = tau_hash_digest(tau_string_begin(path_str), tau_string_length(path_str));
+  tau_string_free(path_str);
+
+  size_t idx = 0;
+
+  for (LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module); llvm_function != NULL; llvm_function = LLVMGetNextFunction(llvm_function), idx++)
+    if (!LLVMIsDeclaration(llvm_function) && tau_split_is_local(llvm_function))
+      tau_split_promote(llvm_function, salt, idx);
+
+  for (LLVMValueRef llvm_global = LLVMGetFirstGlobal(llvm_module); llvm_global != NULL; llvm_global = LLVMGetNextGlobal(llvm_global), idx++)
+    if (!LLVMIsDeclaration(llvm_global) && tau_split_is_local(llvm_global) && !LLVMIsGlobalConstant(llvm_global))
+      tau_split_promote(llvm_global, salt, idx);
+}
+
+size_t tau_split_partition_count(LLVMModuleRef llvm_module, size_t partition_count)
+{
+  TAU_ASSERT(partition_count > 0);
+
+  // Aliases may refer to definitions in any partition, so modules having them
+  // are emitted as a single partition.
+  if (LLVMGetFirstGlobalAlias(llvm_module) != NULL)
+    return 1;
+
+  size_t definition_count = 0;
+
+  for (LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module); llvm_function != NULL && definition_count < partition_count; llvm_function = LLVMGetNextFunction(llvm_function))
+    if (!LLVMIsDeclaration(llvm_function) && !tau_split_is_discardable(llvm_function))
+      definition_count++;
+
+  return TAU_MAX(definition_count, (size_t)1);
+}
+
+size_t tau_split_emit(LLVMModuleRef llvm_module, tau_path_t* path, size_t partition_count, bool emit_asm, tau_threadpool_t* pool)
+{
+  partition_count = tau_split_partition_count(llvm_module, partition_count);
+
+  tau_split_promote_locals(llvm_module, path);
+
+  size_t function_count = 0;
+  size_t definition_count = 0;
+  size_t total_size = 0;
+
+  for (LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module); llvm_function != NULL; llvm_function = LLVMGetNextFunction(llvm_function), function_count++)
+  {
+    if (LLVMIsDeclaration(llvm_function))
+      continue;
+
+    total_size += tau_split_function_size(llvm_function) + 1;
+
+    if (!tau_split_is_discardable(llvm_function))
+      definition_count++;
+  }
+
+  size_t* partitions = (size_t*)malloc(sizeof(size_t) * TAU_MAX(function_count, (size_t)1));
+  TAU_ASSERT(partitions != NULL);
+
+  // Functions are assigned to partitions in module order, so that every
+  // partition receives a contiguous run with about the same instruction count.
+  size_t acc_size = 0;
+  size_t definition_idx = 0;
+  size_t partition_idx = 0;
+  size_t i = 0;
+
+  for (LLVMValueRef llvm_function = LLVMGetFirstFunction(llvm_module); llvm_function != NULL; llvm_function = LLVMGetNextFunction(llvm_function), i++)
+  {
+    if (LLVMIsDeclaration(llvm_function) || tau_split_is_discardable(llvm_function))
+    {
+      partitions[i] = SPLIT_EVERY_PARTITION;
+      continue;
+    }
+
+    size_t idx = TAU_MIN(acc_size * partition_count / total_size, partition_count - 1);
+
+    // A large function must not leave the partitions it jumps over empty, and
+    // the remaining definitions must be enough to fill the remaining
+    // partitions.
+    idx = TAU_MIN(idx, partition_idx + 1);
+
+    if (definition_idx + partition_count > definition_count)
+      idx = TAU_MAX(idx, definition_idx + partition_count - definition_count);
+
+    partitions[i] = partition_idx = idx;
+    acc_size += tau_split_function_size(llvm_function) + 1;
+    definition_idx++;
+  }
+
+  LLVMMemoryBufferRef llvm_bitcode = LLVMWriteBitcodeToMemoryBuffer(llvm_module);
+
+  tau_split_ctx_t ctx = {
+    .bitcode = LLVMGetBufferStart(llvm_bitcode),
+    .bitcode_size = LLVMGetBufferSize(llvm_bitcode),
+    .partitions = partitions,
+    .function_count = function_count,
+    .path = path,
+    .emit_asm = emit_asm,
+    .log_stream = tau_log_get_stream()
+  };
+
+  if (pool == NULL)
+    tau_split_emit_range(&ctx, 0, partition_count);
+  else
+    tau_threadpool_parallel_for(pool, 0, partition_count, 1, tau_split_emit_range, &ctx);
+
+  LLVMDisposeMemoryBuffer(llvm_bitcode);
+  free(partitions);
+
+  return partition_count;
+}
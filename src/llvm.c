@@ -10,13 +10,17 @@
 #include "utils/common.h"
 #include "utils/io/log.h"
 
-static LLVMContextRef g_llvm_context = NULL;
 static LLVMTargetRef g_llvm_target = NULL;
-static LLVMTargetDataRef g_llvm_data = NULL;
-static LLVMTargetMachineRef g_llvm_machine = NULL;
 static char* g_llvm_target_triple = NULL;
 static char* g_llvm_cpu_name = NULL;
 static char* g_llvm_cpu_features = NULL;
+static LLVMCodeGenOptLevel g_llvm_codegen_level = LLVMCodeGenLevelDefault;
+
+// LLVM contexts and target machines must not be shared between threads, so
+// every thread creates its own on first use.
+static TAU_THREAD_LOCAL LLVMContextRef g_llvm_context = NULL;
+static TAU_THREAD_LOCAL LLVMTargetDataRef g_llvm_data = NULL;
+static TAU_THREAD_LOCAL LLVMTargetMachineRef g_llvm_machine = NULL;
 
 static void llvm_fatal_error_handler(const char* reason)
 {
@@ -24,7 +28,63 @@ static void llvm_fatal_error_handler(const char* reason)
   exit(EXIT_FAILURE);
 }
 
-bool tau_llvm_init(void)
+LLVMTargetMachineRef tau_llvm_create_machine(void)
+{
+  return LLVMCreateTargetMachine(
+    g_llvm_target,
+    g_llvm_target_triple,
+    g_llvm_cpu_name,
+    g_llvm_cpu_features,
+    g_llvm_codegen_level,
+    LLVMRelocDefault,
+    LLVMCodeModelDefault
+  );
+}
+
+/**
+ * \brief Creates the LLVM context, target machine and data layout of the
+ * current thread.
+ *
+ * \returns `true` if an error occurred, otherwise `false`.
+ */
+static bool tau_llvm_thread_init(void)
+{
+  g_llvm_context = LLVMContextCreate();
+  g_llvm_machine = tau_llvm_create_machine();
+
+  if (g_llvm_machine == NULL)
+  {
+    tau_log_error("LLVM", "Failed to create target machine.");
+    return true;
+  }
+
+  g_llvm_data = LLVMCreateTargetDataLayout(g_llvm_machine);
+
+  if (g_llvm_data == NULL)
+  {
+    tau_log_error("LLVM", "Failed to create target data layout.");
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Makes sure the per-thread LLVM objects of the current thread exist.
+ */
+static void tau_llvm_thread_ensure(void)
+{
+  if (g_llvm_context != NULL)
+    return;
+
+  if (tau_llvm_thread_init())
+  {
+    tau_log_fatal("LLVM", "Failed to initialize LLVM for thread.");
+    exit(EXIT_FAILURE);
+  }
+}
+
+bool tau_llvm_init(LLVMCodeGenOptLevel codegen_level)
 {
   char* tau_error_str = NULL;
 
@@ -60,7 +120,6 @@ bool tau_llvm_init(void)
 
   LLVMInstallFatalErrorHandler(llvm_fatal_error_handler);
 
-  g_llvm_context = LLVMContextCreate();
   g_llvm_target_triple = LLVMGetDefaultTargetTriple();
 
   if (LLVMGetTargetFromTriple(g_llvm_target_triple, &g_llvm_target, &tau_error_str))
@@ -72,48 +131,40 @@ bool tau_llvm_init(void)
 
   g_llvm_cpu_name = LLVMGetHostCPUName();
   g_llvm_cpu_features = LLVMGetHostCPUFeatures();
+  g_llvm_codegen_level = codegen_level;
 
-  g_llvm_machine = LLVMCreateTargetMachine(
-    g_llvm_target,
-    g_llvm_target_triple,
-    g_llvm_cpu_name,
-    g_llvm_cpu_features,
-    LLVMCodeGenLevelDefault,
-    LLVMRelocDefault,
-    LLVMCodeModelDefault
-  );
-
-  if (g_llvm_machine == NULL)
-  {
-    tau_log_error("LLVM", "Failed to create target machine.");
-    return true;
-  }
-
-  g_llvm_data = LLVMCreateTargetDataLayout(g_llvm_machine);
-
-  if (g_llvm_data == NULL)
-  {
-    tau_log_error("LLVM", "Failed to create target data layout.");
-    return true;
-  }
-
-  return false;
+  return tau_llvm_thread_init();
 }
 
 void tau_llvm_free(void)
 {
-  LLVMDisposeTargetData(g_llvm_data);
-  LLVMDisposeTargetMachine(g_llvm_machine);
+  tau_llvm_thread_free();
   LLVMDisposeMessage(g_llvm_cpu_features);
   LLVMDisposeMessage(g_llvm_cpu_name);
   LLVMDisposeMessage(g_llvm_target_triple);
-  LLVMContextDispose(g_llvm_context);
   LLVMResetFatalErrorHandler();
   LLVMShutdown();
 }
 
+void tau_llvm_thread_free(void)
+{
+  if (g_llvm_data != NULL)
+    LLVMDisposeTargetData(g_llvm_data);
+
+  if (g_llvm_machine != NULL)
+    LLVMDisposeTargetMachine(g_llvm_machine);
+
+  if (g_llvm_context != NULL)
+    LLVMContextDispose(g_llvm_context);
+
+  g_llvm_data = NULL;
+  g_llvm_machine = NULL;
+  g_llvm_context = NULL;
+}
+
 LLVMContextRef tau_llvm_get_context(void)
 {
+  tau_llvm_thread_ensure();
   return g_llvm_context;
 }
 
@@ -124,11 +175,13 @@ LLVMTargetRef tau_llvm_get_target(void)
 
 LLVMTargetDataRef tau_llvm_get_data(void)
 {
+  tau_llvm_thread_ensure();
   return g_llvm_data;
 }
 
 LLVMTargetMachineRef tau_llvm_get_machine(void)
 {
+  tau_llvm_thread_ensure();
   return g_llvm_machine;
 }
 
@@ -13,37 +13,46 @@ tau_nameres_ctx_t* tau_nameres_ctx_init(tau_symtable_t* symtable, tau_error_bag_
   TAU_CLEAROBJ(ctx);
 
   ctx->global_scope = symtable;
-  ctx->scopes = tau_stack_init();
+  ctx->scopes = tau_scopestack_init();
   ctx->errors = errors;
 
-  tau_stack_push(ctx->scopes, ctx->global_scope);
+  tau_scopestack_begin(ctx->scopes, NULL);
 
   return ctx;
 }
 
 void tau_nameres_ctx_free(tau_nameres_ctx_t* ctx)
 {
-  tau_stack_free(ctx->scopes);
+  tau_scopestack_free(ctx->scopes);
   free(ctx);
 }
 
-tau_symtable_t* tau_nameres_ctx_scope_begin(tau_nameres_ctx_t* ctx)
+void tau_nameres_ctx_scope_begin(tau_nameres_ctx_t* ctx)
 {
-  tau_symtable_t* current_scope = (tau_symtable_t*)tau_stack_top(ctx->scopes);
+  tau_scopestack_begin(ctx->scopes, NULL);
+}
 
-  tau_symtable_t* inner_scope = tau_symtable_init(current_scope);
+tau_symtable_t* tau_nameres_ctx_member_scope_begin(tau_nameres_ctx_t* ctx)
+{
+  // Member scopes are owned by the global symbol table.
+  tau_symtable_t* members = tau_symtable_init(ctx->global_scope);
 
-  tau_stack_push(ctx->scopes, inner_scope);
+  tau_scopestack_begin(ctx->scopes, members);
 
-  return inner_scope;
+  return members;
 }
 
 void tau_nameres_ctx_scope_end(tau_nameres_ctx_t* ctx)
 {
-  tau_stack_pop(ctx->scopes);
+  tau_scopestack_end(ctx->scopes);
+}
+
+tau_ast_node_t* tau_nameres_ctx_declare(tau_nameres_ctx_t* ctx, uint32_t id, tau_ast_node_t* node)
+{
+  return tau_scopestack_insert(ctx->scopes, id, node);
 }
 
-tau_symtable_t* tau_nameres_ctx_scope_cur(tau_nameres_ctx_t* ctx)
+tau_ast_node_t* tau_nameres_ctx_lookup(tau_nameres_ctx_t* ctx, uint32_t id)
 {
-  return (tau_symtable_t*)tau_stack_top(ctx->scopes);
+  return tau_scopestack_lookup(ctx->scopes, id);
 }
@@ -0,0 +1,208 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "stages/analysis/scopestack.h"
+
+#include "utils/interner.h"
+#include "utils/collections/hashmap.h"
+#include "utils/memory/arena.h"
+
+/// The initial number of names the name map can hold before growing.
+#define SCOPESTACK_INITIAL_CAPACITY ((size_t)128)
+
+/// The initial capacity of the binding and scope arrays.
+#define SCOPESTACK_INITIAL_STACK_CAPACITY ((size_t)64)
+
+/// Marks the absence of a binding.
+#define SCOPESTACK_NONE UINT32_MAX
+
+/**
+ * \brief Represents a name declared at least once.
+ */
+typedef struct tau_scopestack_name_t
+{
+  uint32_t id; // The interned identifier of the name.
+  uint32_t top; // Index of the innermost binding of the name or `SCOPESTACK_NONE`.
+} tau_scopestack_name_t;
+
+/**
+ * \brief Represents the binding of a name to its declaring node.
+ */
+typedef struct tau_scopestack_binding_t
+{
+  tau_scopestack_name_t* name; // Pointer to the bound name.
+  uint32_t depth; // The depth of the scope the binding was declared in.
+  uint32_t shadowed; // Index of the binding hidden by this one or `SCOPESTACK_NONE`.
+  tau_ast_node_t* node; // Pointer to the declaring node.
+} tau_scopestack_binding_t;
+
+/**
+ * \brief Represents an open scope.
+ */
+typedef struct tau_scopestack_scope_t
+{
+  size_t mark; // Number of bindings when the scope was opened.
+  tau_symtable_t* members; // Symbol table receiving the bindings of the scope or `NULL`.
+} tau_scopestack_scope_t;
+
+struct tau_scopestack_t
+{
+  tau_hashmap_t* names; // Map from identifiers to their names.
+  tau_arena_t* name_arena; // Arena holding the names.
+
+  tau_scopestack_binding_t* bindings; // Undo log of bindings in declaration order.
+  size_t binding_count; // The number of bindings.
+  size_t binding_capacity; // The capacity of the binding array.
+
+  tau_scopestack_scope_t* scopes; // The open scopes, innermost last.
+  size_t depth; // The number of open scopes.
+  size_t scope_capacity; // The capacity of the scope array.
+};
+
+/**
+ * \brief Computes the hash of an identifier.
+ */
+static uint64_t tau_scopestack_hash(uint32_t id)
+{
+  // Identifiers are dense, Fibonacci hashing spreads consecutive ones apart.
+  return ((uint64_t)id * 0x9E3779B97F4A7C15ULL) >> 32;
+}
+
+/**
+ * \brief Checks whether a name has an identifier.
+ */
+static bool tau_scopestack_match(const void* value, const void* key)
+{
+  return ((const tau_scopestack_name_t*)value)->id == *(const uint32_t*)key;
+}
+
+tau_scopestack_t* tau_scopestack_init(void)
+{
+  tau_scopestack_t* stack = (tau_scopestack_t*)malloc(sizeof(tau_scopestack_t));
+  TAU_ASSERT(stack != NULL);
+
+  stack->names = tau_hashmap_init_with_capacity(SCOPESTACK_INITIAL_CAPACITY);
+  stack->name_arena = tau_arena_init();
+
+  stack->binding_count = 0;
+  stack->binding_capacity = SCOPESTACK_INITIAL_STACK_CAPACITY;
+  stack->bindings = (tau_scopestack_binding_t*)malloc(sizeof(tau_scopestack_binding_t) * stack->binding_capacity);
+  TAU_ASSERT(stack->bindings != NULL);
+
+  stack->depth = 0;
+  stack->scope_capacity = SCOPESTACK_INITIAL_STACK_CAPACITY;
+  stack->scopes = (tau_scopestack_scope_t*)malloc(sizeof(tau_scopestack_scope_t) * stack->scope_capacity);
+  TAU_ASSERT(stack->scopes != NULL);
+
+  return stack;
+}
+
+void tau_scopestack_free(tau_scopestack_t* stack)
+{
+  tau_hashmap_free(stack->names);
+  tau_arena_free(stack->name_arena);
+  free(stack->bindings);
+  free(stack->scopes);
+  free(stack);
+}
+
+void tau_scopestack_begin(tau_scopestack_t* stack, tau_symtable_t* members)
+{
+  if (stack->depth == stack->scope_capacity)
+  {
+    stack->scope_capacity <<= 1;
+    stack->scopes = (tau_scopestack_scope_t*)realloc(stack->scopes, sizeof(tau_scopestack_scope_t) * stack->scope_capacity);
+    TAU_ASSERT(stack->scopes != NULL);
+  }
+
+  stack->scopes[stack->depth++] = (tau_scopestack_scope_t){
+    .mark = stack->binding_count,
+    .members = members
+  };
+}
+
+void tau_scopestack_end(tau_scopestack_t* stack)
+{
+  TAU_ASSERT(stack->depth > 0);
+
+  size_t mark = stack->scopes[--stack->depth].mark;
+
+  // Bindings are popped in reverse declaration order so that every name is
+  // restored to the binding it shadowed.
+  while (stack->binding_count > mark)
+  {
+    tau_scopestack_binding_t* binding = &stack->bindings[--stack->binding_count];
+
+    binding->name->top = binding->shadowed;
+  }
+}
+
+tau_ast_node_t* tau_scopestack_insert(tau_scopestack_t* stack, uint32_t id, tau_ast_node_t* node)
+{
+  TAU_ASSERT(stack->depth > 0);
+  TAU_ASSERT(id != TAU_INTERNER_NULL_ID);
+
+  tau_hashmap_entry_t* entry = tau_hashmap_find(stack->names, tau_scopestack_hash(id), tau_scopestack_match, &id);
+  tau_scopestack_name_t* name = (tau_scopestack_name_t*)entry->value;
+
+  if (name == NULL)
+  {
+    name = (tau_scopestack_name_t*)tau_arena_alloc(stack->name_arena, sizeof(tau_scopestack_name_t));
+    TAU_ASSERT(name != NULL);
+
+    name->id = id;
+    name->top = SCOPESTACK_NONE;
+
+    tau_hashmap_insert(stack->names, entry, name);
+  }
+
+  if (name->top != SCOPESTACK_NONE && stack->bindings[name->top].depth == stack->depth)
+    return stack->bindings[name->top].node;
+
+  if (stack->binding_count == stack->binding_capacity)
+  {
+    stack->binding_capacity <<= 1;
+    stack->bindings = (tau_scopestack_binding_t*)realloc(stack->bindings, sizeof(tau_scopestack_binding_t) * stack->binding_capacity);
+    TAU_ASSERT(stack->bindings != NULL);
+  }
+
+  TAU_ASSERT(stack->binding_count < SCOPESTACK_NONE);
+
+  stack->bindings[stack->binding_count] = (tau_scopestack_binding_t){
+    .name = name,
+    .depth = (uint32_t)stack->depth,
+    .shadowed = name->top,
+    .node = node
+  };
+
+  name->top = (uint32_t)stack->binding_count++;
+
+  tau_symtable_t* members = stack->scopes[stack->depth - 1].members;
+
+  if (members != NULL)
+  {
+    tau_symbol_t* collision = tau_symtable_insert(members, tau_symbol_init(id, node));
+    TAU_ASSERT(collision == NULL);
+  }
+
+  return NULL;
+}
+
+tau_ast_node_t* tau_scopestack_lookup(tau_scopestack_t* stack, uint32_t id)
+{
+  tau_scopestack_name_t* name = (tau_scopestack_name_t*)tau_hashmap_get(stack->names, tau_scopestack_hash(id), tau_scopestack_match, &id);
+
+  if (name == NULL || name->top == SCOPESTACK_NONE)
+    return NULL;
+
+  return stack->bindings[name->top].node;
+}
+
+size_t tau_scopestack_depth(tau_scopestack_t* stack)
+{
+  return stack->depth;
+}
@@ -7,9 +7,9 @@
 
 #include "stages/analysis/symtable.h"
 
-#include "utils/hash.h"
+#include "utils/interner.h"
 
-/// The initial number of buckets in a symbol table.
+/// The initial number of buckets in a symbol table, must be a power of two.
 #define SYMTABLE_INITIAL_CAPACITY ((size_t)16)
 
 /// The load factor threshold for symbol table resizing.
@@ -26,8 +26,7 @@
  */
 static tau_symbol_t* tau_symtable_insert_no_expand(tau_symtable_t* table, tau_symbol_t* new_sym)
 {
-  size_t h = (size_t)tau_hash_digest(new_sym->id, new_sym->len);
-  size_t idx = h % table->capacity;
+  size_t idx = (size_t)tau_interner_hash(new_sym->id) & (table->capacity - 1);
 
   if (table->buckets[idx] == NULL)
   {
@@ -42,7 +41,7 @@ static tau_symbol_t* tau_symtable_insert_no_expand(tau_symtable_t* table, tau_sy
   tau_symbol_t* last = NULL;
 
   for (tau_symbol_t* sym = table->buckets[idx]; sym != NULL; last = sym, sym = sym->next)
-    if (sym->len == new_sym->len && strncmp(sym->id, new_sym->id, sym->len) == 0)
+    if (sym->id == new_sym->id)
       return sym;
 
   TAU_ASSERT(last != NULL);
@@ -90,24 +89,20 @@ static void tau_symtable_expand(tau_symtable_t* table, size_t new_capacity)
   free(symbols);
 }
 
-tau_symbol_t* tau_symbol_init(const char* id, size_t len, tau_ast_node_t* node)
+tau_symbol_t* tau_symbol_init(uint32_t id, tau_ast_node_t* node)
 {
+  TAU_ASSERT(id != TAU_INTERNER_NULL_ID);
+
   tau_symbol_t* sym = (tau_symbol_t*)malloc(sizeof(tau_symbol_t));
   TAU_ASSERT(sym != NULL);
 
   sym->parent = NULL;
   sym->id = id;
-  sym->len = len;
   sym->node = node;
 
   return sym;
 }
 
-tau_symbol_t* tau_symbol_init_with_str_view(tau_string_view_t id, tau_ast_node_t* node)
-{
-  return tau_symbol_init(id.buf, id.len, node);
-}
-
 void tau_symbol_free(tau_symbol_t* sym)
 {
   free(sym);
@@ -155,28 +150,22 @@ tau_symbol_t* tau_symtable_insert(tau_symtable_t* table, tau_symbol_t* new_sym)
   return tau_symtable_insert_no_expand(table, new_sym);
 }
 
-tau_symbol_t* tau_symtable_get(tau_symtable_t* table, const char* id, size_t len)
+tau_symbol_t* tau_symtable_get(tau_symtable_t* table, uint32_t id)
 {
-  size_t h = (size_t)tau_hash_digest(id, len);
-  size_t idx = h % table->capacity;
+  size_t idx = (size_t)tau_interner_hash(id) & (table->capacity - 1);
 
   for (tau_symbol_t* sym = table->buckets[idx]; sym != NULL; sym = sym->next)
-    if (sym->len == len && strncmp(sym->id, id, sym->len) == 0)
+    if (sym->id == id)
       return sym;
 
   return NULL;
 }
 
-tau_symbol_t* tau_symtable_get_with_str_view(tau_symtable_t* table, tau_string_view_t id)
-{
-  return tau_symtable_get(table, id.buf, id.len);
-}
-
-tau_symbol_t* tau_symtable_lookup(tau_symtable_t* table, const char* id, size_t len)
+tau_symbol_t* tau_symtable_lookup(tau_symtable_t* table, uint32_t id)
 {
   while (table != NULL)
   {
-    tau_symbol_t* sym = tau_symtable_get(table, id, len);
+    tau_symbol_t* sym = tau_symtable_get(table, id);
 
     if (sym != NULL)
       return sym;
@@ -187,11 +176,6 @@ tau_symbol_t* tau_symtable_lookup(tau_symtable_t* table, const char* id, size_t
   return NULL;
 }
 
-tau_symbol_t* tau_symtable_lookup_with_str_view(tau_symtable_t* table, tau_string_view_t id)
-{
-  return tau_symtable_lookup(table, id.buf, id.len);
-}
-
 void tau_symtable_merge(tau_symtable_t* dest, tau_symtable_t* src)
 {
   size_t new_capacity = dest->capacity;
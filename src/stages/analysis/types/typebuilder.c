@@ -1,6 +1,6 @@
 /**
  * \file
- * 
+ *
  * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
  */
@@ -9,7 +9,28 @@
 
 #include "ast/ast.h"
 #include "utils/hash.h"
-#include "utils/collections/set.h"
+#include "utils/collections/hashmap.h"
+
+/// The initial number of types the type table can hold before growing.
+#define TYPEBUILDER_INITIAL_CAPACITY ((size_t)128)
+
+/**
+ * \brief Represents the structural key of a constructed type.
+ *
+ * \details Fields which are not used by a type kind are zero.
+ */
+typedef struct tau_typebuilder_key_t
+{
+  tau_typedesc_kind_t kind; // The kind of the type.
+  tau_typedesc_t* base_type; // The base type of modifiers, vectors and matrices or the return type of functions.
+  size_t dims[2]; // The length of arrays, the size of vectors or the rows and columns of matrices.
+  tau_typedesc_t** types; // The parameter types of functions or the field types of unions.
+  size_t type_count; // The number of types in `types`.
+  bool is_vararg; // Whether a function type is variadic.
+  tau_callconv_kind_t callconv; // The calling convention of a function type.
+  tau_ast_node_t* node; // The declaration node of structs, unions and enums.
+  uint64_t id; // The identifier of type variables.
+} tau_typebuilder_key_t;
 
 struct tau_typebuilder_t
 {
@@ -35,222 +56,138 @@ struct tau_typebuilder_t
   tau_typedesc_t* desc_unit;
   tau_typedesc_t* desc_poison;
 
-  tau_set_t* tau_set_mut;
-  tau_set_t* tau_set_ptr;
-  tau_set_t* tau_set_array;
-  tau_set_t* tau_set_ref;
-  tau_set_t* tau_set_opt;
-  tau_set_t* tau_set_fun;
-  tau_set_t* tau_set_vec;
-  tau_set_t* tau_set_mat;
-  tau_set_t* tau_set_struct;
-  tau_set_t* tau_set_union;
-  tau_set_t* tau_set_enum;
-  tau_set_t* tau_set_var;
+  tau_hashmap_t* types; // Hash map of all constructed types keyed by their structure.
 };
 
-static int tau_typebuilder_cmp_mut(const void* lhs, const void* rhs)
-{
-  return (int)(((tau_typedesc_mut_t*)lhs)->base_type - ((tau_typedesc_mut_t*)rhs)->base_type);
-}
-
-static int tau_typebuilder_cmp_ptr(const void* lhs, const void* rhs)
-{
-  return (int)(((tau_typedesc_ptr_t*)lhs)->base_type - ((tau_typedesc_ptr_t*)rhs)->base_type);
-}
-
-static int tau_typebuilder_cmp_array(const void* lhs, const void* rhs)
+/**
+ * \brief Computes the structural hash of a key.
+ *
+ * \details Component types are already unique, so they are hashed by address.
+ * Small fields are packed into shared words, which only costs distribution for
+ * values too large to occur in practice.
+ */
+static uint64_t tau_typebuilder_hash(const tau_typebuilder_key_t* key)
 {
-  tau_typedesc_array_t* lhs_desc = (tau_typedesc_array_t*)lhs;
-  tau_typedesc_array_t* rhs_desc = (tau_typedesc_array_t*)rhs;
+  uint64_t header = (uint64_t)key->kind | ((uint64_t)key->is_vararg << 8) | ((uint64_t)key->callconv << 9) | ((uint64_t)key->type_count << 16);
+  uint64_t dims = (uint64_t)key->dims[0] | ((uint64_t)key->dims[1] << 32);
 
-  // TODO: fix integer overflow
-  int cmp1 = (int)(lhs_desc->base_type - rhs_desc->base_type);
-  int cmp2 = (int)lhs_desc->length - (int)rhs_desc->length;
+  uint64_t h = tau_hash_combine_with_hash(header, (uint64_t)(uintptr_t)key->base_type);
+  h = tau_hash_combine_with_hash(h, dims);
+  h = tau_hash_combine_with_hash(h, (uint64_t)(uintptr_t)key->node ^ key->id);
 
-  if (cmp1 != 0)
-    return cmp1;
+  for (size_t i = 0; i < key->type_count; i++)
+    h = tau_hash_combine_with_hash(h, (uint64_t)(uintptr_t)key->types[i]);
 
-  return cmp2;
+  return h;
 }
 
-static int tau_typebuilder_cmp_ref(const void* lhs, const void* rhs)
+/**
+ * \brief Checks whether a vector of types holds exactly the given types.
+ */
+static bool tau_typebuilder_types_equal(tau_vector_t* vec, tau_typedesc_t** types, size_t count)
 {
-  return (int)(((tau_typedesc_ref_t*)lhs)->base_type - ((tau_typedesc_ref_t*)rhs)->base_type);
-}
+  if ((vec == NULL ? 0 : tau_vector_size(vec)) != count)
+    return false;
 
-static int tau_typebuilder_cmp_opt(const void* lhs, const void* rhs)
-{
-  return (int)(((tau_typedesc_opt_t*)lhs)->base_type - ((tau_typedesc_opt_t*)rhs)->base_type);
+  for (size_t i = 0; i < count; i++)
+    if (tau_vector_get(vec, i) != types[i])
+      return false;
+
+  return true;
 }
 
-static int tau_typebuilder_cmp_fun(const void* lhs, const void* rhs)
+/**
+ * \brief Checks whether a type is structurally equal to a key.
+ */
+static bool tau_typebuilder_equals(tau_typedesc_t* desc, const tau_typebuilder_key_t* key)
 {
-  tau_typedesc_fun_t* lhs_desc = (tau_typedesc_fun_t*)lhs;
-  tau_typedesc_fun_t* rhs_desc = (tau_typedesc_fun_t*)rhs;
+  if (desc->kind != key->kind)
+    return false;
 
-  uint64_t lhs_hash = tau_hash_digest(&lhs_desc->return_type, sizeof(tau_typedesc_t*));
-
-  TAU_VECTOR_FOR_LOOP(i, lhs_desc->param_types)
+  switch (key->kind)
+  {
+  case TAU_TYPEDESC_MUT:
+  case TAU_TYPEDESC_PTR:
+  case TAU_TYPEDESC_REF:
+  case TAU_TYPEDESC_OPT:
+    return ((tau_typedesc_modif_t*)desc)->base_type == key->base_type;
+  case TAU_TYPEDESC_ARRAY:
   {
-    tau_typedesc_t* param_desc = (tau_typedesc_t*)tau_vector_get(lhs_desc->param_types, i);
-    lhs_hash = tau_hash_combine_with_data(lhs_hash, &param_desc, sizeof(tau_typedesc_t*));
+    tau_typedesc_array_t* array_desc = (tau_typedesc_array_t*)desc;
+    return array_desc->base_type == key->base_type && array_desc->length == key->dims[0];
   }
-
-  lhs_hash = tau_hash_combine_with_data(lhs_hash, &lhs_desc->is_vararg, sizeof(bool));
-  lhs_hash = tau_hash_combine_with_data(lhs_hash, &lhs_desc->callconv, sizeof(tau_callconv_kind_t));
-
-  uint64_t rhs_hash = tau_hash_digest(&rhs_desc->return_type, sizeof(tau_typedesc_t*));
-
-  TAU_VECTOR_FOR_LOOP(i, rhs_desc->param_types)
+  case TAU_TYPEDESC_VEC:
   {
-    tau_typedesc_t* param_desc = (tau_typedesc_t*)tau_vector_get(rhs_desc->param_types, i);
-    rhs_hash = tau_hash_combine_with_data(rhs_hash, &param_desc, sizeof(tau_typedesc_t*));
+    tau_typedesc_vec_t* vec_desc = (tau_typedesc_vec_t*)desc;
+    return vec_desc->base_type == key->base_type && vec_desc->size == key->dims[0];
   }
-
-  rhs_hash = tau_hash_combine_with_data(rhs_hash, &rhs_desc->is_vararg, sizeof(bool));
-  rhs_hash = tau_hash_combine_with_data(rhs_hash, &rhs_desc->callconv, sizeof(tau_callconv_kind_t));
-
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
-}
-
-static int tau_typebuilder_cmp_vec(const void* lhs, const void* rhs)
-{
-  tau_typedesc_vec_t* lhs_desc = (tau_typedesc_vec_t*)lhs;
-  tau_typedesc_vec_t* rhs_desc = (tau_typedesc_vec_t*)rhs;
-
-  uint64_t lhs_hash = tau_hash_digest(&lhs_desc->size, sizeof(size_t));
-  uint64_t rhs_hash = tau_hash_digest(&rhs_desc->size, sizeof(size_t));
-
-  lhs_hash = tau_hash_combine_with_data(lhs_hash, &lhs_desc->base_type, sizeof(tau_typedesc_t*));
-  rhs_hash = tau_hash_combine_with_data(rhs_hash, &rhs_desc->base_type, sizeof(tau_typedesc_t*));
-
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
-}
-
-static int tau_typebuilder_cmp_mat(const void* lhs, const void* rhs)
-{
-  tau_typedesc_mat_t* lhs_desc = (tau_typedesc_mat_t*)lhs;
-  tau_typedesc_mat_t* rhs_desc = (tau_typedesc_mat_t*)rhs;
-
-  uint64_t lhs_hash = tau_hash_digest(&lhs_desc->rows, sizeof(size_t));
-  uint64_t rhs_hash = tau_hash_digest(&rhs_desc->rows, sizeof(size_t));
-
-  lhs_hash = tau_hash_combine_with_data(lhs_hash, &lhs_desc->cols, sizeof(size_t));
-  rhs_hash = tau_hash_combine_with_data(rhs_hash, &rhs_desc->cols, sizeof(size_t));
-
-  lhs_hash = tau_hash_combine_with_data(lhs_hash, &lhs_desc->base_type, sizeof(tau_typedesc_t*));
-  rhs_hash = tau_hash_combine_with_data(rhs_hash, &rhs_desc->base_type, sizeof(tau_typedesc_t*));
-
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
-}
-
-static int tau_typebuilder_cmp_struct(const void* lhs, const void* rhs)
-{
-  tau_typedesc_struct_t* lhs_desc = (tau_typedesc_struct_t*)lhs;
-  tau_typedesc_struct_t* rhs_desc = (tau_typedesc_struct_t*)rhs;
-
-  tau_ast_decl_struct_t* lhs_node = (tau_ast_decl_struct_t*)lhs_desc->node;
-  tau_ast_decl_struct_t* rhs_node = (tau_ast_decl_struct_t*)rhs_desc->node;
-
-  tau_string_view_t lhs_id_view = tau_token_to_string_view(lhs_node->id->tok);
-  tau_string_view_t rhs_id_view = tau_token_to_string_view(rhs_node->id->tok);
-
-  const void* lhs_id_view_begin = tau_string_view_begin(lhs_id_view);
-  const void* rhs_id_view_begin = tau_string_view_begin(rhs_id_view);
-
-  size_t lhs_id_view_len = tau_string_view_length(lhs_id_view);
-  size_t rhs_id_view_len = tau_string_view_length(rhs_id_view);
-
-  uint64_t lhs_hash = tau_hash_digest(lhs_id_view_begin, lhs_id_view_len);
-  uint64_t rhs_hash = tau_hash_digest(rhs_id_view_begin, rhs_id_view_len);
-
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
-}
-
-static int tau_typebuilder_cmp_union(const void* lhs, const void* rhs)
-{
-  tau_typedesc_union_t* lhs_desc = (tau_typedesc_union_t*)lhs;
-  tau_typedesc_union_t* rhs_desc = (tau_typedesc_union_t*)rhs;
-
-  uint64_t lhs_hash = tau_hash_digest(&lhs_desc->node, sizeof(tau_ast_node_t*));
-
-  TAU_VECTOR_FOR_LOOP(i, lhs_desc->field_types)
+  case TAU_TYPEDESC_MAT:
   {
-    tau_typedesc_t* field_desc = (tau_typedesc_t*)tau_vector_get(lhs_desc->field_types, i);
-    lhs_hash = tau_hash_combine_with_data(lhs_hash, &field_desc, sizeof(tau_typedesc_t*));
+    tau_typedesc_mat_t* mat_desc = (tau_typedesc_mat_t*)desc;
+    return mat_desc->base_type == key->base_type && mat_desc->rows == key->dims[0] && mat_desc->cols == key->dims[1];
   }
-
-  uint64_t rhs_hash = tau_hash_digest(&rhs_desc->node, sizeof(tau_ast_node_t*));
-
-  TAU_VECTOR_FOR_LOOP(i, rhs_desc->field_types)
+  case TAU_TYPEDESC_FUN:
   {
-    tau_typedesc_t* field_desc = (tau_typedesc_t*)tau_vector_get(rhs_desc->field_types, i);
-    rhs_hash = tau_hash_combine_with_data(rhs_hash, &field_desc, sizeof(tau_typedesc_t*));
+    tau_typedesc_fun_t* fun_desc = (tau_typedesc_fun_t*)desc;
+    return fun_desc->return_type == key->base_type &&
+           fun_desc->is_vararg == key->is_vararg &&
+           fun_desc->callconv == key->callconv &&
+           tau_typebuilder_types_equal(fun_desc->param_types, key->types, key->type_count);
+  }
+  case TAU_TYPEDESC_STRUCT:
+  case TAU_TYPEDESC_ENUM:
+    // Structs and enums are nominal, their declaration identifies them.
+    return ((tau_typedesc_decl_t*)desc)->node == key->node;
+  case TAU_TYPEDESC_UNION:
+    return ((tau_typedesc_union_t*)desc)->node == key->node &&
+           tau_typebuilder_types_equal(((tau_typedesc_union_t*)desc)->field_types, key->types, key->type_count);
+  case TAU_TYPEDESC_VAR:
+    return ((tau_typedesc_var_t*)desc)->id == key->id;
+  default: TAU_UNREACHABLE();
   }
 
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
+  return false;
 }
 
-static int tau_typebuilder_cmp_enum(const void* lhs, const void* rhs)
+/**
+ * \brief Checks whether a type has a structural key.
+ */
+static bool tau_typebuilder_match(const void* value, const void* key)
 {
-  tau_typedesc_enum_t* lhs_desc = (tau_typedesc_enum_t*)lhs;
-  tau_typedesc_enum_t* rhs_desc = (tau_typedesc_enum_t*)rhs;
-
-  uint64_t lhs_hash = tau_hash_digest(&lhs_desc->node, sizeof(tau_ast_node_t*));
-  uint64_t rhs_hash = tau_hash_digest(&rhs_desc->node, sizeof(tau_ast_node_t*));
-
-  if (lhs_hash < rhs_hash)
-    return -1;
-
-  if (lhs_hash > rhs_hash)
-    return 1;
-
-  return 0;
+  return tau_typebuilder_equals((tau_typedesc_t*)value, (const tau_typebuilder_key_t*)key);
 }
 
-static int tau_typebuilder_cmp_var(const void* lhs, const void* rhs)
+/**
+ * \brief Finds the slot of a type in the type table.
+ *
+ * \details If the type has not been constructed yet, the returned slot is the
+ * empty slot where it belongs, so that the type can be inserted with
+ * `tau_typebuilder_insert`.
+ *
+ * \param[in] builder Pointer to the type builder.
+ * \param[in] key Pointer to the structural key of the type.
+ * \returns Pointer to the slot of the type or to the empty slot where it
+ * belongs.
+ */
+static tau_hashmap_entry_t* tau_typebuilder_find(tau_typebuilder_t* builder, const tau_typebuilder_key_t* key)
 {
-  tau_typedesc_var_t* lhs_desc = (tau_typedesc_var_t*)lhs;
-  tau_typedesc_var_t* rhs_desc = (tau_typedesc_var_t*)rhs;
-
-  if (lhs_desc->id < rhs_desc->id)
-    return -1;
+  return tau_hashmap_find(builder->types, tau_typebuilder_hash(key), tau_typebuilder_match, key);
+}
 
-  if (lhs_desc->id > rhs_desc->id)
-    return 1;
+/**
+ * \brief Stores a newly constructed type in the empty slot returned by
+ * `tau_typebuilder_find`.
+ *
+ * \param[in,out] builder Pointer to the type builder.
+ * \param[in,out] entry Pointer to the slot.
+ * \param[in] desc Pointer to the type.
+ * \returns Pointer to the type.
+ */
+static tau_typedesc_t* tau_typebuilder_insert(tau_typebuilder_t* builder, tau_hashmap_entry_t* entry, tau_typedesc_t* desc)
+{
+  tau_hashmap_insert(builder->types, entry, desc);
 
-  return 0;
+  return desc;
 }
 
 tau_typebuilder_t* tau_typebuilder_init(LLVMContextRef llvm_context, LLVMTargetDataRef llvm_layout)
@@ -304,18 +241,7 @@ tau_typebuilder_t* tau_typebuilder_init(LLVMContextRef llvm_context, LLVMTargetD
   LLVMStructSetBody(llvm_c128_type, (LLVMTypeRef[]){ builder->desc_f64->llvm_type, builder->desc_f64->llvm_type }, 2, false);
   builder->desc_c128->llvm_type = llvm_c128_type;
 
-  builder->tau_set_mut    = tau_set_init(tau_typebuilder_cmp_mut   );
-  builder->tau_set_ptr    = tau_set_init(tau_typebuilder_cmp_ptr   );
-  builder->tau_set_array  = tau_set_init(tau_typebuilder_cmp_array );
-  builder->tau_set_ref    = tau_set_init(tau_typebuilder_cmp_ref   );
-  builder->tau_set_opt    = tau_set_init(tau_typebuilder_cmp_opt   );
-  builder->tau_set_fun    = tau_set_init(tau_typebuilder_cmp_fun   );
-  builder->tau_set_vec    = tau_set_init(tau_typebuilder_cmp_vec   );
-  builder->tau_set_mat    = tau_set_init(tau_typebuilder_cmp_mat   );
-  builder->tau_set_struct = tau_set_init(tau_typebuilder_cmp_struct);
-  builder->tau_set_union  = tau_set_init(tau_typebuilder_cmp_union );
-  builder->tau_set_enum   = tau_set_init(tau_typebuilder_cmp_enum  );
-  builder->tau_set_var    = tau_set_init(tau_typebuilder_cmp_var   );
+  builder->types = tau_hashmap_init_with_capacity(TYPEBUILDER_INITIAL_CAPACITY);
 
   return builder;
 }
@@ -341,32 +267,8 @@ void tau_typebuilder_free(tau_typebuilder_t* builder)
   tau_typedesc_free(builder->desc_unit);
   tau_typedesc_free(builder->desc_poison);
 
-  tau_set_for_each(builder->tau_set_mut,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_ptr,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_array,  (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_ref,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_opt,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_fun,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_vec,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_mat,    (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_struct, (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_union,  (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_enum,   (tau_set_for_each_func_t)tau_typedesc_free);
-  tau_set_for_each(builder->tau_set_var,    (tau_set_for_each_func_t)tau_typedesc_free);
-
-  tau_set_free(builder->tau_set_mut);
-  tau_set_free(builder->tau_set_ptr);
-  tau_set_free(builder->tau_set_array);
-  tau_set_free(builder->tau_set_ref);
-  tau_set_free(builder->tau_set_opt);
-  tau_set_free(builder->tau_set_fun);
-  tau_set_free(builder->tau_set_vec);
-  tau_set_free(builder->tau_set_mat);
-  tau_set_free(builder->tau_set_struct);
-  tau_set_free(builder->tau_set_union);
-  tau_set_free(builder->tau_set_enum);
-  tau_set_free(builder->tau_set_var);
-
+  tau_hashmap_for_each(builder->types, (tau_hashmap_for_each_func_t)tau_typedesc_free);
+  tau_hashmap_free(builder->types);
   free(builder);
 }
 
@@ -374,158 +276,123 @@ tau_typedesc_t* tau_typebuilder_build_mut(tau_typebuilder_t* builder, tau_typede
 {
   TAU_ASSERT(tau_typedesc_can_add_mut(base_type));
 
-  tau_typedesc_mut_t* desc = tau_typedesc_mut_init();
-  desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_mut, desc);
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_MUT, .base_type = base_type };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
+  tau_typedesc_mut_t* desc = tau_typedesc_mut_init();
+  desc->base_type = base_type;
   desc->llvm_type = base_type->llvm_type;
 
-  tau_set_add(builder->tau_set_mut, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_ptr(tau_typebuilder_t* builder, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_can_add_ptr(base_type));
 
-  tau_typedesc_ptr_t* desc = tau_typedesc_ptr_init();
-  desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_ptr, desc);
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_PTR, .base_type = base_type };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
+  tau_typedesc_ptr_t* desc = tau_typedesc_ptr_init();
+  desc->base_type = base_type;
   desc->llvm_type = LLVMPointerType(base_type->llvm_type, 0);
 
-  tau_set_add(builder->tau_set_ptr, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_array(tau_typebuilder_t* builder, size_t length, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_can_add_array(base_type));
 
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_ARRAY, .base_type = base_type, .dims = { length } };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_array_t* desc = tau_typedesc_array_init();
   desc->base_type = base_type;
   desc->length = length;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_array, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   desc->llvm_type = LLVMArrayType2(base_type->llvm_type, length);
 
-  tau_set_add(builder->tau_set_array, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_ref(tau_typebuilder_t* builder, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_can_add_ref(base_type));
 
-  tau_typedesc_ref_t* desc = tau_typedesc_ref_init();
-  desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_ref, desc);
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_REF, .base_type = base_type };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
+  tau_typedesc_ref_t* desc = tau_typedesc_ref_init();
+  desc->base_type = base_type;
   desc->llvm_type = LLVMPointerType(base_type->llvm_type, 0);
 
-  tau_set_add(builder->tau_set_ref, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_opt(tau_typebuilder_t* builder, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_can_add_opt(base_type));
 
-  tau_typedesc_opt_t* desc = tau_typedesc_opt_init();
-  desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_opt, desc);
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_OPT, .base_type = base_type };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
+  tau_typedesc_opt_t* desc = tau_typedesc_opt_init();
+  desc->base_type = base_type;
   desc->llvm_type = LLVMStructTypeInContext(builder->llvm_context, (LLVMTypeRef[]){ builder->desc_bool->llvm_type, base_type->llvm_type }, 2, false);
 
-  tau_set_add(builder->tau_set_opt, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_vec(tau_typebuilder_t* builder, size_t size, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_is_integer(base_type) || tau_typedesc_is_float(base_type));
 
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_VEC, .base_type = base_type, .dims = { size } };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_vec_t* desc = tau_typedesc_vec_init();
   desc->size = size;
   desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_vec, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   desc->llvm_type = LLVMVectorType(base_type->llvm_type, (uint32_t)size);
 
-  tau_set_add(builder->tau_set_vec, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_mat(tau_typebuilder_t* builder, size_t rows, size_t cols, tau_typedesc_t* base_type)
 {
   TAU_ASSERT(tau_typedesc_is_integer(base_type) || tau_typedesc_is_float(base_type));
 
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_MAT, .base_type = base_type, .dims = { rows, cols } };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_mat_t* desc = tau_typedesc_mat_init();
   desc->rows = rows;
   desc->cols = cols;
   desc->base_type = base_type;
-
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_mat, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   desc->llvm_type = LLVMVectorType(base_type->llvm_type, (uint32_t)(rows * cols));
 
-  tau_set_add(builder->tau_set_mat, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_i8(tau_typebuilder_t* builder)
@@ -638,20 +505,26 @@ tau_typedesc_t* tau_typebuilder_build_poison(tau_typebuilder_t* builder)
 
 tau_typedesc_t* tau_typebuilder_build_fun(tau_typebuilder_t* builder, tau_typedesc_t* return_type, tau_typedesc_t* param_types[], size_t param_count, bool is_vararg, tau_callconv_kind_t callconv)
 {
+  tau_typebuilder_key_t key = {
+    .kind = TAU_TYPEDESC_FUN,
+    .base_type = return_type,
+    .types = param_types,
+    .type_count = param_count,
+    .is_vararg = is_vararg,
+    .callconv = callconv
+  };
+
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_fun_t* desc = tau_typedesc_fun_init();
   desc->return_type = return_type;
   desc->param_types = param_count == 0 ? NULL : tau_vector_init_from_buffer(param_types, param_count);
   desc->is_vararg = is_vararg;
   desc->callconv = callconv;
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_fun, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   LLVMTypeRef* llvm_param_types = NULL;
 
   if (param_count > 0)
@@ -672,25 +545,21 @@ tau_typedesc_t* tau_typebuilder_build_fun(tau_typebuilder_t* builder, tau_typede
   if (llvm_param_types != NULL)
     free(llvm_param_types);
 
-  tau_set_add(builder->tau_set_fun, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_struct(tau_typebuilder_t* builder, tau_ast_node_t* node, tau_typedesc_t* field_types[], size_t field_count)
 {
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_STRUCT, .node = node };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_struct_t* desc = tau_typedesc_struct_init();
   desc->node = node;
   desc->field_types = field_count == 0 ? NULL : tau_vector_init_from_buffer(field_types, field_count);
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_struct, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   LLVMTypeRef* llvm_field_types = NULL;
 
   if (field_count > 0)
@@ -711,25 +580,21 @@ tau_typedesc_t* tau_typebuilder_build_struct(tau_typebuilder_t* builder, tau_ast
   if (llvm_field_types != NULL)
     free(llvm_field_types);
 
-  tau_set_add(builder->tau_set_struct, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_struct_opaque(tau_typebuilder_t* builder, tau_ast_node_t* node)
 {
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_STRUCT, .node = node };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_struct_t* desc = tau_typedesc_struct_init();
   desc->node = node;
   desc->field_types = NULL;
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_struct, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   tau_ast_decl_struct_t* struct_node = (tau_ast_decl_struct_t*)node;
   tau_string_t* id_str = tau_token_to_string(struct_node->id->tok);
 
@@ -737,25 +602,27 @@ tau_typedesc_t* tau_typebuilder_build_struct_opaque(tau_typebuilder_t* builder,
 
   tau_string_free(id_str);
 
-  tau_set_add(builder->tau_set_struct, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_union(tau_typebuilder_t* builder, tau_ast_node_t* node, tau_typedesc_t* field_types[], size_t field_count)
 {
+  tau_typebuilder_key_t key = {
+    .kind = TAU_TYPEDESC_UNION,
+    .types = field_types,
+    .type_count = field_count,
+    .node = node
+  };
+
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
+
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
+
   tau_typedesc_union_t* desc = tau_typedesc_union_init();
   desc->node = node;
   desc->field_types = field_count == 0 ? NULL : tau_vector_init_from_buffer(field_types, field_count);
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_union, desc);
-
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
   LLVMTypeRef max_field_type = NULL;
   size_t max_field_size = 0;
 
@@ -772,23 +639,19 @@ tau_typedesc_t* tau_typebuilder_build_union(tau_typebuilder_t* builder, tau_ast_
 
   desc->llvm_type = max_field_type;
 
-  tau_set_add(builder->tau_set_union, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_enum(tau_typebuilder_t* builder, tau_ast_node_t* node)
 {
-  tau_typedesc_enum_t* desc = tau_typedesc_enum_init();
-  desc->node = node;
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_ENUM, .node = node };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_enum, desc);
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
+  tau_typedesc_enum_t* desc = tau_typedesc_enum_init();
+  desc->node = node;
 
   size_t field_count = tau_vector_size(((tau_ast_decl_enum_t*)node)->members);
 
@@ -798,32 +661,27 @@ tau_typedesc_t* tau_typebuilder_build_enum(tau_typebuilder_t* builder, tau_ast_n
   else if (field_count <= UINT64_MAX) desc->llvm_type = builder->desc_u64->llvm_type;
   else TAU_UNREACHABLE();
 
-  tau_set_add(builder->tau_set_enum, desc);
-
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_build_var(tau_typebuilder_t* builder, uint64_t id)
 {
-  tau_typedesc_var_t* desc = tau_typedesc_var_init();
-  desc->id = id;
+  tau_typebuilder_key_t key = { .kind = TAU_TYPEDESC_VAR, .id = id };
+  tau_hashmap_entry_t* entry = tau_typebuilder_find(builder, &key);
 
-  tau_typedesc_t* result = (tau_typedesc_t*)tau_set_get(builder->tau_set_var, desc);
+  if (entry->value != NULL)
+    return (tau_typedesc_t*)entry->value;
 
-  if (result != NULL)
-  {
-    tau_typedesc_free((tau_typedesc_t*)desc);
-    return result;
-  }
-
-  tau_set_add(builder->tau_set_var, desc);
+  tau_typedesc_var_t* desc = tau_typedesc_var_init();
+  desc->id = id;
 
-  return (tau_typedesc_t*)desc;
+  return tau_typebuilder_insert(builder, entry, (tau_typedesc_t*)desc);
 }
 
 tau_typedesc_t* tau_typebuilder_struct_set_body(tau_typebuilder_t* builder, tau_typedesc_t* desc, tau_typedesc_t* field_types[], size_t field_count)
 {
-  TAU_ASSERT(tau_set_contains(builder->tau_set_struct, desc));
+  TAU_ASSERT(desc->kind == TAU_TYPEDESC_STRUCT);
+  TAU_ASSERT(tau_typebuilder_find(builder, &(tau_typebuilder_key_t){ .kind = TAU_TYPEDESC_STRUCT, .node = ((tau_typedesc_struct_t*)desc)->node })->value == desc);
 
   LLVMTypeRef* llvm_field_types = NULL;
 
@@ -8,113 +8,44 @@
 #include "stages/analysis/types/typetable.h"
 
 #include "ast/ast.h"
-#include "utils/hash.h"
 
-/// The initial number of buckets in a type table.
-#define TYPETABLE_INITIAL_CAPACITY 16
-
-/// The load factor threshold for type table resizing.
-#define TYPETABLE_LOAD_FACTOR 0.75
-
-/// Represents an entry in a type table.
-typedef struct tau_typetable_entry_t tau_typetable_entry_t;
-
-struct tau_typetable_entry_t
-{
-  tau_ast_node_t* node;        ///< Pointer to the AST node associated with the type.
-  tau_typedesc_t* desc;        ///< Pointer to the descriptor of the type.
-  tau_typetable_entry_t* next; ///< Pointer to the next entry in the bucket.
-};
+/// The minimum number of entries a type table grows to.
+#define TYPETABLE_MIN_CAPACITY ((size_t)64)
 
 struct tau_typetable_t
 {
-  size_t size;                 ///< The number of type entries in the table.
-  size_t capacity;             ///< The total capacity of the table.
-  tau_typetable_entry_t** buckets; ///< An array of buckets for storing type entries.
+  tau_typedesc_t** descs; // Type descriptors indexed by the unique identifiers of the nodes.
+  size_t capacity; // The number of entries in `descs`.
 };
 
-/**
- * \brief Initializes a new type table entry.
- *
- * \param[in] node Pointer to the AST node to be associated with the entry.
- * \param[in] desc Pointer to the type descriptor for the AST node.
- * \returns Pointer to the newly initialized type table entry.
- */
-static tau_typetable_entry_t* tau_typetable_entry_init(tau_ast_node_t* node, tau_typedesc_t* desc)
-{
-  tau_typetable_entry_t* entry = (tau_typetable_entry_t*)malloc(sizeof(tau_typetable_entry_t));
-  TAU_ASSERT(entry != NULL);
-
-  entry->node = node;
-  entry->desc = desc;
-  entry->next = NULL;
-
-  return entry;
-}
-
-/**
- * \brief Inserts an entry into a type table.
- *
- * \param[in,out] table Pointer to the type table to insert into.
- * \param[in] entry Pointer to the entry to be inserted.
- */
-static void tau_typetable_insert_entry(tau_typetable_t* table, tau_typetable_entry_t* entry)
-{
-  size_t h = (size_t)tau_hash_digest(&entry->node, sizeof(tau_ast_node_t*));
-  size_t idx = h % table->capacity;
-
-  if (table->buckets[idx] == NULL)
-  {
-    table->size++;
-    table->buckets[idx] = entry;
-    entry->next = NULL;
-
-    return;
-  }
-
-  tau_typetable_entry_t* last = table->buckets[idx];
-
-  while (last->next != NULL)
-    last = last->next;
-
-  table->size++;
-  last->next = entry;
-  entry->next = NULL;
-}
-
 /**
  * \brief Expands the capacity of a type table.
  *
+ * \details The table grows to cover at least every node created so far, so
+ * when it is filled after parsing a single allocation suffices.
+ *
  * \param[in,out] table Pointer to the type table to be expanded.
- * \param[in] new_capacity The new capacity of the type table.
+ * \param[in] min_capacity The minimum capacity of the type table.
  */
-static void tau_typetable_expand(tau_typetable_t* table, size_t new_capacity)
+static void tau_typetable_expand(tau_typetable_t* table, size_t min_capacity)
 {
-  if (table->capacity >= new_capacity)
+  if (table->capacity >= min_capacity)
     return;
 
-  size_t entry_count = 0;
-  tau_typetable_entry_t** entries = (tau_typetable_entry_t**)malloc(table->size * sizeof(tau_typetable_entry_t*));
-
-  for (size_t i = 0; i < table->capacity && entry_count < table->size; ++i)
-    for (tau_typetable_entry_t* it = table->buckets[i]; it != NULL; it = it->next, ++entry_count)
-      entries[entry_count] = it;
+  size_t new_capacity = TAU_MAX(TAU_MAX(table->capacity << 1, min_capacity), TAU_MAX(tau_ast_node_count(), TYPETABLE_MIN_CAPACITY));
 
-  for (size_t i = 0; i < entry_count; ++i)
-    entries[i]->next = NULL;
-
-  table->size = 0;
-  table->capacity = new_capacity;
+  // Expanded during type checking, whose allocations belong to the type
+  // descriptors otherwise.
+  tau_memstat_owner_t prev_owner = tau_memstat_set_owner(TAU_MEMSTAT_OWNER_TYPETABLE);
 
-  table->buckets = (tau_typetable_entry_t**)realloc(table->buckets, table->capacity * sizeof(tau_typetable_entry_t*));
-  TAU_ASSERT(table->buckets != NULL);
+  table->descs = (tau_typedesc_t**)realloc(table->descs, new_capacity * sizeof(tau_typedesc_t*));
+  TAU_ASSERT(table->descs != NULL);
 
-  memset(table->buckets, 0, table->capacity * sizeof(tau_typetable_entry_t*));
+  tau_memstat_set_owner(prev_owner);
 
-  for (size_t i = 0; i < entry_count; ++i)
-    tau_typetable_insert_entry(table, entries[i]);
+  memset(table->descs + table->capacity, 0, (new_capacity - table->capacity) * sizeof(tau_typedesc_t*));
 
-  free(entries);
+  table->capacity = new_capacity;
 }
 
 tau_typetable_t* tau_typetable_init(void)
@@ -122,97 +53,48 @@ tau_typetable_t* tau_typetable_init(void)
   tau_typetable_t* table = (tau_typetable_t*)malloc(sizeof(tau_typetable_t));
   TAU_ASSERT(table != NULL);
 
-  table->size = 0;
-  table->capacity = TYPETABLE_INITIAL_CAPACITY;
-
-  table->buckets = (tau_typetable_entry_t**)calloc(table->capacity, sizeof(tau_typetable_entry_t*));
-  TAU_ASSERT(table->buckets != NULL);
+  table->descs = NULL;
+  table->capacity = 0;
 
   return table;
 }
 
 void tau_typetable_free(tau_typetable_t* table)
 {
-  for (size_t i = 0, j = 0; i < table->capacity && j < table->size; ++i)
-    for (tau_typetable_entry_t *it = table->buckets[i], *next; it != NULL; it = next, ++j)
-    {
-      next = it->next;
-      free(it);
-    }
-
-  free(table->buckets);
+  free(table->descs);
   free(table);
 }
 
 tau_typedesc_t* tau_typetable_insert(tau_typetable_t* table, tau_ast_node_t* node, tau_typedesc_t* desc)
 {
-  if ((double)table->size + 1 >= TYPETABLE_LOAD_FACTOR * (double)table->capacity)
-    tau_typetable_expand(table, table->capacity << 1);
-
-  size_t h = (size_t)tau_hash_digest(&node, sizeof(tau_ast_node_t*));
-  size_t idx = h % table->capacity;
-
-  if (table->buckets[idx] == NULL)
-  {
-    table->size++;
-    table->buckets[idx] = tau_typetable_entry_init(node, desc);
-
-    return NULL;
-  }
+  tau_typetable_expand(table, (size_t)node->uid + 1);
 
-  tau_typetable_entry_t* last = NULL;
+  tau_typedesc_t* old_desc = table->descs[node->uid];
+  table->descs[node->uid] = desc;
 
-  for (tau_typetable_entry_t* it = table->buckets[idx]; it != NULL; last = it, it = it->next)
-    if (it->node == node)
-    {
-      tau_typedesc_t* old_desc = it->desc;
-      it->desc = desc;
-
-      return old_desc;
-    }
-
-  TAU_ASSERT(last != NULL);
-
-  table->size++;
-  last->next = tau_typetable_entry_init(node, desc);
-
-  return NULL;
+  return old_desc;
 }
 
 tau_typedesc_t* tau_typetable_lookup(tau_typetable_t* table, tau_ast_node_t* node)
 {
-  size_t h = (size_t)tau_hash_digest(&node, sizeof(tau_ast_node_t*));
-  size_t idx = h % table->capacity;
-
-  if (table->buckets[idx] == NULL)
+  if (node->uid >= table->capacity)
     return NULL;
 
-  for (tau_typetable_entry_t* it = table->buckets[idx]; it != NULL; it = it->next)
-    if (it->node == node)
-      return it->desc;
-
-  return NULL;
+  return table->descs[node->uid];
 }
 
 void tau_typetable_merge(tau_typetable_t* dest, tau_typetable_t* src)
 {
-  size_t new_capacity = dest->capacity;
-
-  while (dest->size + src->size >= new_capacity)
-    new_capacity <<= 1;
+  tau_typetable_expand(dest, src->capacity);
 
-  tau_typetable_expand(dest, new_capacity);
-
-  for (size_t i = 0, j = 0; i < src->capacity && j < src->size; ++i)
-    for (tau_typetable_entry_t* entry = src->buckets[i], *next = NULL; entry != NULL; entry = next, ++j)
+  // Node identifiers are only unique within a compilation job, so tables of
+  // different jobs may use the same identifiers for different nodes.
+  for (size_t i = 0; i < src->capacity; i++)
+    if (src->descs[i] != NULL)
     {
-      next = entry->next;
-
-      tau_typetable_insert_entry(dest, entry);
+      TAU_ASSERT(dest->descs[i] == NULL);
+      dest->descs[i] = src->descs[i];
     }
 
-  src->size = 0;
-  memset(src->buckets, 0, sizeof(tau_typetable_entry_t*) * src->capacity);
-
   tau_typetable_free(src);
 }
@@ -13,175 +13,246 @@
 #include "stages/lexer/location.h"
 #include "stages/lexer/token/registry.h"
 #include "utils/common.h"
+#include "utils/interner.h"
 #include "utils/memory/memtrace.h"
+#include "utils/scan.h"
 
 #define LEXER_MAX_WORD_SIZE 256
 
-static const struct
-{
-  const char* const keyword;
-  const tau_token_kind_t kind;
-} g_keyword_lookup_table[] = {
-  { "is",       TAU_TOK_KW_IS       },
-  { "as",       TAU_TOK_KW_AS       },
-  { "sizeof",   TAU_TOK_KW_SIZEOF   },
-  { "alignof",  TAU_TOK_KW_ALIGNOF  },
-  { "use",      TAU_TOK_KW_USE      },
-  { "in",       TAU_TOK_KW_IN       },
-  { "pub",      TAU_TOK_KW_PUB      },
-  { "extern",   TAU_TOK_KW_EXTERN   },
-  { "fun",      TAU_TOK_KW_FUN      },
-  { "struct",   TAU_TOK_KW_STRUCT   },
-  { "union",    TAU_TOK_KW_UNION    },
-  { "enum",     TAU_TOK_KW_ENUM     },
-  { "mod",      TAU_TOK_KW_MOD      },
-  { "if",       TAU_TOK_KW_IF       },
-  { "then",     TAU_TOK_KW_THEN     },
-  { "else",     TAU_TOK_KW_ELSE     },
-  { "for",      TAU_TOK_KW_FOR      },
-  { "while",    TAU_TOK_KW_WHILE    },
-  { "do",       TAU_TOK_KW_DO       },
-  { "loop",     TAU_TOK_KW_LOOP     },
-  { "break",    TAU_TOK_KW_BREAK    },
-  { "continue", TAU_TOK_KW_CONTINUE },
-  { "return",   TAU_TOK_KW_RETURN   },
-  { "defer",    TAU_TOK_KW_DEFER    },
-  { "mut",      TAU_TOK_KW_MUT      },
-  { "i8",       TAU_TOK_KW_I8       },
-  { "i16",      TAU_TOK_KW_I16      },
-  { "i32",      TAU_TOK_KW_I32      },
-  { "i64",      TAU_TOK_KW_I64      },
-  { "isize",    TAU_TOK_KW_ISIZE    },
-  { "u8",       TAU_TOK_KW_U8       },
-  { "u16",      TAU_TOK_KW_U16      },
-  { "u32",      TAU_TOK_KW_U32      },
-  { "u64",      TAU_TOK_KW_U64      },
-  { "usize",    TAU_TOK_KW_USIZE    },
-  { "f32",      TAU_TOK_KW_F32      },
-  { "f64",      TAU_TOK_KW_F64      },
-  { "c64",      TAU_TOK_KW_C64      },
-  { "c128",     TAU_TOK_KW_C128     },
-  { "char",     TAU_TOK_KW_CHAR     },
-  { "bool",     TAU_TOK_KW_BOOL     },
-  { "unit",     TAU_TOK_KW_UNIT     },
-  { "type",     TAU_TOK_KW_TYPE     },
-  { "undef",    TAU_TOK_KW_UNDEF    },
-  { "true",     TAU_TOK_LIT_BOOL    },
-  { "false",    TAU_TOK_LIT_BOOL    },
-  { "null",     TAU_TOK_LIT_NULL    },
-};
-
 struct tau_lexer_t
 {
   const char* path; ///< Path to the source file.
   const char* src; ///< Contents of the source file.
+  size_t len; ///< Length of the source file.
+  uint32_t file; ///< Identifier of the source file in the token registry.
   size_t pos; ///< Current position in the source file.
+  size_t row; ///< Zero-based row of the current position.
+  size_t row_pos; ///< Position of the first character of the current row.
+  bool newline; ///< Whether a newline was skipped since the last token.
   tau_vector_t* tokens; ///< Vector of tokens.
   tau_error_bag_t* errors; ///< Associated error bag.
 };
 
-static bool tau_lexer_is_kw_vec(const char* str, size_t len)
-{
-  if (len < 6)
-    return false;
-
-  if (strncmp(str, "vec", 3) != 0)
-    return false;
-
-  str += 3;
-
-  if (!isdigit(*str))
-    return false;
-
-  while (isdigit(*str))
-    str++;
-
-  if (*str == '\0')
-    return false;
-
-  size_t suffix_len = 0;
+/**
+ * \brief Checks if a word is equal to a keyword.
+ */
+#define TAU_LEXER_WORD_IS(STR, LEN, KW)\
+  ((LEN) == sizeof(KW) - 1 && memcmp((STR), (KW), sizeof(KW) - 1) == 0)
 
-  while (isalnum(str[suffix_len]))
-    suffix_len++;
+/**
+ * \brief Returns the keyword kind from the enclosing function if a word is
+ * equal to a keyword.
+ */
+#define TAU_LEXER_MATCH_KW(STR, LEN, KW, KIND)\
+  do {\
+    if (TAU_LEXER_WORD_IS((STR), (LEN), (KW)))\
+      return (KIND);\
+  } while (0)
 
-  switch (suffix_len)
+/**
+ * \brief Checks if a word is the name of a primitive type which can be used as
+ * the base type of a vector or matrix.
+ *
+ * \param[in] str Pointer to the first character of the word.
+ * \param[in] len Length of the word.
+ * \returns `true` if the word is a primitive base type, `false` otherwise.
+ */
+static bool tau_lexer_is_prim_suffix(const char* str, size_t len)
+{
+  switch (len)
   {
   case 2:
-    if (strncmp("i8", str, suffix_len) == 0 ||
-        strncmp("u8", str, suffix_len) == 0)
-      return true;
+    return (str[0] == 'i' || str[0] == 'u') && str[1] == '8';
   case 3:
-    if (strncmp("i16", str, suffix_len) == 0 ||
-        strncmp("u16", str, suffix_len) == 0 ||
-        strncmp("i32", str, suffix_len) == 0 ||
-        strncmp("u32", str, suffix_len) == 0 ||
-        strncmp("i64", str, suffix_len) == 0 ||
-        strncmp("u64", str, suffix_len) == 0 ||
-        strncmp("f32", str, suffix_len) == 0 ||
-        strncmp("f64", str, suffix_len) == 0)
-      return true;
+    if (str[0] == 'i' || str[0] == 'u')
+      return (str[1] == '1' && str[2] == '6') ||
+             (str[1] == '3' && str[2] == '2') ||
+             (str[1] == '6' && str[2] == '4');
+
+    if (str[0] == 'f')
+      return (str[1] == '3' && str[2] == '2') ||
+             (str[1] == '6' && str[2] == '4');
+
+    return false;
   default:
     return false;
   }
 }
 
-static bool tau_lexer_is_kw_mat(const char* str, size_t len)
+/**
+ * \brief Skips the decimal digits at the beginning of a word.
+ *
+ * \param[in] str Pointer to the first character.
+ * \param[in] end Pointer past the last character of the word.
+ * \returns Pointer to the first non-digit character.
+ */
+static const char* tau_lexer_skip_digits(const char* str, const char* end)
 {
-  if (len < 6)
-    return false;
+  while (str < end && isdigit(*str))
+    str++;
 
-  if (strncmp(str, "mat", 3) != 0)
+  return str;
+}
+
+/**
+ * \brief Checks if a word is a vector type keyword of the form `vecN<T>`.
+ *
+ * \param[in] str Pointer to the first character of the word.
+ * \param[in] len Length of the word.
+ * \returns `true` if the word is a vector type keyword, `false` otherwise.
+ */
+static bool tau_lexer_is_kw_vec(const char* str, size_t len)
+{
+  if (len < 6 || memcmp(str, "vec", 3) != 0)
     return false;
 
-  str += 3;
+  const char* end = str + len;
+  const char* size_begin = str + 3;
+  const char* size_end = tau_lexer_skip_digits(size_begin, end);
 
-  if (!isdigit(*str))
+  if (size_end == size_begin)
     return false;
 
-  while (isdigit(*str))
-    str++;
+  return tau_lexer_is_prim_suffix(size_end, (size_t)(end - size_end));
+}
 
-  if (*str == '\0')
+/**
+ * \brief Checks if a word is a matrix type keyword of the form `matN<T>` or
+ * `matNxM<T>`.
+ *
+ * \param[in] str Pointer to the first character of the word.
+ * \param[in] len Length of the word.
+ * \returns `true` if the word is a matrix type keyword, `false` otherwise.
+ */
+static bool tau_lexer_is_kw_mat(const char* str, size_t len)
+{
+  if (len < 6 || memcmp(str, "mat", 3) != 0)
     return false;
 
-  if (*str == 'x')
-  {
-    str++;
+  const char* end = str + len;
+  const char* rows_begin = str + 3;
+  const char* size_end = tau_lexer_skip_digits(rows_begin, end);
 
-    if (!isdigit(*str))
-      return false;
+  if (size_end == rows_begin)
+    return false;
 
-    while (isdigit(*str))
-      str++;
+  if (size_end < end && *size_end == 'x')
+  {
+    const char* cols_begin = size_end + 1;
+    size_end = tau_lexer_skip_digits(cols_begin, end);
 
-    if (*str == '\0')
+    if (size_end == cols_begin)
       return false;
   }
 
-  size_t suffix_len = 0;
-
-  while (isalnum(str[suffix_len]))
-    suffix_len++;
+  return tau_lexer_is_prim_suffix(size_end, (size_t)(end - size_end));
+}
 
-  switch (suffix_len)
+/**
+ * \brief Classifies a word as a keyword, keyword-like literal or identifier.
+ *
+ * \details The word is dispatched on its first character and only compared
+ * against the handful of keywords sharing it, each comparison being skipped
+ * unless the lengths match. The word is examined in place, it does not need
+ * to be null-terminated.
+ *
+ * \param[in] str Pointer to the first character of the word.
+ * \param[in] len Length of the word.
+ * \returns The kind of token the word represents.
+ */
+static tau_token_kind_t tau_lexer_classify_word(const char* str, size_t len)
+{
+  switch (str[0])
   {
-  case 2:
-    if (strncmp("i8", str, suffix_len) == 0 ||
-        strncmp("u8", str, suffix_len) == 0)
-      return true;
-  case 3:
-    if (strncmp("i16", str, suffix_len) == 0 ||
-        strncmp("u16", str, suffix_len) == 0 ||
-        strncmp("i32", str, suffix_len) == 0 ||
-        strncmp("u32", str, suffix_len) == 0 ||
-        strncmp("i64", str, suffix_len) == 0 ||
-        strncmp("u64", str, suffix_len) == 0 ||
-        strncmp("f32", str, suffix_len) == 0 ||
-        strncmp("f64", str, suffix_len) == 0)
-      return true;
-  default:
-    return false;
+  case 'a':
+    TAU_LEXER_MATCH_KW(str, len, "as",       TAU_TOK_KW_AS      );
+    TAU_LEXER_MATCH_KW(str, len, "alignof",  TAU_TOK_KW_ALIGNOF );
+    break;
+  case 'b':
+    TAU_LEXER_MATCH_KW(str, len, "break",    TAU_TOK_KW_BREAK   );
+    TAU_LEXER_MATCH_KW(str, len, "bool",     TAU_TOK_KW_BOOL    );
+    break;
+  case 'c':
+    TAU_LEXER_MATCH_KW(str, len, "continue", TAU_TOK_KW_CONTINUE);
+    TAU_LEXER_MATCH_KW(str, len, "c64",      TAU_TOK_KW_C64     );
+    TAU_LEXER_MATCH_KW(str, len, "c128",     TAU_TOK_KW_C128    );
+    TAU_LEXER_MATCH_KW(str, len, "char",     TAU_TOK_KW_CHAR    );
+    break;
+  case 'd':
+    TAU_LEXER_MATCH_KW(str, len, "do",       TAU_TOK_KW_DO      );
+    TAU_LEXER_MATCH_KW(str, len, "defer",    TAU_TOK_KW_DEFER   );
+    break;
+  case 'e':
+    TAU_LEXER_MATCH_KW(str, len, "extern",   TAU_TOK_KW_EXTERN  );
+    TAU_LEXER_MATCH_KW(str, len, "enum",     TAU_TOK_KW_ENUM    );
+    TAU_LEXER_MATCH_KW(str, len, "else",     TAU_TOK_KW_ELSE    );
+    break;
+  case 'f':
+    TAU_LEXER_MATCH_KW(str, len, "fun",      TAU_TOK_KW_FUN     );
+    TAU_LEXER_MATCH_KW(str, len, "for",      TAU_TOK_KW_FOR     );
+    TAU_LEXER_MATCH_KW(str, len, "f32",      TAU_TOK_KW_F32     );
+    TAU_LEXER_MATCH_KW(str, len, "f64",      TAU_TOK_KW_F64     );
+    TAU_LEXER_MATCH_KW(str, len, "false",    TAU_TOK_LIT_BOOL   );
+    break;
+  case 'i':
+    TAU_LEXER_MATCH_KW(str, len, "is",       TAU_TOK_KW_IS      );
+    TAU_LEXER_MATCH_KW(str, len, "in",       TAU_TOK_KW_IN      );
+    TAU_LEXER_MATCH_KW(str, len, "if",       TAU_TOK_KW_IF      );
+    TAU_LEXER_MATCH_KW(str, len, "i8",       TAU_TOK_KW_I8      );
+    TAU_LEXER_MATCH_KW(str, len, "i16",      TAU_TOK_KW_I16     );
+    TAU_LEXER_MATCH_KW(str, len, "i32",      TAU_TOK_KW_I32     );
+    TAU_LEXER_MATCH_KW(str, len, "i64",      TAU_TOK_KW_I64     );
+    TAU_LEXER_MATCH_KW(str, len, "isize",    TAU_TOK_KW_ISIZE   );
+    break;
+  case 'l':
+    TAU_LEXER_MATCH_KW(str, len, "loop",     TAU_TOK_KW_LOOP    );
+    break;
+  case 'm':
+    TAU_LEXER_MATCH_KW(str, len, "mod",      TAU_TOK_KW_MOD     );
+    TAU_LEXER_MATCH_KW(str, len, "mut",      TAU_TOK_KW_MUT     );
+
+    if (tau_lexer_is_kw_mat(str, len))
+      return TAU_TOK_KW_MAT;
+    break;
+  case 'n':
+    TAU_LEXER_MATCH_KW(str, len, "null",     TAU_TOK_LIT_NULL   );
+    break;
+  case 'p':
+    TAU_LEXER_MATCH_KW(str, len, "pub",      TAU_TOK_KW_PUB     );
+    break;
+  case 'r':
+    TAU_LEXER_MATCH_KW(str, len, "return",   TAU_TOK_KW_RETURN  );
+    break;
+  case 's':
+    TAU_LEXER_MATCH_KW(str, len, "sizeof",   TAU_TOK_KW_SIZEOF  );
+    TAU_LEXER_MATCH_KW(str, len, "struct",   TAU_TOK_KW_STRUCT  );
+    break;
+  case 't':
+    TAU_LEXER_MATCH_KW(str, len, "then",     TAU_TOK_KW_THEN    );
+    TAU_LEXER_MATCH_KW(str, len, "type",     TAU_TOK_KW_TYPE    );
+    TAU_LEXER_MATCH_KW(str, len, "true",     TAU_TOK_LIT_BOOL   );
+    break;
+  case 'u':
+    TAU_LEXER_MATCH_KW(str, len, "use",      TAU_TOK_KW_USE     );
+    TAU_LEXER_MATCH_KW(str, len, "union",    TAU_TOK_KW_UNION   );
+    TAU_LEXER_MATCH_KW(str, len, "u8",       TAU_TOK_KW_U8      );
+    TAU_LEXER_MATCH_KW(str, len, "u16",      TAU_TOK_KW_U16     );
+    TAU_LEXER_MATCH_KW(str, len, "u32",      TAU_TOK_KW_U32     );
+    TAU_LEXER_MATCH_KW(str, len, "u64",      TAU_TOK_KW_U64     );
+    TAU_LEXER_MATCH_KW(str, len, "usize",    TAU_TOK_KW_USIZE   );
+    TAU_LEXER_MATCH_KW(str, len, "unit",     TAU_TOK_KW_UNIT    );
+    TAU_LEXER_MATCH_KW(str, len, "undef",    TAU_TOK_KW_UNDEF   );
+    break;
+  case 'v':
+    if (tau_lexer_is_kw_vec(str, len))
+      return TAU_TOK_KW_VEC;
+    break;
+  case 'w':
+    TAU_LEXER_MATCH_KW(str, len, "while",    TAU_TOK_KW_WHILE   );
+    break;
   }
+
+  return TAU_TOK_ID;
 }
 
 tau_lexer_t* tau_lexer_init(void)
@@ -190,7 +261,11 @@ tau_lexer_t* tau_lexer_init(void)
 
   lex->path = NULL;
   lex->src = NULL;
+  lex->len = 0;
+  lex->file = 0;
   lex->pos = 0;
+  lex->row = 0;
+  lex->row_pos = 0;
 
   return lex;
 }
@@ -202,29 +277,17 @@ void tau_lexer_free(tau_lexer_t* lex)
 
 tau_token_t* tau_lexer_token_init(tau_lexer_t* lex, tau_token_kind_t kind)
 {
-  return tau_token_registry_token_init(lex->path, kind, lex->pos);
+  return tau_token_registry_token_init(lex->file, kind, lex->pos);
 }
 
 tau_location_t tau_lexer_location(tau_lexer_t* lex)
 {
-  size_t row = 0;
-  size_t col = 0;
-
-  for (size_t i = 0; i < lex->pos && lex->src[i] != '\0'; i++, col++)
-  {
-    if (lex->src[i] == '\n')
-    {
-      row++;
-      col = 0;
-    }
-  }
-
   tau_location_t loc = {
     .path = lex->path,
     .src = lex->src,
     .ptr = lex->src + lex->pos,
-    .row = row,
-    .col = col,
+    .row = lex->row,
+    .col = lex->pos - lex->row_pos,
     .len = 0
   };
 
@@ -283,8 +346,8 @@ char tau_lexer_next(tau_lexer_t* lex)
 
   if (lex->src[lex->pos] == '\n')
   {
-    tau_token_t* tok = tau_token_registry_token_init(lex->path, TAU_TOK_NEWLINE, lex->pos);
-    tau_vector_push(lex->tokens, tok);
+    lex->row++;
+    lex->row_pos = lex->pos + 1;
   }
 
   return lex->src[lex->pos++];
@@ -363,23 +426,52 @@ size_t tau_lexer_skip_integer_suffix(tau_lexer_t* lex)
   return len;
 }
 
-void tau_lexer_skip_comment_line(tau_lexer_t* lex)
+void tau_lexer_skip_whitespace(tau_lexer_t* lex)
 {
-  while (tau_lexer_current(lex) != '\n' && tau_lexer_current(lex) != '\0')
+  const char* end = lex->src + lex->len;
+
+  for (;;)
+  {
+    lex->pos = (size_t)(tau_scan_skip_blank(lex->src + lex->pos, end) - lex->src);
+
+    if (lex->src[lex->pos] != '\n')
+      break;
+
+    lex->newline = true;
+
     tau_lexer_next(lex);
+  }
+}
+
+void tau_lexer_skip_comment_line(tau_lexer_t* lex)
+{
+  lex->pos = (size_t)(tau_scan_find_newline(lex->src + lex->pos, lex->src + lex->len) - lex->src);
 }
 
 void tau_lexer_skip_comment_block(tau_lexer_t* lex)
 {
-  while (!(tau_lexer_consume(lex, '*') && tau_lexer_consume(lex, '/')))
-    tau_lexer_next(lex);
+  const char* end = lex->src + lex->len;
+
+  while (lex->pos < lex->len)
+  {
+    lex->pos = (size_t)(tau_scan_find_either(lex->src + lex->pos, end, '*', '\n') - lex->src);
+
+    char ch = tau_lexer_next(lex);
+
+    if (ch == '\n')
+      lex->newline = true;
+    else if (ch == '*' && tau_lexer_consume(lex, '/'))
+      return;
+  }
 }
 
 tau_token_t* tau_lexer_read_word(tau_lexer_t* lex)
 {
   tau_token_t* tok = tau_lexer_token_init(lex, TAU_TOK_ID);
 
-  size_t len = tau_lexer_skip(lex, tau_lexer_is_word);
+  lex->pos = (size_t)(tau_scan_skip_word(lex->src + lex->pos, lex->src + lex->len) - lex->src);
+
+  size_t len = lex->pos - tok->pos;
 
   if (len > LEXER_MAX_WORD_SIZE - 2)
   {
@@ -390,29 +482,10 @@ tau_token_t* tau_lexer_read_word(tau_lexer_t* lex)
     tau_error_bag_put_lexer_identifier_too_long(lex->errors, loc);
   }
 
-  char buf[LEXER_MAX_WORD_SIZE] = { 0 };
+  tok->kind = tau_lexer_classify_word(lex->src + tok->pos, len);
 
-  strncpy(buf, lex->src + tok->pos, len);
-
-  if (tau_lexer_is_kw_vec(buf, len))
-  {
-    tok->kind = TAU_TOK_KW_VEC;
-  }
-  else if (tau_lexer_is_kw_mat(buf, len))
-  {
-    tok->kind = TAU_TOK_KW_MAT;
-  }
-  else
-  {
-    for (size_t i = 0; i < TAU_COUNTOF(g_keyword_lookup_table); ++i)
-    {
-      if (strcmp(g_keyword_lookup_table[i].keyword, buf) == 0)
-      {
-        tok->kind = g_keyword_lookup_table[i].kind;
-        break;
-      }
-    }
-  }
+  if (tok->kind == TAU_TOK_ID)
+    tok->id = tau_interner_intern(lex->src + tok->pos, len);
 
   return tok;
 }
@@ -870,12 +943,12 @@ tau_token_t* tau_lexer_read_punctuation(tau_lexer_t* lex)
     tau_error_bag_put_lexer_unexpected_character(lex->errors, loc);
   }
 
-  return tau_token_registry_token_init(lex->path, kind, pos);
+  return tau_token_registry_token_init(lex->file, kind, pos);
 }
 
 tau_token_t* tau_lexer_read_next(tau_lexer_t* lex)
 {
-  tau_lexer_skip(lex, tau_lexer_is_space);
+  tau_lexer_skip_whitespace(lex);
 
   if (tau_lexer_is_word_begin(lex))
     return tau_lexer_read_word(lex);
@@ -908,16 +981,37 @@ void tau_lexer_lex(tau_lexer_t* lex, const char* path, const char* src, tau_vect
 {
   lex->path = path;
   lex->src = src;
+  lex->len = strlen(src);
   lex->pos = 0;
 
+  // Token positions are 32-bit offsets.
+  TAU_ASSERT(lex->len <= UINT32_MAX);
+  lex->row = 0;
+  lex->row_pos = 0;
+  lex->newline = false;
+
   lex->tokens = tokens;
   lex->errors = errors;
 
-  tau_token_registry_register_file(path, src);
+  lex->file = tau_token_registry_register_file(path, src);
 
   while (tau_vector_empty(lex->tokens) || ((tau_token_t*)tau_vector_back(lex->tokens))->kind != TAU_TOK_EOF)
   {
-    tau_vector_push(lex->tokens, tau_lexer_read_next(lex));
+    tau_token_t* tok = tau_lexer_read_next(lex);
+
+    // Tokens are created at their first character, so the length is only
+    // known once the lexer has moved past the last one.
+    if (tok != NULL)
+    {
+      tok->len = (uint32_t)(lex->pos - tok->pos);
+
+      if (lex->newline)
+        tok->flags |= TAU_TOKEN_FLAG_NEWLINE;
+
+      lex->newline = false;
+    }
+
+    tau_vector_push(lex->tokens, tok);
 
     if (tau_error_bag_full(lex->errors))
       return;
@@ -0,0 +1,93 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "stages/lexer/line_index.h"
+
+#include <string.h>
+
+#include "utils/common.h"
+
+/**
+ * \brief The initial number of lines a line index should be able to hold.
+ */
+#define TAU_LINE_INDEX_INITIAL_CAPACITY ((size_t)64)
+
+struct tau_line_index_t
+{
+  size_t count; ///< Number of lines.
+  size_t capacity; ///< Maximum number of lines before reallocation.
+  size_t* begins; ///< Positions of the first character of each line.
+};
+
+/**
+ * \brief Appends the beginning of a new line to a line index.
+ *
+ * \param[in,out] idx Pointer to the line index.
+ * \param[in] pos Position of the first character of the line.
+ */
+static void tau_line_index_push(tau_line_index_t* idx, size_t pos)
+{
+  if (idx->count == idx->capacity)
+  {
+    idx->capacity *= 2;
+    idx->begins = (size_t*)realloc(idx->begins, sizeof(size_t) * idx->capacity);
+    TAU_ASSERT(idx->begins != NULL);
+  }
+
+  idx->begins[idx->count++] = pos;
+}
+
+tau_line_index_t* tau_line_index_init(const char* src)
+{
+  tau_line_index_t* idx = (tau_line_index_t*)malloc(sizeof(tau_line_index_t));
+  TAU_ASSERT(idx != NULL);
+
+  idx->count = 0;
+  idx->capacity = TAU_LINE_INDEX_INITIAL_CAPACITY;
+  idx->begins = (size_t*)malloc(sizeof(size_t) * idx->capacity);
+  TAU_ASSERT(idx->begins != NULL);
+
+  tau_line_index_push(idx, 0);
+
+  const char* end = src + strlen(src);
+
+  for (const char* it = src; (it = (const char*)memchr(it, '\n', (size_t)(end - it))) != NULL; it++)
+    tau_line_index_push(idx, (size_t)(it - src) + 1);
+
+  return idx;
+}
+
+void tau_line_index_free(tau_line_index_t* idx)
+{
+  free(idx->begins);
+  free(idx);
+}
+
+size_t tau_line_index_count(tau_line_index_t* idx)
+{
+  return idx->count;
+}
+
+void tau_line_index_resolve(tau_line_index_t* idx, size_t pos, size_t* row, size_t* col)
+{
+  // Find the last line which begins at or before the position.
+  size_t lo = 0;
+  size_t hi = idx->count;
+
+  while (hi - lo > 1)
+  {
+    size_t mid = lo + (hi - lo) / 2;
+
+    if (idx->begins[mid] <= pos)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  *row = lo;
+  *col = pos - idx->begins[lo];
+}
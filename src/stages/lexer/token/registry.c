@@ -19,15 +19,16 @@ typedef struct tau_token_registry_entry_t
   uint64_t key; // The hash of the file path.
   const char* path; // The path to the source file.
   const char* src; // The contents of the source file.
+  tau_line_index_t* lines; // The line index of the source file.
   tau_arena_t* arena; // The arena allocator for the tokens associated with this file.
 } tau_token_registry_entry_t;
 
 /**
- * \brief Vector of token registry entries.
+ * \brief Vector of token registry entries indexed by file identifier, one per thread.
  */
-static tau_vector_t* g_token_registry = NULL;
+static TAU_THREAD_LOCAL tau_vector_t* g_token_registry = NULL;
 
-void tau_token_registry_register_file(const char* path, const char* src)
+uint32_t tau_token_registry_register_file(const char* path, const char* src)
 {
   if (g_token_registry == NULL)
     g_token_registry = tau_vector_init();
@@ -39,61 +40,54 @@ void tau_token_registry_register_file(const char* path, const char* src)
     tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, i);
 
     if (entry->key == key)
-      return;
+      return (uint32_t)i;
   }
 
+  TAU_ASSERT(tau_vector_size(g_token_registry) < UINT32_MAX);
+
   tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)malloc(sizeof(tau_token_registry_entry_t));
   TAU_ASSERT(entry != NULL);
 
   entry->key = key;
   entry->path = path;
   entry->src = src;
+  entry->lines = tau_line_index_init(src);
   entry->arena = tau_arena_init();
 
   tau_vector_push(g_token_registry, entry);
+
+  return (uint32_t)(tau_vector_size(g_token_registry) - 1);
 }
 
-tau_token_t* tau_token_registry_token_init(const char* path, tau_token_kind_t kind, size_t pos)
+tau_token_t* tau_token_registry_token_init(uint32_t file, tau_token_kind_t kind, size_t pos)
 {
-  if (g_token_registry == NULL)
+  if (g_token_registry == NULL || file >= tau_vector_size(g_token_registry))
     return NULL;
 
-  uint64_t key = tau_hash_digest(path, strlen(path));
-
-  TAU_VECTOR_FOR_LOOP(i, g_token_registry)
-  {
-    tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, i);
-
-    if (entry->key == key)
-    {
-      tau_token_t* tok = (tau_token_t*)tau_arena_alloc(entry->arena, sizeof(tau_token_t));
+  tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, file);
 
-      tok->kind = kind;
-      tok->pos = pos;
+  tau_token_t* tok = (tau_token_t*)tau_arena_alloc(entry->arena, sizeof(tau_token_t));
 
-      return tok;
-    }
-  }
+  tok->kind = kind;
+  tok->file = file;
+  tok->pos = (uint32_t)pos;
+  tok->len = 0;
+  tok->flags = 0;
+  tok->id = TAU_INTERNER_NULL_ID;
 
-  return NULL;
+  return tok;
 }
 
-void tau_token_registry_path_and_src(tau_token_t* tok, const char** path, const char** src)
+void tau_token_registry_file_info(tau_token_t* tok, const char** path, const char** src, tau_line_index_t** lines)
 {
-  if (g_token_registry == NULL)
+  if (g_token_registry == NULL || tok->file >= tau_vector_size(g_token_registry))
     return;
 
-  TAU_VECTOR_FOR_LOOP(i, g_token_registry)
-  {
-    tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, i);
+  tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, tok->file);
 
-    if (tau_arena_owns(entry->arena, tok))
-    {
-      *path = entry->path;
-      *src = entry->src;
-      return;
-    }
-  }
+  *path = entry->path;
+  *src = entry->src;
+  *lines = entry->lines;
 }
 
 void tau_token_registry_free(void)
@@ -105,6 +99,7 @@ void tau_token_registry_free(void)
   {
     tau_token_registry_entry_t* entry = (tau_token_registry_entry_t*)tau_vector_get(g_token_registry, i);
 
+    tau_line_index_free(entry->lines);
     tau_arena_free(entry->arena);
     free(entry);
   }
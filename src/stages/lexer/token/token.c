@@ -8,360 +8,45 @@
 #include "stages/lexer/token/token.h"
 
 #include "stages/lexer/token/registry.h"
+#include "utils/scan.h"
 
-static const struct
-{
-  tau_token_kind_t kind;
-  size_t len;
-} g_token_len_lookup[] = {
-  { TAU_TOK_UNKNOWN, 0 },
-  { TAU_TOK_LIT_NULL, 4 },
-  { TAU_TOK_KW_IS, 2 },
-  { TAU_TOK_KW_AS, 2 },
-  { TAU_TOK_KW_SIZEOF, 6 },
-  { TAU_TOK_KW_ALIGNOF, 7 },
-  { TAU_TOK_KW_USE, 3 },
-  { TAU_TOK_KW_IN, 2 },
-  { TAU_TOK_KW_PUB, 3 },
-  { TAU_TOK_KW_EXTERN, 6 },
-  { TAU_TOK_KW_FUN, 3 },
-  { TAU_TOK_KW_STRUCT, 6 },
-  { TAU_TOK_KW_UNION, 5 },
-  { TAU_TOK_KW_ENUM, 4 },
-  { TAU_TOK_KW_MOD, 3 },
-  { TAU_TOK_KW_IF, 2 },
-  { TAU_TOK_KW_THEN, 4 },
-  { TAU_TOK_KW_ELSE, 4 },
-  { TAU_TOK_KW_FOR, 3 },
-  { TAU_TOK_KW_WHILE, 5 },
-  { TAU_TOK_KW_DO, 2 },
-  { TAU_TOK_KW_LOOP, 4 },
-  { TAU_TOK_KW_BREAK, 5 },
-  { TAU_TOK_KW_CONTINUE, 8 },
-  { TAU_TOK_KW_RETURN, 6 },
-  { TAU_TOK_KW_DEFER, 5 },
-  { TAU_TOK_KW_MUT, 3 },
-  { TAU_TOK_KW_I8, 2 },
-  { TAU_TOK_KW_I16, 3 },
-  { TAU_TOK_KW_I32, 3 },
-  { TAU_TOK_KW_I64, 3 },
-  { TAU_TOK_KW_ISIZE, 5 },
-  { TAU_TOK_KW_U8, 2 },
-  { TAU_TOK_KW_U16, 3 },
-  { TAU_TOK_KW_U32, 3 },
-  { TAU_TOK_KW_U64, 3 },
-  { TAU_TOK_KW_USIZE, 5 },
-  { TAU_TOK_KW_F32, 3 },
-  { TAU_TOK_KW_F64, 3 },
-  { TAU_TOK_KW_C64, 3 },
-  { TAU_TOK_KW_C128, 4 },
-  { TAU_TOK_KW_CHAR, 4 },
-  { TAU_TOK_KW_BOOL, 4 },
-  { TAU_TOK_KW_UNIT, 4 },
-  { TAU_TOK_KW_TYPE, 4 },
-  { TAU_TOK_KW_UNDEF, 5 },
-  { TAU_TOK_PUNCT_PLUS, 1 },
-  { TAU_TOK_PUNCT_PLUS_PLUS, 2 },
-  { TAU_TOK_PUNCT_PLUS_EQUAL, 2 },
-  { TAU_TOK_PUNCT_MINUS, 1 },
-  { TAU_TOK_PUNCT_MINUS_MINUS, 2 },
-  { TAU_TOK_PUNCT_MINUS_EQUAL, 2 },
-  { TAU_TOK_PUNCT_MINUS_GREATER, 2 },
-  { TAU_TOK_PUNCT_ASTERISK, 1 },
-  { TAU_TOK_PUNCT_ASTERISK_EQUAL, 2 },
-  { TAU_TOK_PUNCT_SLASH, 1 },
-  { TAU_TOK_PUNCT_SLASH_EQUAL, 2 },
-  { TAU_TOK_PUNCT_PERCENT, 1 },
-  { TAU_TOK_PUNCT_PERCENT_EQUAL, 2 },
-  { TAU_TOK_PUNCT_AMPERSAND, 1 },
-  { TAU_TOK_PUNCT_AMPERSAND_AMPERSAND, 2 },
-  { TAU_TOK_PUNCT_AMPERSAND_EQUAL, 2 },
-  { TAU_TOK_PUNCT_BAR, 1 },
-  { TAU_TOK_PUNCT_BAR_BAR, 1 },
-  { TAU_TOK_PUNCT_BAR_EQUAL, 2 },
-  { TAU_TOK_PUNCT_HAT, 1 },
-  { TAU_TOK_PUNCT_HAT_EQUAL, 2 },
-  { TAU_TOK_PUNCT_TILDE, 1 },
-  { TAU_TOK_PUNCT_LESS, 1 },
-  { TAU_TOK_PUNCT_LESS_LESS, 2 },
-  { TAU_TOK_PUNCT_LESS_LESS_EQUAL, 3 },
-  { TAU_TOK_PUNCT_LESS_EQUAL, 2 },
-  { TAU_TOK_PUNCT_GREATER, 1 },
-  { TAU_TOK_PUNCT_GREATER_GREATER, 2 },
-  { TAU_TOK_PUNCT_GREATER_GREATER_EQUAL, 3 },
-  { TAU_TOK_PUNCT_GREATER_EQUAL, 2 },
-  { TAU_TOK_PUNCT_BANG, 1 },
-  { TAU_TOK_PUNCT_BANG_EQUAL, 2 },
-  { TAU_TOK_PUNCT_DOT, 1 },
-  { TAU_TOK_PUNCT_DOT_DOT, 2 },
-  { TAU_TOK_PUNCT_DOT_DOT_DOT, 3 },
-  { TAU_TOK_PUNCT_DOT_LESS, 2 },
-  { TAU_TOK_PUNCT_QUESTION, 1 },
-  { TAU_TOK_PUNCT_QUESTION_DOT, 2 },
-  { TAU_TOK_PUNCT_EQUAL, 1 },
-  { TAU_TOK_PUNCT_EQUAL_EQUAL, 2 },
-  { TAU_TOK_PUNCT_COMMA, 1 },
-  { TAU_TOK_PUNCT_COLON, 1 },
-  { TAU_TOK_PUNCT_SEMICOLON, 1 },
-  { TAU_TOK_PUNCT_PAREN_LEFT, 1 },
-  { TAU_TOK_PUNCT_PAREN_RIGHT, 1 },
-  { TAU_TOK_PUNCT_BRACKET_LEFT, 1 },
-  { TAU_TOK_PUNCT_BRACKET_RIGHT, 1 },
-  { TAU_TOK_PUNCT_BRACKET_ANGLE_LEFT, 2 },
-  { TAU_TOK_PUNCT_BRACKET_ANGLE_RIGHT, 2 },
-  { TAU_TOK_PUNCT_BRACE_LEFT, 1 },
-  { TAU_TOK_PUNCT_BRACE_RIGHT, 1 },
-  { TAU_TOK_PUNCT_HASH, 1 },
-  { TAU_TOK_NEWLINE, 0 },
-  { TAU_TOK_EOF, 0 },
-};
-
-static size_t tau_token_len_lit_int_hex(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos += 2;
-
-  while (isxdigit(src[pos]))
-    pos++;
-
-  if (src[pos] == 'i' || src[pos] == 'u')
-  {
-    pos++;
-
-    while (isdigit(src[pos]))
-      pos++;
-  }
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_int_oct(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos += 2;
-
-  while (src[pos] >= '0' && src[pos] <= '7')
-    pos++;
-
-  if (src[pos] == 'i' || src[pos] == 'u')
-  {
-    pos++;
-
-    while (isdigit(src[pos]))
-      pos++;
-  }
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_int_bin(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos += 2;
-
-  while (src[pos] == '0' || src[pos] == '1')
-    pos++;
-
-  if (src[pos] == 'i' || src[pos] == 'u')
-  {
-    pos++;
-
-    while (isdigit(src[pos]))
-      pos++;
-  }
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_int_dec(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos += 2;
-
-  while (isdigit(src[pos]))
-    pos++;
-
-  if (src[pos] == 'i' || src[pos] == 'u')
-  {
-    pos++;
-
-    while (isdigit(src[pos]))
-      pos++;
-  }
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_id(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  while (isalnum(src[pos]) || src[pos] == '_')
-    pos++;
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_int(const char* src, size_t pos)
-{
-  if (src[pos] == '0')
-  {
-    if (src[pos + 1] == 'x' || src[pos + 1] == 'X')
-      return tau_token_len_lit_int_hex(src, pos);
-
-    if (src[pos + 1] == 'o' || src[pos + 1] == 'O')
-      return tau_token_len_lit_int_oct(src, pos);
-
-    if (src[pos + 1] == 'b' || src[pos + 1] == 'B')
-      return tau_token_len_lit_int_bin(src, pos);
-  }
-
-  return tau_token_len_lit_int_dec(src, pos);
-}
-
-static size_t tau_token_len_lit_flt(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  while (isdigit(src[pos]))
-    pos++;
-
-  if (src[pos] == '.')
-    pos++;
-
-  while (isdigit(src[pos]))
-    pos++;
-
-  if (src[pos] == 'e' || src[pos] == 'E')
-  {
-    pos++;
-
-    if (src[pos] == '+' || src[pos] == '-')
-      pos++;
-
-    while (isdigit(src[pos]))
-      pos++;
-  }
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_str(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos++;
-
-  while (src[pos] != '"')
-  {
-    if (src[pos] == '\\')
-      pos++;
-
-    pos++;
-  }
-
-  pos++;
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_char(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  pos++;
-
-  while (src[pos] != '\'')
-  {
-    if (src[pos] == '\\')
-      pos++;
-
-    pos++;
-  }
-
-  pos++;
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_lit_bool(const char* src, size_t pos)
-{
-  return src[pos] == 't' ? 4 : 5;
-}
-
-static size_t tau_token_len_kw_vec(const char* src, size_t pos)
-{
-  size_t begin = pos;
-
-  while (isalnum(src[pos]))
-    pos++;
-
-  return pos - begin;
-}
-
-static size_t tau_token_len_kw_mat(const char* src, size_t pos)
+/**
+ * \brief Finds the first line feed between a position and a token.
+ *
+ * \param[in] tok Pointer to the token.
+ * \param[in] begin Position in the token's source file to start searching at.
+ * \returns Position of the first line feed in `[begin, tok->pos)`, or
+ * `tok->pos` if there is none.
+ */
+static size_t tau_token_find_newline(tau_token_t* tok, size_t begin)
 {
-  size_t begin = pos;
-
-  while (isalnum(src[pos]))
-    pos++;
+  const char* path = NULL;
+  const char* src = NULL;
+  tau_line_index_t* lines = NULL;
 
-  return pos - begin;
-}
+  tau_token_registry_file_info(tok, &path, &src, &lines);
 
-static size_t tau_token_len_by_kind(tau_token_kind_t kind)
-{
-  for (size_t i = 0; i < TAU_COUNTOF(g_token_len_lookup); i++)
-  {
-    if (g_token_len_lookup[i].kind == kind)
-    {
-      return g_token_len_lookup[i].len;
-    }
-  }
+  TAU_ASSERT(src != NULL);
 
-  return 0;
+  return (size_t)(tau_scan_find_newline(src + begin, src + tok->pos) - src);
 }
 
 tau_location_t tau_token_location(tau_token_t* tok)
 {
   const char* path = NULL;
   const char* src = NULL;
+  tau_line_index_t* lines = NULL;
 
-  tau_token_registry_path_and_src(tok, &path, &src);
+  tau_token_registry_file_info(tok, &path, &src, &lines);
 
   TAU_ASSERT(path != NULL);
   TAU_ASSERT(src != NULL);
+  TAU_ASSERT(lines != NULL);
 
   size_t row = 0;
   size_t col = 0;
 
-  for (size_t i = 0; i < tok->pos && src[i] != '\0'; i++, col++)
-  {
-    if (src[i] == '\n')
-    {
-      row++;
-      col = 0;
-    }
-  }
-
-  size_t len = 0;
-
-  switch (tok->kind)
-  {
-  case TAU_TOK_ID:       len = tau_token_len_id      (src, tok->pos); break;
-  case TAU_TOK_LIT_INT:  len = tau_token_len_lit_int (src, tok->pos); break;
-  case TAU_TOK_LIT_FLT:  len = tau_token_len_lit_flt (src, tok->pos); break;
-  case TAU_TOK_LIT_STR:  len = tau_token_len_lit_str (src, tok->pos); break;
-  case TAU_TOK_LIT_CHAR: len = tau_token_len_lit_char(src, tok->pos); break;
-  case TAU_TOK_LIT_BOOL: len = tau_token_len_lit_bool(src, tok->pos); break;
-  case TAU_TOK_KW_VEC:   len = tau_token_len_kw_vec  (src, tok->pos); break;
-  case TAU_TOK_KW_MAT:   len = tau_token_len_kw_mat  (src, tok->pos); break;
-  default:           len = tau_token_len_by_kind (tok->kind    ); break;
-  }
+  tau_line_index_resolve(lines, tok->pos, &row, &col);
 
   tau_location_t loc = {
     .path = path,
@@ -369,7 +54,7 @@ tau_location_t tau_token_location(tau_token_t* tok)
     .ptr = src + tok->pos,
     .row = row,
     .col = col,
-    .len = len
+    .len = tok->len
   };
 
   return loc;
@@ -379,14 +64,6 @@ void tau_token_json_dump(FILE* stream, tau_token_t* tok)
 {
   fprintf(stream, "{\"kind\":\"%s\",\"loc\":", tau_token_kind_to_cstr(tok->kind));
 
-  const char* path = NULL;
-  const char* src = NULL;
-
-  tau_token_registry_path_and_src(tok, &path, &src);
-
-  TAU_ASSERT(path != NULL);
-  TAU_ASSERT(src != NULL);
-
   tau_location_t loc = tau_token_location(tok);
 
   tau_location_json_dump(loc, stream);
@@ -403,16 +80,48 @@ void tau_token_json_dump(FILE* stream, tau_token_t* tok)
   fputc('}', stream);
 }
 
+tau_token_t tau_token_newline_before(tau_token_t* prev, tau_token_t* tok)
+{
+  size_t begin = prev == NULL ? 0 : prev->pos + prev->len;
+
+  tau_token_t newline = {
+    .kind = TAU_TOK_NEWLINE,
+    .file = tok->file,
+    .pos = (uint32_t)tau_token_find_newline(tok, begin),
+    .len = 0,
+    .flags = 0,
+    .id = TAU_INTERNER_NULL_ID
+  };
+
+  return newline;
+}
+
 void tau_token_json_dump_vector(FILE* stream, tau_vector_t* vec)
 {
   fputc('[', stream);
 
+  tau_token_t* prev = NULL;
+
   TAU_VECTOR_FOR_LOOP(i, vec)
   {
     tau_token_t* tok = (tau_token_t*)tau_vector_get(vec, i);
 
+    if ((tok->flags & TAU_TOKEN_FLAG_NEWLINE) != 0)
+    {
+      // Every line feed between the previous token and this one is dumped as
+      // a separate newline token.
+      for (tau_token_t newline = tau_token_newline_before(prev, tok); newline.pos < tok->pos;
+        newline.pos = (uint32_t)tau_token_find_newline(tok, newline.pos + 1))
+      {
+        tau_token_json_dump(stream, &newline);
+        fputc(',', stream);
+      }
+    }
+
     tau_token_json_dump(stream, tok);
 
+    prev = tok;
+
     if (i + 1 < tau_vector_size(vec))
       fputc(',', stream);
   }
@@ -9,29 +9,33 @@
 
 #include "stages/parser/shyd.h"
 
-static void tau_parser_skip_newlines(tau_parser_t* par)
+/**
+ * \brief Returns the newline token preceding the token at the given index.
+ *
+ * \details Tokens do not carry newlines, so the newline token is materialized
+ * on demand into the parser. It is only valid until the next call.
+ */
+static tau_token_t* tau_parser_newline(tau_parser_t* par, size_t idx)
 {
-  tau_token_t* tok = (tau_token_t*)tau_vector_get(par->tokens, par->cur);
+  tau_token_t* prev = idx == 0 ? NULL : (tau_token_t*)tau_vector_get(par->tokens, idx - 1);
 
-  while (tok->kind == TAU_TOK_NEWLINE)
-  {
-    par->cur++;
-    tok = (tau_token_t*)tau_vector_get(par->tokens, par->cur);
-  }
+  par->newline = tau_token_newline_before(prev, (tau_token_t*)tau_vector_get(par->tokens, idx));
+
+  return &par->newline;
 }
 
-static tau_ast_node_t* tau_parser_cstr_to_prim(const char* cstr)
+static tau_ast_node_t* tau_parser_cstr_to_prim(tau_parser_t* par, const char* cstr)
 {
-  if (strncmp(cstr, "i8" , 2) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i8_init();
-  if (strncmp(cstr, "u8" , 2) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u8_init();
-  if (strncmp(cstr, "i16", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i16_init();
-  if (strncmp(cstr, "u16", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u16_init();
-  if (strncmp(cstr, "i32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i32_init();
-  if (strncmp(cstr, "u32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u32_init();
-  if (strncmp(cstr, "i64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i64_init();
-  if (strncmp(cstr, "u64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u64_init();
-  if (strncmp(cstr, "f32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_f32_init();
-  if (strncmp(cstr, "f64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_f64_init();
+  if (strncmp(cstr, "i8" , 2) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i8_init(par->arena);
+  if (strncmp(cstr, "u8" , 2) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u8_init(par->arena);
+  if (strncmp(cstr, "i16", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i16_init(par->arena);
+  if (strncmp(cstr, "u16", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u16_init(par->arena);
+  if (strncmp(cstr, "i32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i32_init(par->arena);
+  if (strncmp(cstr, "u32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u32_init(par->arena);
+  if (strncmp(cstr, "i64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_i64_init(par->arena);
+  if (strncmp(cstr, "u64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_u64_init(par->arena);
+  if (strncmp(cstr, "f32", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_f32_init(par->arena);
+  if (strncmp(cstr, "f64", 3) == 0) return (tau_ast_node_t*)tau_ast_type_prim_f64_init(par->arena);
 
   TAU_UNREACHABLE();
 }
@@ -54,18 +58,29 @@ void tau_parser_free(tau_parser_t* par)
 
 tau_token_t* tau_parser_current(tau_parser_t* par)
 {
+  tau_token_t* tok = (tau_token_t*)tau_vector_get(par->tokens, par->cur);
+
+  // Once a newline was looked past while newlines are ignored it stays
+  // skipped, even if newlines stop being ignored.
   if (par->ignore_newlines)
-    tau_parser_skip_newlines(par);
+    par->newline_skipped = true;
+  else if (!par->newline_skipped && (tok->flags & TAU_TOKEN_FLAG_NEWLINE) != 0)
+    return tau_parser_newline(par, par->cur);
 
-  return (tau_token_t*)tau_vector_get(par->tokens, par->cur);
+  return tok;
 }
 
 tau_token_t* tau_parser_next(tau_parser_t* par)
 {
   tau_token_t* tok = tau_parser_current(par);
 
-  if (tok->kind != TAU_TOK_EOF)
+  if (tok->kind == TAU_TOK_NEWLINE)
+    par->newline_skipped = true;
+  else if (tok->kind != TAU_TOK_EOF)
+  {
     par->cur++;
+    par->newline_skipped = false;
+  }
 
   return tok;
 }
@@ -74,13 +89,16 @@ tau_token_t* tau_parser_peek(tau_parser_t* par)
 {
   tau_token_t* tok = tau_parser_current(par);
 
+  if (tok->kind == TAU_TOK_NEWLINE)
+    return (tau_token_t*)tau_vector_get(par->tokens, par->cur);
+
   if (tok->kind == TAU_TOK_EOF)
     return tok;
 
-  size_t next = par->cur + 1;
+  tok = (tau_token_t*)tau_vector_get(par->tokens, par->cur + 1);
 
-  while (par->ignore_newlines && (tok = (tau_token_t*)tau_vector_get(par->tokens, next))->kind == TAU_TOK_NEWLINE)
-    next++;
+  if (!par->ignore_newlines && (tok->flags & TAU_TOKEN_FLAG_NEWLINE) != 0)
+    return tau_parser_newline(par, par->cur + 1);
 
   return tok;
 }
@@ -200,31 +218,31 @@ tau_callconv_kind_t tau_parser_parse_callconv(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_id(tau_parser_t* par)
 {
-  tau_ast_id_t* node = tau_ast_id_init();
+  tau_ast_id_t* node = tau_ast_id_init(par->arena);
 
   node->tok = tau_parser_expect(par, TAU_TOK_ID);
 
   if (node->tok == NULL)
-    return (tau_ast_node_t*)tau_ast_poison_init();
+    return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
 
   return (tau_ast_node_t*)node;
 }
 
 tau_ast_node_t* tau_parser_parse_type_id(tau_parser_t* par)
 {
-  tau_ast_type_id_t* node = tau_ast_type_id_init();
+  tau_ast_type_id_t* node = tau_ast_type_id_init(par->arena);
 
   node->tok = tau_parser_expect(par, TAU_TOK_ID);
 
   if (node->tok == NULL)
-    return (tau_ast_node_t*)tau_ast_poison_init();
+    return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
 
   return (tau_ast_node_t*)node;
 }
 
 tau_ast_node_t* tau_parser_parse_type_mut(tau_parser_t* par)
 {
-  tau_ast_type_mut_t* node = tau_ast_type_mut_init();
+  tau_ast_type_mut_t* node = tau_ast_type_mut_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_MUT);
@@ -236,7 +254,7 @@ tau_ast_node_t* tau_parser_parse_type_mut(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_ptr(tau_parser_t* par)
 {
-  tau_ast_type_ptr_t* node = tau_ast_type_ptr_init();
+  tau_ast_type_ptr_t* node = tau_ast_type_ptr_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_ASTERISK);
@@ -248,7 +266,7 @@ tau_ast_node_t* tau_parser_parse_type_ptr(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_array(tau_parser_t* par)
 {
-  tau_ast_type_array_t* node = tau_ast_type_array_init();
+  tau_ast_type_array_t* node = tau_ast_type_array_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_BRACKET_LEFT);
@@ -264,7 +282,7 @@ tau_ast_node_t* tau_parser_parse_type_array(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_ref(tau_parser_t* par)
 {
-  tau_ast_type_ref_t* node = tau_ast_type_ref_init();
+  tau_ast_type_ref_t* node = tau_ast_type_ref_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_AMPERSAND);
@@ -276,7 +294,7 @@ tau_ast_node_t* tau_parser_parse_type_ref(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_opt(tau_parser_t* par)
 {
-  tau_ast_type_opt_t* node = tau_ast_type_opt_init();
+  tau_ast_type_opt_t* node = tau_ast_type_opt_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_QUESTION);
@@ -288,7 +306,7 @@ tau_ast_node_t* tau_parser_parse_type_opt(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_fun(tau_parser_t* par)
 {
-  tau_ast_type_fun_t* node = tau_ast_type_fun_init();
+  tau_ast_type_fun_t* node = tau_ast_type_fun_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->callconv = TAU_CALLCONV_TAU;
@@ -311,7 +329,7 @@ tau_ast_node_t* tau_parser_parse_type_fun(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_vec(tau_parser_t* par)
 {
-  tau_ast_type_vec_t* node = tau_ast_type_vec_init();
+  tau_ast_type_vec_t* node = tau_ast_type_vec_init(par->arena);
   node->tok = tau_parser_next(par);
 
   tau_string_view_t tok_view = tau_token_to_string_view(node->tok);
@@ -325,7 +343,7 @@ tau_ast_node_t* tau_parser_parse_type_vec(tau_parser_t* par)
 
   node->size = size;
 
-  node->base_type = tau_parser_cstr_to_prim(size_end);
+  node->base_type = tau_parser_cstr_to_prim(par, size_end);
   node->base_type->tok = node->tok;
 
   return (tau_ast_node_t*)node;
@@ -333,7 +351,7 @@ tau_ast_node_t* tau_parser_parse_type_vec(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_type_mat(tau_parser_t* par)
 {
-  tau_ast_type_mat_t* node = tau_ast_type_mat_init();
+  tau_ast_type_mat_t* node = tau_ast_type_mat_init(par->arena);
   node->tok = tau_parser_next(par);
 
   tau_string_view_t tok_view = tau_token_to_string_view(node->tok);
@@ -364,7 +382,7 @@ tau_ast_node_t* tau_parser_parse_type_mat(tau_parser_t* par)
   else
     node->cols = rows;
 
-  node->base_type = tau_parser_cstr_to_prim(size_end);
+  node->base_type = tau_parser_cstr_to_prim(par, size_end);
   node->base_type->tok = node->tok;
 
   return (tau_ast_node_t*)node;
@@ -376,7 +394,7 @@ tau_ast_node_t* tau_parser_parse_type_member(tau_parser_t* par)
 
   while (tau_parser_consume(par, TAU_TOK_PUNCT_DOT))
   {
-    tau_ast_type_mbr_t* member_node = tau_ast_type_mbr_init();
+    tau_ast_type_mbr_t* member_node = tau_ast_type_mbr_init(par->arena);
     member_node->tok = tau_parser_current(par);
 
     member_node->parent = node;
@@ -404,87 +422,87 @@ tau_ast_node_t* tau_parser_parse_type(tau_parser_t* par)
   case TAU_TOK_KW_VEC:             return tau_parser_parse_type_vec     (par);
   case TAU_TOK_KW_MAT:             return tau_parser_parse_type_mat     (par);
   case TAU_TOK_KW_I8:
-    node = (tau_ast_node_t*)tau_ast_type_prim_i8_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_i8_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_I8);
     break;
   case TAU_TOK_KW_I16:
-    node = (tau_ast_node_t*)tau_ast_type_prim_i16_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_i16_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_I16);
     break;
   case TAU_TOK_KW_I32:
-    node = (tau_ast_node_t*)tau_ast_type_prim_i32_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_i32_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_I32);
     break;
   case TAU_TOK_KW_I64:
-    node = (tau_ast_node_t*)tau_ast_type_prim_i64_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_i64_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_I64);
     break;
   case TAU_TOK_KW_ISIZE:
-    node = (tau_ast_node_t*)tau_ast_type_prim_isize_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_isize_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_ISIZE);
     break;
   case TAU_TOK_KW_U8:
-    node = (tau_ast_node_t*)tau_ast_type_prim_u8_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_u8_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_U8);
     break;
   case TAU_TOK_KW_U16:
-    node = (tau_ast_node_t*)tau_ast_type_prim_u16_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_u16_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_U16);
     break;
   case TAU_TOK_KW_U32:
-    node = (tau_ast_node_t*)tau_ast_type_prim_u32_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_u32_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_U32);
     break;
   case TAU_TOK_KW_U64:
-    node = (tau_ast_node_t*)tau_ast_type_prim_u64_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_u64_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_U64);
     break;
   case TAU_TOK_KW_USIZE:
-    node = (tau_ast_node_t*)tau_ast_type_prim_usize_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_usize_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_USIZE);
     break;
   case TAU_TOK_KW_F32:
-    node = (tau_ast_node_t*)tau_ast_type_prim_f32_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_f32_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_F32);
     break;
   case TAU_TOK_KW_F64:
-    node = (tau_ast_node_t*)tau_ast_type_prim_f64_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_f64_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_F64);
     break;
   case TAU_TOK_KW_C64:
-    node = (tau_ast_node_t*)tau_ast_type_prim_c64_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_c64_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_C64);
     break;
   case TAU_TOK_KW_C128:
-    node = (tau_ast_node_t*)tau_ast_type_prim_c128_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_c128_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_C128);
     break;
   case TAU_TOK_KW_CHAR:
-    node = (tau_ast_node_t*)tau_ast_type_prim_char_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_char_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_CHAR);
     break;
   case TAU_TOK_KW_BOOL:
-    node = (tau_ast_node_t*)tau_ast_type_prim_bool_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_bool_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_BOOL);
     break;
   case TAU_TOK_KW_UNIT:
-    node = (tau_ast_node_t*)tau_ast_type_prim_unit_init();
+    node = (tau_ast_node_t*)tau_ast_type_prim_unit_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_UNIT);
     break;
   case TAU_TOK_KW_TYPE:
-    node = (tau_ast_node_t*)tau_ast_type_type_init();
+    node = (tau_ast_node_t*)tau_ast_type_type_init(par->arena);
     node->tok = tau_parser_expect(par, TAU_TOK_KW_TYPE);
     break;
   default:
   {
     tau_error_bag_put_parser_unexpected_token(par->errors, tau_token_location(tau_parser_current(par)));
 
-    return (tau_ast_node_t*)tau_ast_poison_init();
+    return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
   }
   }
 
   if (node->tok == NULL)
-    return (tau_ast_node_t*)tau_ast_poison_init();
+    return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
 
   return node;
 }
@@ -496,7 +514,7 @@ tau_ast_node_t* tau_parser_parse_expr(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_if(tau_parser_t* par)
 {
-  tau_ast_stmt_if_t* node = tau_ast_stmt_if_init();
+  tau_ast_stmt_if_t* node = tau_ast_stmt_if_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_IF);
@@ -513,7 +531,7 @@ tau_ast_node_t* tau_parser_parse_stmt_if(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_for(tau_parser_t* par)
 {
-  tau_ast_stmt_for_t* node = tau_ast_stmt_for_init();
+  tau_ast_stmt_for_t* node = tau_ast_stmt_for_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_FOR);
@@ -533,7 +551,7 @@ tau_ast_node_t* tau_parser_parse_stmt_for(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_for_var(tau_parser_t* par)
 {
-  tau_ast_decl_var_t* node = tau_ast_decl_var_init();
+  tau_ast_decl_var_t* node = tau_ast_decl_var_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->is_pub    = false;
@@ -551,7 +569,7 @@ tau_ast_node_t* tau_parser_parse_stmt_for_var(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_while(tau_parser_t* par)
 {
-  tau_ast_stmt_while_t* node = tau_ast_stmt_while_init();
+  tau_ast_stmt_while_t* node = tau_ast_stmt_while_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_WHILE);
@@ -567,7 +585,7 @@ tau_ast_node_t* tau_parser_parse_stmt_while(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_do_while(tau_parser_t* par)
 {
-  tau_ast_stmt_do_while_t* node = tau_ast_stmt_do_while_init();
+  tau_ast_stmt_do_while_t* node = tau_ast_stmt_do_while_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_DO);
@@ -583,7 +601,7 @@ tau_ast_node_t* tau_parser_parse_stmt_do_while(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_loop(tau_parser_t* par)
 {
-  tau_ast_stmt_loop_t* node = tau_ast_stmt_loop_init();
+  tau_ast_stmt_loop_t* node = tau_ast_stmt_loop_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_LOOP);
@@ -595,7 +613,7 @@ tau_ast_node_t* tau_parser_parse_stmt_loop(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_break(tau_parser_t* par)
 {
-  tau_ast_stmt_break_t* node = tau_ast_stmt_break_init();
+  tau_ast_stmt_break_t* node = tau_ast_stmt_break_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_BREAK);
@@ -605,7 +623,7 @@ tau_ast_node_t* tau_parser_parse_stmt_break(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_continue(tau_parser_t* par)
 {
-  tau_ast_stmt_continue_t* node = tau_ast_stmt_continue_init();
+  tau_ast_stmt_continue_t* node = tau_ast_stmt_continue_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_CONTINUE);
@@ -615,7 +633,7 @@ tau_ast_node_t* tau_parser_parse_stmt_continue(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_return(tau_parser_t* par)
 {
-  tau_ast_stmt_return_t* node = tau_ast_stmt_return_init();
+  tau_ast_stmt_return_t* node = tau_ast_stmt_return_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_RETURN);
@@ -627,7 +645,7 @@ tau_ast_node_t* tau_parser_parse_stmt_return(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_defer(tau_parser_t* par)
 {
-  tau_ast_stmt_defer_t* node = tau_ast_stmt_defer_init();
+  tau_ast_stmt_defer_t* node = tau_ast_stmt_defer_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_KW_DEFER);
@@ -639,7 +657,7 @@ tau_ast_node_t* tau_parser_parse_stmt_defer(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_block(tau_parser_t* par)
 {
-  tau_ast_stmt_block_t* node = tau_ast_stmt_block_init();
+  tau_ast_stmt_block_t* node = tau_ast_stmt_block_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_BRACE_LEFT);
@@ -651,7 +669,7 @@ tau_ast_node_t* tau_parser_parse_stmt_block(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_stmt_expr(tau_parser_t* par)
 {
-  tau_ast_stmt_expr_t* node = tau_ast_stmt_expr_init();
+  tau_ast_stmt_expr_t* node = tau_ast_stmt_expr_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->expr = tau_parser_parse_expr(par);
@@ -688,7 +706,7 @@ tau_ast_node_t* tau_parser_parse_stmt(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_var(tau_parser_t* par)
 {
-  tau_ast_decl_var_t* node = tau_ast_decl_var_init();
+  tau_ast_decl_var_t* node = tau_ast_decl_var_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->is_pub    = par->decl_ctx.is_pub;
@@ -714,7 +732,7 @@ tau_ast_node_t* tau_parser_parse_decl_fun(tau_parser_t* par)
     return tau_parser_parse_decl_generic_fun(par);
   }
 
-  tau_ast_decl_fun_t* node = tau_ast_decl_fun_init();
+  tau_ast_decl_fun_t* node = tau_ast_decl_fun_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -805,7 +823,7 @@ tau_ast_node_t* tau_parser_parse_decl_fun(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_generic_fun(tau_parser_t* par)
 {
-  tau_ast_decl_generic_fun_t* node = tau_ast_decl_generic_fun_init();
+  tau_ast_decl_generic_fun_t* node = tau_ast_decl_generic_fun_init(par->arena);
   node->tok = tau_parser_current(par);
   node->is_pub = par->decl_ctx.is_pub;
 
@@ -836,7 +854,7 @@ tau_ast_node_t* tau_parser_parse_decl_generic_fun(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_struct(tau_parser_t* par)
 {
-  tau_ast_decl_struct_t* node = tau_ast_decl_struct_init();
+  tau_ast_decl_struct_t* node = tau_ast_decl_struct_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -862,7 +880,7 @@ tau_ast_node_t* tau_parser_parse_decl_struct_member(tau_parser_t* par)
   if (tau_parser_current(par)->kind == TAU_TOK_KW_PUB)
     tau_parser_parse_decl_context_pub(par);
 
-  tau_ast_decl_var_t* node = tau_ast_decl_var_init();
+  tau_ast_decl_var_t* node = tau_ast_decl_var_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->is_pub    = par->decl_ctx.is_pub;
@@ -880,7 +898,7 @@ tau_ast_node_t* tau_parser_parse_decl_struct_member(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_union(tau_parser_t* par)
 {
-  tau_ast_decl_union_t* node = tau_ast_decl_union_init();
+  tau_ast_decl_union_t* node = tau_ast_decl_union_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -901,7 +919,7 @@ tau_ast_node_t* tau_parser_parse_decl_union(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_union_member(tau_parser_t* par)
 {
-  tau_ast_decl_var_t* node = tau_ast_decl_var_init();
+  tau_ast_decl_var_t* node = tau_ast_decl_var_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->is_pub    = true;
@@ -919,7 +937,7 @@ tau_ast_node_t* tau_parser_parse_decl_union_member(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_enum(tau_parser_t* par)
 {
-  tau_ast_decl_enum_t* node = tau_ast_decl_enum_init();
+  tau_ast_decl_enum_t* node = tau_ast_decl_enum_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -944,7 +962,7 @@ tau_ast_node_t* tau_parser_parse_decl_enum(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_mod(tau_parser_t* par)
 {
-  tau_ast_decl_mod_t* node = tau_ast_decl_mod_init();
+  tau_ast_decl_mod_t* node = tau_ast_decl_mod_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -969,7 +987,7 @@ tau_ast_node_t* tau_parser_parse_decl_mod(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_type_alias(tau_parser_t* par)
 {
-  tau_ast_decl_type_alias_t* node = tau_ast_decl_type_alias_init();
+  tau_ast_decl_type_alias_t* node = tau_ast_decl_type_alias_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -999,7 +1017,7 @@ tau_ast_node_t* tau_parser_parse_decl(tau_parser_t* par)
   {
     tau_error_bag_put_parser_unexpected_token(par->errors, tau_token_location(tau_parser_current(par)));
 
-    return (tau_ast_node_t*)tau_ast_poison_init();
+    return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
   }
   }
 
@@ -1037,7 +1055,7 @@ tau_ast_node_t* tau_parser_parse_decl_top_level(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_param(tau_parser_t* par)
 {
-  tau_ast_decl_param_t* node = tau_ast_decl_param_init();
+  tau_ast_decl_param_t* node = tau_ast_decl_param_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->id = tau_parser_parse_id(par);
@@ -1053,7 +1071,7 @@ tau_ast_node_t* tau_parser_parse_decl_param(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_generic_param(tau_parser_t* par)
 {
-  tau_ast_decl_generic_param_t* node = tau_ast_decl_generic_param_init();
+  tau_ast_decl_generic_param_t* node = tau_ast_decl_generic_param_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->id = tau_parser_parse_id(par);
@@ -1069,7 +1087,7 @@ tau_ast_node_t* tau_parser_parse_decl_generic_param(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_decl_enum_constant(tau_parser_t* par)
 {
-  tau_ast_decl_enum_constant_t* node = tau_ast_decl_enum_constant_init();
+  tau_ast_decl_enum_constant_t* node = tau_ast_decl_enum_constant_init(par->arena);
   node->tok = tau_parser_current(par);
   node->parent = tau_stack_top(par->parents);
 
@@ -1080,7 +1098,7 @@ tau_ast_node_t* tau_parser_parse_decl_enum_constant(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_path_segment(tau_parser_t* par)
 {
-  tau_ast_path_segment_t* node = tau_ast_path_segment_init();
+  tau_ast_path_segment_t* node = tau_ast_path_segment_init(par->arena);
   node->tok = tau_parser_current(par);
 
   node->id = tau_parser_parse_id(par);
@@ -1090,7 +1108,7 @@ tau_ast_node_t* tau_parser_parse_path_segment(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_path_wildcard(tau_parser_t* par)
 {
-  tau_ast_path_wildcard_t* node = tau_ast_path_wildcard_init();
+  tau_ast_path_wildcard_t* node = tau_ast_path_wildcard_init(par->arena);
   node->tok = tau_parser_expect(par, TAU_TOK_PUNCT_ASTERISK);
 
   return (tau_ast_node_t*)node;
@@ -1098,7 +1116,7 @@ tau_ast_node_t* tau_parser_parse_path_wildcard(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_path_list(tau_parser_t* par)
 {
-  tau_ast_path_list_t* node = tau_ast_path_list_init();
+  tau_ast_path_list_t* node = tau_ast_path_list_init(par->arena);
   node->tok = tau_parser_current(par);
 
   tau_parser_expect(par, TAU_TOK_PUNCT_BRACKET_LEFT);
@@ -1116,7 +1134,7 @@ tau_ast_node_t* tau_parser_parse_path(tau_parser_t* par)
 
   while (tau_parser_consume(par, TAU_TOK_PUNCT_DOT))
   {
-    tau_ast_path_access_t* access_node = tau_ast_path_access_init();
+    tau_ast_path_access_t* access_node = tau_ast_path_access_init(par->arena);
     access_node->tok = tau_parser_current(par);
 
     access_node->lhs = node;
@@ -1131,14 +1149,14 @@ tau_ast_node_t* tau_parser_parse_path(tau_parser_t* par)
     {
       tau_error_bag_put_parser_unexpected_token(par->errors, tau_token_location(tau_parser_current(par)));
 
-      return (tau_ast_node_t*)tau_ast_poison_init();
+      return (tau_ast_node_t*)tau_ast_poison_init(par->arena);
     }
     }
   }
 
   if (tau_parser_consume(par, TAU_TOK_KW_AS))
   {
-    tau_ast_path_alias_t* alias_node = tau_ast_path_alias_init();
+    tau_ast_path_alias_t* alias_node = tau_ast_path_alias_init(par->arena);
     alias_node->tok = tau_parser_current(par);
 
     alias_node->path = node;
@@ -1152,7 +1170,7 @@ tau_ast_node_t* tau_parser_parse_path(tau_parser_t* par)
 
 tau_ast_node_t* tau_parser_parse_use_directive(tau_parser_t* par)
 {
-  tau_ast_use_t* node = tau_ast_use_init();
+  tau_ast_use_t* node = tau_ast_use_init(par->arena);
   node->tok = tau_parser_expect(par, TAU_TOK_KW_USE);
 
   node->path = tau_parser_parse_path(par);
@@ -1160,10 +1178,12 @@ tau_ast_node_t* tau_parser_parse_use_directive(tau_parser_t* par)
   return (tau_ast_node_t*)node;
 }
 
-tau_ast_node_t* tau_parser_parse(tau_parser_t* par, tau_vector_t* tokens, tau_error_bag_t* errors)
+tau_ast_node_t* tau_parser_parse(tau_parser_t* par, tau_vector_t* tokens, tau_arena_t* arena, tau_error_bag_t* errors)
 {
   par->tokens = tokens;
+  par->arena = arena;
   par->cur = 0;
+  par->newline_skipped = false;
   par->errors = errors;
 
   tau_stack_clear(par->parents);
@@ -1172,7 +1192,7 @@ tau_ast_node_t* tau_parser_parse(tau_parser_t* par, tau_vector_t* tokens, tau_er
   tau_parser_set_ignore_newline(par, true);
   tau_parser_decl_context_clear(par);
 
-  tau_ast_prog_t* root = tau_ast_prog_init();
+  tau_ast_prog_t* root = tau_ast_prog_init(par->arena);
   root->tok = tau_parser_current(par);
 
   while (!tau_parser_consume(par, TAU_TOK_EOF))
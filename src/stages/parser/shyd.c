@@ -11,7 +11,7 @@
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_id(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_id_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_id_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -20,7 +20,7 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_id(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_int(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_int_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_int_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -44,7 +44,7 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_lit_int(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_flt(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_flt_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_flt_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -57,13 +57,13 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_lit_flt(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_str(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_str_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_str_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
   tau_location_t loc = tau_token_location(node->tok);
 
-  ((tau_ast_expr_lit_str_t*)node)->value = (char*)malloc(sizeof(char) * (loc.len - 1));
+  ((tau_ast_expr_lit_str_t*)node)->value = (char*)tau_arena_alloc(ctx->par->arena, sizeof(char) * (loc.len - 1));
   memset(((tau_ast_expr_lit_str_t*)node)->value, 0, sizeof(char) * (loc.len - 1));
   strncpy(((tau_ast_expr_lit_str_t*)node)->value, loc.ptr + 1, loc.len - 2);
 
@@ -72,7 +72,7 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_lit_str(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_char(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_char_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_char_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -83,7 +83,7 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_lit_char(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_bool(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_bool_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_bool_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -96,7 +96,7 @@ static tau_ast_node_t* tau_shyd_parse_expr_term_lit_bool(tau_shyd_ctx_t* ctx)
 
 static tau_ast_node_t* tau_shyd_parse_expr_term_lit_null(tau_shyd_ctx_t* ctx)
 {
-  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_null_init();
+  tau_ast_node_t* node = (tau_ast_node_t*)tau_ast_expr_lit_null_init(ctx->par->arena);
 
   node->tok = tau_parser_next(ctx->par);
 
@@ -328,7 +328,7 @@ bool tau_shyd_parse_lit_vec_or_mat(tau_shyd_ctx_t* ctx)
 
   if (is_matrix)
   {
-    tau_ast_expr_lit_mat_t* mat_node = tau_ast_expr_lit_mat_init();
+    tau_ast_expr_lit_mat_t* mat_node = tau_ast_expr_lit_mat_init(ctx->par->arena);
     mat_node->tok = token;
     mat_node->rows = tau_vector_size(values) / cols;
     mat_node->cols = cols;
@@ -339,7 +339,7 @@ bool tau_shyd_parse_lit_vec_or_mat(tau_shyd_ctx_t* ctx)
   }
   else
   {
-    tau_ast_expr_lit_vec_t* vec_node = tau_ast_expr_lit_vec_init();
+    tau_ast_expr_lit_vec_t* vec_node = tau_ast_expr_lit_vec_init(ctx->par->arena);
     vec_node->tok = token;
 
     tau_vector_extend(vec_node->values, values);
@@ -361,7 +361,7 @@ bool tau_shyd_parse_expr_op_call(tau_shyd_ctx_t* ctx)
   if (!ctx->prev_term)
     return false;
 
-  tau_ast_expr_op_call_t* node = tau_ast_expr_op_call_init();
+  tau_ast_expr_op_call_t* node = tau_ast_expr_op_call_init(ctx->par->arena);
   node->tok = tau_parser_current(ctx->par);
   node->op_kind = OP_CALL;
 
@@ -390,7 +390,7 @@ bool tau_shyd_parse_expr_op_spec(tau_shyd_ctx_t* ctx)
   if (!ctx->prev_term)
     return false;
 
-  tau_ast_expr_op_spec_t* node = tau_ast_expr_op_spec_init();
+  tau_ast_expr_op_spec_t* node = tau_ast_expr_op_spec_init(ctx->par->arena);
   node->tok = tau_parser_current(ctx->par);
 
   tau_parser_expect(ctx->par, TAU_TOK_PUNCT_DOT_LESS);
@@ -555,7 +555,7 @@ void tau_shyd_parse_postfix(tau_shyd_ctx_t* ctx)
 
 void tau_shyd_ast_expr_op_un(tau_shyd_ctx_t* ctx, tau_shyd_elem_t* elem)
 {
-  tau_ast_expr_op_un_t* node = tau_ast_expr_op_un_init();
+  tau_ast_expr_op_un_t* node = tau_ast_expr_op_un_init(ctx->par->arena);
   node->tok = elem->tok;
   node->op_kind = elem->op;
 
@@ -576,8 +576,8 @@ void tau_shyd_ast_expr_op_bin(tau_shyd_ctx_t* ctx, tau_shyd_elem_t* elem)
 
   switch (elem->op)
   {
-  case OP_ACCESS_DIRECT: node = (tau_ast_expr_op_bin_t*)tau_ast_expr_op_bin_access_direct_init(); break;
-  default: node = tau_ast_expr_op_bin_init(); break;
+  case OP_ACCESS_DIRECT: node = (tau_ast_expr_op_bin_t*)tau_ast_expr_op_bin_access_direct_init(ctx->par->arena); break;
+  default: node = tau_ast_expr_op_bin_init(ctx->par->arena); break;
   }
 
   node->tok = elem->tok;
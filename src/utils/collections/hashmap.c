@@ -0,0 +1,163 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "utils/collections/hashmap.h"
+
+/// The initial number of slots in a hash map, must be a power of two.
+#define TAU_HASHMAP_INITIAL_CAPACITY ((size_t)16)
+
+struct tau_hashmap_t
+{
+  tau_hashmap_entry_t* entries; ///< Array of slots.
+  size_t size; ///< The number of values in the hash map.
+  size_t capacity; ///< The number of slots, always a power of two.
+};
+
+/**
+ * \brief Doubles the number of slots in a hash map.
+ *
+ * \param[in,out] map Pointer to the hash map to be expanded.
+ */
+static void tau_hashmap_expand(tau_hashmap_t* map)
+{
+  size_t new_capacity = map->capacity << 1;
+  size_t mask = new_capacity - 1;
+
+  tau_hashmap_entry_t* new_entries = (tau_hashmap_entry_t*)calloc(new_capacity, sizeof(tau_hashmap_entry_t));
+  TAU_ASSERT(new_entries != NULL);
+
+  for (size_t i = 0; i < map->capacity; i++)
+  {
+    if (map->entries[i].value == NULL)
+      continue;
+
+    size_t idx = (size_t)map->entries[i].hash & mask;
+
+    while (new_entries[idx].value != NULL)
+      idx = (idx + 1) & mask;
+
+    new_entries[idx] = map->entries[i];
+  }
+
+  free(map->entries);
+
+  map->entries = new_entries;
+  map->capacity = new_capacity;
+}
+
+tau_hashmap_t* tau_hashmap_init(void)
+{
+  return tau_hashmap_init_with_capacity(TAU_HASHMAP_INITIAL_CAPACITY / 2);
+}
+
+tau_hashmap_t* tau_hashmap_init_with_capacity(size_t capacity)
+{
+  tau_hashmap_t* map = (tau_hashmap_t*)malloc(sizeof(tau_hashmap_t));
+  TAU_ASSERT(map != NULL);
+
+  map->size = 0;
+  map->capacity = TAU_HASHMAP_INITIAL_CAPACITY;
+
+  while (map->capacity < capacity * 2)
+    map->capacity <<= 1;
+
+  map->entries = (tau_hashmap_entry_t*)calloc(map->capacity, sizeof(tau_hashmap_entry_t));
+  TAU_ASSERT(map->entries != NULL);
+
+  return map;
+}
+
+void tau_hashmap_free(tau_hashmap_t* map)
+{
+  free(map->entries);
+  free(map);
+}
+
+tau_hashmap_entry_t* tau_hashmap_find(tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key)
+{
+  size_t mask = map->capacity - 1;
+
+  for (size_t idx = (size_t)hash & mask;; idx = (idx + 1) & mask)
+  {
+    tau_hashmap_entry_t* entry = &map->entries[idx];
+
+    if (entry->value == NULL)
+    {
+      entry->hash = hash;
+      return entry;
+    }
+
+    if (entry->hash == hash && match(entry->value, key))
+      return entry;
+  }
+}
+
+void tau_hashmap_insert(tau_hashmap_t* restrict map, tau_hashmap_entry_t* restrict entry, void* restrict value)
+{
+  TAU_ASSERT(entry->value == NULL);
+  TAU_ASSERT(value != NULL);
+
+  entry->value = value;
+
+  // Keep the load factor at or below one half so probe sequences stay short.
+  if (++map->size * 2 > map->capacity)
+    tau_hashmap_expand(map);
+}
+
+void* tau_hashmap_get(const tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key)
+{
+  size_t mask = map->capacity - 1;
+
+  for (size_t idx = (size_t)hash & mask; map->entries[idx].value != NULL; idx = (idx + 1) & mask)
+    if (map->entries[idx].hash == hash && match(map->entries[idx].value, key))
+      return map->entries[idx].value;
+
+  return NULL;
+}
+
+void* tau_hashmap_remove(tau_hashmap_t* map, uint64_t hash, tau_hashmap_match_func_t match, const void* key)
+{
+  tau_hashmap_entry_t* entry = tau_hashmap_find(map, hash, match, key);
+  void* value = entry->value;
+
+  if (value == NULL)
+    return NULL;
+
+  size_t mask = map->capacity - 1;
+  size_t hole = (size_t)(entry - map->entries);
+
+  // The entries following the removed one in its probe sequence are shifted
+  // back, so that lookups need no tombstones. An entry can fill the hole if its
+  // home slot is not between the hole and the entry itself.
+  for (size_t idx = (hole + 1) & mask; map->entries[idx].value != NULL; idx = (idx + 1) & mask)
+  {
+    size_t home = (size_t)map->entries[idx].hash & mask;
+
+    if (((idx - home) & mask) >= ((idx - hole) & mask))
+    {
+      map->entries[hole] = map->entries[idx];
+      hole = idx;
+    }
+  }
+
+  map->entries[hole].value = NULL;
+  map->size--;
+
+  return value;
+}
+
+size_t tau_hashmap_size(const tau_hashmap_t* map)
+{
+  return map->size;
+}
+
+void tau_hashmap_for_each(const tau_hashmap_t* map, tau_hashmap_for_each_func_t func)
+{
+  for (size_t i = 0; i < map->capacity; i++)
+    if (map->entries[i].value != NULL)
+      func(map->entries[i].value);
+}
@@ -176,9 +176,19 @@ bool tau_set_remove(tau_set_t* restrict set, void* restrict data)
       set->root = temp;
     }
     else if (node == parent->left)
+    {
+      if (temp != NULL)
+        temp->parent = parent;
+
       parent->left = temp;
+    }
     else
+    {
+      if (temp != NULL)
+        temp->parent = parent;
+
       parent->right = temp;
+    }
 
     tau_set_node_free(node);
   }
@@ -213,7 +223,9 @@ bool tau_set_remove(tau_set_t* restrict set, void* restrict data)
   }
   else
   {
-    tau_set_node_t* min_node = node->left;
+    // Replace the data with that of the in-order successor, which has no left
+    // child, and remove the successor instead.
+    tau_set_node_t* min_node = node->right;
 
     while (min_node->left != NULL)
       min_node = min_node->left;
@@ -223,7 +235,10 @@ bool tau_set_remove(tau_set_t* restrict set, void* restrict data)
     if (min_node->right != NULL)
       min_node->right->parent = min_node->parent;
 
-    min_node->parent->left = min_node->right;
+    if (min_node == node->right)
+      node->right = min_node->right;
+    else
+      min_node->parent->left = min_node->right;
 
     tau_set_node_free(min_node);
   }
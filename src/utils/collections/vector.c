@@ -15,6 +15,7 @@ struct tau_vector_t
   size_t size;     ///< The number of elements in the vector.
   size_t capacity; ///< The maximum number of elements the vector can hold.
   void** data;     ///< Pointer to the contained elements.
+  tau_arena_t* arena; ///< Arena the vector is allocated from or `NULL`.
 };
 
 /**
@@ -28,6 +29,21 @@ static void tau_vector_expand(tau_vector_t* vec, size_t new_capacity)
   if (vec->capacity >= new_capacity)
     return;
 
+  if (vec->arena != NULL)
+  {
+    // Arenas cannot grow allocations in place, the old buffer is abandoned
+    // and released together with the arena.
+    void** data = (void**)tau_arena_alloc(vec->arena, sizeof(void*) * new_capacity);
+    TAU_ASSERT(data != NULL);
+
+    memcpy(data, vec->data, sizeof(void*) * vec->size);
+
+    vec->capacity = new_capacity;
+    vec->data = data;
+
+    return;
+  }
+
   vec->capacity = new_capacity;
   vec->data = (void**)realloc(vec->data, sizeof(void*) * vec->capacity);
   TAU_ASSERT(vec->data != NULL);
@@ -49,6 +65,21 @@ tau_vector_t* tau_vector_init_with_capacity(size_t capacity)
   vec->capacity = capacity;
   vec->data = (void**)malloc(sizeof(void*) * capacity);
   TAU_ASSERT(vec->data != NULL);
+  vec->arena = NULL;
+
+  return vec;
+}
+
+tau_vector_t* tau_vector_init_with_arena(tau_arena_t* arena)
+{
+  tau_vector_t* vec = (tau_vector_t*)tau_arena_alloc(arena, sizeof(tau_vector_t));
+  TAU_ASSERT(vec != NULL);
+
+  vec->size = 0;
+  vec->capacity = TAU_VECTOR_INITIAL_CAPACITY;
+  vec->data = (void**)tau_arena_alloc(arena, sizeof(void*) * TAU_VECTOR_INITIAL_CAPACITY);
+  TAU_ASSERT(vec->data != NULL);
+  vec->arena = arena;
 
   return vec;
 }
@@ -68,6 +99,9 @@ tau_vector_t* tau_vector_init_from_buffer(void* buffer, size_t length)
 
 void tau_vector_free(tau_vector_t* vec)
 {
+  if (vec->arena != NULL)
+    return;
+
   free(vec->data);
   free(vec);
 }
@@ -154,6 +188,10 @@ void* tau_vector_remove(tau_vector_t* vec, size_t idx)
 void tau_vector_clear(tau_vector_t* vec)
 {
   vec->size = 0;
+
+  if (vec->arena != NULL)
+    return;
+
   vec->capacity = TAU_VECTOR_INITIAL_CAPACITY;
 
   vec->data = (void**)realloc(vec->data, sizeof(void*) * TAU_VECTOR_INITIAL_CAPACITY);
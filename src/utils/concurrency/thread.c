@@ -51,6 +51,12 @@ bool tau_thread_equal(tau_thread_t* thread1, tau_thread_t* thread2)
   return pthread_equal(thread1->native_handle, thread2->native_handle) != 0;
 }
 
+size_t tau_thread_hardware_concurrency(void)
+{
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count < 1 ? 1 : (size_t)count;
+}
+
 #elif TAU_OS_WINDOWS
 
 // Required for function CompareObjectHandles.
@@ -125,6 +131,13 @@ bool tau_thread_equal(tau_thread_t* thread1, tau_thread_t* thread2)
   return CompareObjectHandles(thread1->native_handle, thread2->native_handle) == TRUE;
 }
 
+size_t tau_thread_hardware_concurrency(void)
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors < 1 ? 1 : (size_t)info.dwNumberOfProcessors;
+}
+
 #else
 # error "Threads are not implemented for this platform!"
 #endif
@@ -0,0 +1,543 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "utils/concurrency/threadpool.h"
+
+#include "utils/concurrency/condvar.h"
+#include "utils/concurrency/latch.h"
+#include "utils/concurrency/mutex.h"
+#include "utils/concurrency/thread.h"
+
+/// The initial capacity of a task queue, must be a power of two.
+#define THREADPOOL_DEQUE_INITIAL_CAPACITY ((size_t)16)
+
+/**
+ * \brief Represents the shared state of a `tau_threadpool_parallel_for` call.
+ */
+typedef struct tau_threadpool_range_t
+{
+  tau_threadpool_range_func_t func; // The function to be called on subranges.
+  void* arg; // The argument to be passed to the function.
+  size_t grain; // The maximum number of indices per call.
+  tau_latch_t latch; // Counts the indices not processed yet.
+} tau_threadpool_range_t;
+
+/**
+ * \brief Represents a queued task.
+ */
+typedef struct tau_threadpool_task_t
+{
+  tau_threadpool_func_t func; // The function of a plain task.
+  void* arg; // The argument of a plain task.
+  tau_promise_t* promise; // The promise of a submitted task or `NULL`.
+  tau_threadpool_range_t* range; // The parallel for of a range task or `NULL`.
+  size_t begin; // The first index of a range task.
+  size_t end; // One past the last index of a range task.
+} tau_threadpool_task_t;
+
+/**
+ * \brief Represents a double-ended queue of tasks.
+ *
+ * \details Tasks are stored in a ring buffer. The owner pushes and pops at the
+ * back, thieves take from the front.
+ */
+typedef struct tau_threadpool_deque_t
+{
+  tau_mutex_t lock; // Mutex guarding the queue.
+  tau_threadpool_task_t* tasks; // Ring buffer of tasks.
+  size_t head; // Index of the front task.
+  size_t size; // Number of tasks in the queue.
+  size_t capacity; // Number of tasks the buffer can hold, a power of two.
+} tau_threadpool_deque_t;
+
+/**
+ * \brief Represents a worker thread.
+ */
+typedef struct tau_threadpool_worker_t
+{
+  tau_threadpool_t* pool; // Pointer to the owning thread pool.
+  size_t idx; // Index of the worker in the pool.
+  tau_thread_t thread; // The worker thread.
+  tau_threadpool_deque_t deque; // Tasks spawned by the worker.
+} tau_threadpool_worker_t;
+
+struct tau_threadpool_t
+{
+  tau_threadpool_worker_t* workers; // Array of workers.
+  size_t thread_count; // Number of workers.
+  tau_threadpool_deque_t injector; // Tasks spawned outside of the workers.
+  tau_mutex_t lock; // Mutex guarding the fields below.
+  tau_condvar_t work_cond; // Signaled when a task is queued or the pool stops.
+  tau_condvar_t done_cond; // Signaled when a task is queued or finished.
+  size_t sleeper_count; // Number of workers waiting for tasks.
+  size_t waiter_count; // Number of threads waiting for a result.
+  bool is_stopping; // Whether the workers should exit once no tasks are left.
+};
+
+/// The worker running on the current thread or `NULL`.
+static TAU_THREAD_LOCAL tau_threadpool_worker_t* g_threadpool_worker = NULL;
+
+static void tau_threadpool_deque_init(tau_threadpool_deque_t* deque)
+{
+  bool is_init = tau_mutex_init(&deque->lock);
+  TAU_ASSERT(is_init);
+
+  deque->tasks = NULL;
+  deque->head = 0;
+  deque->size = 0;
+  deque->capacity = 0;
+}
+
+static void tau_threadpool_deque_free(tau_threadpool_deque_t* deque)
+{
+  TAU_ASSERT(deque->size == 0);
+
+  tau_mutex_free(&deque->lock);
+
+  if (deque->tasks != NULL)
+    free(deque->tasks);
+}
+
+static void tau_threadpool_deque_push(tau_threadpool_deque_t* deque, const tau_threadpool_task_t* task)
+{
+  tau_mutex_lock(&deque->lock);
+
+  if (deque->size == deque->capacity)
+  {
+    size_t new_capacity = deque->capacity == 0 ? THREADPOOL_DEQUE_INITIAL_CAPACITY : deque->capacity << 1;
+
+    tau_threadpool_task_t* new_tasks = (tau_threadpool_task_t*)malloc(sizeof(tau_threadpool_task_t) * new_capacity);
+    TAU_ASSERT(new_tasks != NULL);
+
+    for (size_t i = 0; i < deque->size; i++)
+      new_tasks[i] = deque->tasks[(deque->head + i) & (deque->capacity - 1)];
+
+    if (deque->tasks != NULL)
+      free(deque->tasks);
+
+    deque->tasks = new_tasks;
+    deque->head = 0;
+    deque->capacity = new_capacity;
+  }
+
+  deque->tasks[(deque->head + deque->size) & (deque->capacity - 1)] = *task;
+  deque->size++;
+
+  tau_mutex_unlock(&deque->lock);
+}
+
+static bool tau_threadpool_deque_pop_back(tau_threadpool_deque_t* deque, tau_threadpool_task_t* task)
+{
+  tau_mutex_lock(&deque->lock);
+
+  bool is_found = deque->size > 0;
+
+  if (is_found)
+  {
+    deque->size--;
+    *task = deque->tasks[(deque->head + deque->size) & (deque->capacity - 1)];
+  }
+
+  tau_mutex_unlock(&deque->lock);
+
+  return is_found;
+}
+
+static bool tau_threadpool_deque_pop_front(tau_threadpool_deque_t* deque, tau_threadpool_task_t* task)
+{
+  tau_mutex_lock(&deque->lock);
+
+  bool is_found = deque->size > 0;
+
+  if (is_found)
+  {
+    *task = deque->tasks[deque->head];
+    deque->head = (deque->head + 1) & (deque->capacity - 1);
+    deque->size--;
+  }
+
+  tau_mutex_unlock(&deque->lock);
+
+  return is_found;
+}
+
+/**
+ * \brief Removes the front-most task of a `tau_threadpool_parallel_for` call
+ * from a queue.
+ */
+static bool tau_threadpool_deque_take_range(tau_threadpool_deque_t* deque, tau_threadpool_range_t* range, tau_threadpool_task_t* task)
+{
+  tau_mutex_lock(&deque->lock);
+
+  bool is_found = false;
+
+  for (size_t i = 0; i < deque->size && !is_found; i++)
+  {
+    if (deque->tasks[(deque->head + i) & (deque->capacity - 1)].range != range)
+      continue;
+
+    *task = deque->tasks[(deque->head + i) & (deque->capacity - 1)];
+    is_found = true;
+
+    for (size_t j = i + 1; j < deque->size; j++)
+      deque->tasks[(deque->head + j - 1) & (deque->capacity - 1)] = deque->tasks[(deque->head + j) & (deque->capacity - 1)];
+
+    deque->size--;
+  }
+
+  tau_mutex_unlock(&deque->lock);
+
+  return is_found;
+}
+
+/**
+ * \brief Returns the worker running on the current thread if it belongs to a
+ * thread pool.
+ */
+static tau_threadpool_worker_t* tau_threadpool_current_worker(tau_threadpool_t* pool)
+{
+  return g_threadpool_worker != NULL && g_threadpool_worker->pool == pool ? g_threadpool_worker : NULL;
+}
+
+/**
+ * \brief Queues a task and wakes up threads waiting for work.
+ */
+static void tau_threadpool_push(tau_threadpool_t* pool, const tau_threadpool_task_t* task)
+{
+  tau_threadpool_worker_t* worker = tau_threadpool_current_worker(pool);
+
+  tau_threadpool_deque_push(worker != NULL ? &worker->deque : &pool->injector, task);
+
+  tau_mutex_lock(&pool->lock);
+
+  if (pool->sleeper_count > 0)
+    tau_condvar_broadcast(&pool->work_cond);
+
+  if (pool->waiter_count > 0)
+    tau_condvar_broadcast(&pool->done_cond);
+
+  tau_mutex_unlock(&pool->lock);
+}
+
+/**
+ * \brief Takes the next task for the current thread.
+ *
+ * \details Workers look at their own queue first, then at the injection queue
+ * and finally try to steal from the other workers.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in,out] worker Pointer to the current worker or `NULL`.
+ * \param[out] task Pointer to the task to be filled in.
+ * \returns `true` if a task was taken, `false` if every queue is empty.
+ */
+static bool tau_threadpool_find(tau_threadpool_t* pool, tau_threadpool_worker_t* worker, tau_threadpool_task_t* task)
+{
+  if (worker != NULL && tau_threadpool_deque_pop_back(&worker->deque, task))
+    return true;
+
+  if (tau_threadpool_deque_pop_front(&pool->injector, task))
+    return true;
+
+  size_t start = worker != NULL ? worker->idx + 1 : 0;
+
+  for (size_t i = 0; i < pool->thread_count; i++)
+  {
+    tau_threadpool_worker_t* victim = &pool->workers[(start + i) % pool->thread_count];
+
+    if (victim != worker && tau_threadpool_deque_pop_front(&victim->deque, task))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Takes a task of a `tau_threadpool_parallel_for` call from any queue.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in,out] worker Pointer to the current worker or `NULL`.
+ * \param[in] range Pointer to the shared state of the call.
+ * \param[out] task Pointer to the task to be filled in.
+ * \returns `true` if a task was taken, `false` if no queue holds one.
+ */
+static bool tau_threadpool_find_range(tau_threadpool_t* pool, tau_threadpool_worker_t* worker, tau_threadpool_range_t* range, tau_threadpool_task_t* task)
+{
+  if (worker != NULL && tau_threadpool_deque_take_range(&worker->deque, range, task))
+    return true;
+
+  if (tau_threadpool_deque_take_range(&pool->injector, range, task))
+    return true;
+
+  for (size_t i = 0; i < pool->thread_count; i++)
+    if (&pool->workers[i] != worker && tau_threadpool_deque_take_range(&pool->workers[i].deque, range, task))
+      return true;
+
+  return false;
+}
+
+/**
+ * \brief Runs a range task, splitting off the upper halves of its range as new
+ * tasks until at most `grain` indices are left.
+ */
+static void tau_threadpool_range_run(tau_threadpool_t* pool, tau_threadpool_task_t* task)
+{
+  tau_threadpool_range_t* range = task->range;
+  size_t begin = task->begin;
+  size_t end = task->end;
+
+  while (end - begin > range->grain)
+  {
+    size_t mid = begin + (end - begin) / 2;
+
+    tau_threadpool_push(pool, &(tau_threadpool_task_t){ .range = range, .begin = mid, .end = end });
+
+    end = mid;
+  }
+
+  range->func(range->arg, begin, end);
+
+  // The range may be freed by the waiting thread from here on.
+  tau_latch_arrive_n(&range->latch, end - begin);
+}
+
+static void tau_threadpool_task_run(tau_threadpool_t* pool, tau_threadpool_task_t* task)
+{
+  if (task->range != NULL)
+    tau_threadpool_range_run(pool, task);
+  else
+  {
+    void* result = task->func(task->arg);
+
+    if (task->promise != NULL)
+      tau_promise_set_value(task->promise, result);
+  }
+
+  tau_mutex_lock(&pool->lock);
+
+  if (pool->waiter_count > 0)
+    tau_condvar_broadcast(&pool->done_cond);
+
+  tau_mutex_unlock(&pool->lock);
+}
+
+static void* tau_threadpool_worker_main(void* arg)
+{
+  tau_threadpool_worker_t* worker = (tau_threadpool_worker_t*)arg;
+  tau_threadpool_t* pool = worker->pool;
+
+  g_threadpool_worker = worker;
+
+  for (;;)
+  {
+    tau_threadpool_task_t task;
+
+    if (tau_threadpool_find(pool, worker, &task))
+    {
+      tau_threadpool_task_run(pool, &task);
+      continue;
+    }
+
+    // Tasks are queued before the pool lock is taken to wake up sleepers, so
+    // looking again while holding the lock cannot miss a wake-up.
+    tau_mutex_lock(&pool->lock);
+
+    pool->sleeper_count++;
+
+    bool is_found = false;
+
+    while (!(is_found = tau_threadpool_find(pool, worker, &task)) && !pool->is_stopping)
+      tau_condvar_wait(&pool->work_cond, &pool->lock);
+
+    pool->sleeper_count--;
+
+    tau_mutex_unlock(&pool->lock);
+
+    if (!is_found)
+      break;
+
+    tau_threadpool_task_run(pool, &task);
+  }
+
+  g_threadpool_worker = NULL;
+
+  return NULL;
+}
+
+/**
+ * \brief Runs queued tasks on the current thread until a condition holds.
+ *
+ * \param[in,out] pool Pointer to the thread pool.
+ * \param[in] range Pointer to the only `tau_threadpool_parallel_for` call whose
+ * tasks may be run or `NULL` to run any task.
+ * \param[in] is_done Function checking the condition.
+ * \param[in] ctx The argument to be passed to `is_done`.
+ */
+static void tau_threadpool_help_until(tau_threadpool_t* pool, tau_threadpool_range_t* range, bool(*is_done)(void*), void* ctx)
+{
+  tau_threadpool_worker_t* worker = tau_threadpool_current_worker(pool);
+
+  while (!is_done(ctx))
+  {
+    tau_threadpool_task_t task;
+
+    if (range != NULL ? tau_threadpool_find_range(pool, worker, range, &task) : tau_threadpool_find(pool, worker, &task))
+    {
+      tau_threadpool_task_run(pool, &task);
+      continue;
+    }
+
+    tau_mutex_lock(&pool->lock);
+
+    pool->waiter_count++;
+
+    bool is_found = false;
+
+    while (!is_done(ctx) && !(is_found = range != NULL ? tau_threadpool_find_range(pool, worker, range, &task) : tau_threadpool_find(pool, worker, &task)))
+      tau_condvar_wait(&pool->done_cond, &pool->lock);
+
+    pool->waiter_count--;
+
+    tau_mutex_unlock(&pool->lock);
+
+    if (is_found)
+      tau_threadpool_task_run(pool, &task);
+  }
+}
+
+static bool tau_threadpool_is_future_ready(void* ctx)
+{
+  return tau_future_get_state((tau_future_t*)ctx) != TAU_FUTURE_PENDING;
+}
+
+static bool tau_threadpool_is_range_done(void* ctx)
+{
+  return tau_latch_get_count(&((tau_threadpool_range_t*)ctx)->latch) == 0;
+}
+
+tau_threadpool_t* tau_threadpool_init(size_t thread_count)
+{
+  tau_threadpool_t* pool = (tau_threadpool_t*)malloc(sizeof(tau_threadpool_t));
+  TAU_ASSERT(pool != NULL);
+
+  pool->workers = NULL;
+  pool->thread_count = thread_count;
+  pool->sleeper_count = 0;
+  pool->waiter_count = 0;
+  pool->is_stopping = false;
+
+  tau_threadpool_deque_init(&pool->injector);
+
+  bool is_init = tau_mutex_init(&pool->lock);
+  is_init = tau_condvar_init(&pool->work_cond) && is_init;
+  is_init = tau_condvar_init(&pool->done_cond) && is_init;
+  TAU_ASSERT(is_init);
+
+  if (thread_count == 0)
+    return pool;
+
+  pool->workers = (tau_threadpool_worker_t*)malloc(sizeof(tau_threadpool_worker_t) * thread_count);
+  TAU_ASSERT(pool->workers != NULL);
+
+  // Every queue must exist before the first worker starts stealing.
+  for (size_t i = 0; i < thread_count; i++)
+  {
+    pool->workers[i].pool = pool;
+    pool->workers[i].idx = i;
+    tau_threadpool_deque_init(&pool->workers[i].deque);
+  }
+
+  for (size_t i = 0; i < thread_count; i++)
+  {
+    bool is_started = tau_thread_init(&pool->workers[i].thread, tau_threadpool_worker_main, &pool->workers[i]);
+    TAU_ASSERT(is_started);
+  }
+
+  return pool;
+}
+
+void tau_threadpool_free(tau_threadpool_t* pool)
+{
+  // Without workers queued tasks have to run here.
+  tau_threadpool_task_t task;
+
+  if (pool->thread_count == 0)
+    while (tau_threadpool_find(pool, NULL, &task))
+      tau_threadpool_task_run(pool, &task);
+
+  tau_mutex_lock(&pool->lock);
+  pool->is_stopping = true;
+  tau_condvar_broadcast(&pool->work_cond);
+  tau_mutex_unlock(&pool->lock);
+
+  for (size_t i = 0; i < pool->thread_count; i++)
+  {
+    tau_thread_join(&pool->workers[i].thread);
+    tau_thread_free(&pool->workers[i].thread);
+  }
+
+  for (size_t i = 0; i < pool->thread_count; i++)
+    tau_threadpool_deque_free(&pool->workers[i].deque);
+
+  if (pool->workers != NULL)
+    free(pool->workers);
+
+  tau_threadpool_deque_free(&pool->injector);
+  tau_condvar_free(&pool->done_cond);
+  tau_condvar_free(&pool->work_cond);
+  tau_mutex_free(&pool->lock);
+
+  free(pool);
+}
+
+size_t tau_threadpool_thread_count(tau_threadpool_t* pool)
+{
+  return pool->thread_count;
+}
+
+void tau_threadpool_spawn(tau_threadpool_t* pool, tau_threadpool_func_t func, void* arg)
+{
+  tau_threadpool_push(pool, &(tau_threadpool_task_t){ .func = func, .arg = arg });
+}
+
+void tau_threadpool_submit(tau_threadpool_t* pool, tau_threadpool_func_t func, void* arg, tau_promise_t* restrict promise, tau_future_t* restrict future)
+{
+  tau_promise_get_future(promise, future);
+  tau_threadpool_push(pool, &(tau_threadpool_task_t){ .func = func, .arg = arg, .promise = promise });
+}
+
+void tau_threadpool_wait(tau_threadpool_t* pool, tau_future_t* future)
+{
+  tau_threadpool_help_until(pool, NULL, tau_threadpool_is_future_ready, future);
+}
+
+void tau_threadpool_parallel_for(tau_threadpool_t* pool, size_t begin, size_t end, size_t grain, tau_threadpool_range_func_t func, void* arg)
+{
+  TAU_ASSERT(grain > 0);
+
+  if (begin >= end)
+    return;
+
+  tau_threadpool_range_t range = {
+    .func = func,
+    .arg = arg,
+    .grain = grain
+  };
+
+  bool is_init = tau_latch_init(&range.latch, end - begin);
+  TAU_ASSERT(is_init);
+
+  // The calling thread starts on the whole range and shares the halves it
+  // splits off with the workers.
+  tau_threadpool_task_t task = { .range = &range, .begin = begin, .end = end };
+  tau_threadpool_range_run(pool, &task);
+
+  // Unrelated tasks could overwrite the thread-local state of the caller, so
+  // only subranges of this call are run while waiting.
+  tau_threadpool_help_until(pool, &range, tau_threadpool_is_range_done, &range);
+
+  tau_latch_free(&range.latch);
+}
@@ -9,11 +9,11 @@
 
 #include "utils/esc_seq.h"
 
-static FILE* g_crumb_stream = NULL;
+static TAU_THREAD_LOCAL FILE* g_crumb_stream = NULL;
 
 static void tau_crumb_snippet_print(tau_crumb_snippet_t* snippet)
 {
-  fprintf(g_crumb_stream, TAU_ESC_FG_BRIGHT_BLACK "[%s:%zu:%zu]\n" TAU_ESC_RESET, snippet->loc.path, snippet->loc.row + 1, snippet->loc.col);
+  fprintf(g_crumb_stream, TAU_ESC_FG_BRIGHT_BLACK "[%s:%zu:%zu]\n" TAU_ESC_RESET, snippet->loc.path, snippet->loc.row + 1, snippet->loc.col + 1);
 
   const char* row_begin = snippet->loc.ptr;
 
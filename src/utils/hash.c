@@ -7,7 +7,136 @@
 
 #include "utils/hash.h"
 
+#include <string.h>
+
+#include "utils/compiler_detect.h"
+
+#if TAU_COMPILER_MSVC
+# include <intrin.h>
+#endif
+
+/**
+ * wyhash
+ *
+ * The hash functions below follow wyhash, which reads the data 8 or 16 bytes
+ * at a time and mixes words by multiplying them into a 128-bit product and
+ * folding its halves together. The constants are the default secret of
+ * wyhash.
+ *
+ * https://github.com/wangyi-fudan/wyhash
+ */
+#define HASH_SECRET0 0x2D358DCCAA6C78A5ULL
+#define HASH_SECRET1 0x8BB84B93962EACC9ULL
+#define HASH_SECRET2 0x4B33A62ED433D4A3ULL
+#define HASH_SECRET3 0x4D5A2DA51DE1AA47ULL
+
+/**
+ * \brief Multiplies two words into a 128-bit product.
+ *
+ * \param[in,out] lhs The left-hand side, replaced with the low half.
+ * \param[in,out] rhs The right-hand side, replaced with the high half.
+ */
+static inline void tau_hash_mum(uint64_t* lhs, uint64_t* rhs)
+{
+#if TAU_COMPILER_MSVC
+  *lhs = _umul128(*lhs, *rhs, rhs);
+#else
+  __extension__ unsigned __int128 product = (unsigned __int128)*lhs * *rhs;
+  *lhs = (uint64_t)product;
+  *rhs = (uint64_t)(product >> 64);
+#endif
+}
+
+/**
+ * \brief Mixes two words into one.
+ */
+static inline uint64_t tau_hash_mix(uint64_t lhs, uint64_t rhs)
+{
+  tau_hash_mum(&lhs, &rhs);
+  return lhs ^ rhs;
+}
+
+static inline uint64_t tau_hash_read8(const uint8_t* ptr)
+{
+  uint64_t value;
+  memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+static inline uint64_t tau_hash_read4(const uint8_t* ptr)
+{
+  uint32_t value;
+  memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+/**
+ * \brief Reads 1 to 3 bytes into a word.
+ */
+static inline uint64_t tau_hash_read3(const uint8_t* ptr, size_t size)
+{
+  return ((uint64_t)ptr[0] << 16) | ((uint64_t)ptr[size >> 1] << 8) | (uint64_t)ptr[size - 1];
+}
+
 uint64_t tau_hash_digest(const void* data, size_t size)
+{
+  const uint8_t* ptr = (const uint8_t*)data;
+  uint64_t seed = tau_hash_mix(HASH_SECRET0, HASH_SECRET1);
+  uint64_t a = 0;
+  uint64_t b = 0;
+
+  if (size <= 16)
+  {
+    if (size >= 4)
+    {
+      // Two overlapping pairs of 4-byte reads cover 4 to 16 bytes.
+      size_t offset = (size >> 3) << 2;
+
+      a = (tau_hash_read4(ptr) << 32) | tau_hash_read4(ptr + offset);
+      b = (tau_hash_read4(ptr + size - 4) << 32) | tau_hash_read4(ptr + size - 4 - offset);
+    }
+    else if (size > 0)
+      a = tau_hash_read3(ptr, size);
+  }
+  else
+  {
+    size_t remaining = size;
+
+    if (remaining > 48)
+    {
+      // Three independent lanes keep the multipliers busy.
+      uint64_t seed1 = seed;
+      uint64_t seed2 = seed;
+
+      do
+      {
+        seed = tau_hash_mix(tau_hash_read8(ptr) ^ HASH_SECRET1, tau_hash_read8(ptr + 8) ^ seed);
+        seed1 = tau_hash_mix(tau_hash_read8(ptr + 16) ^ HASH_SECRET2, tau_hash_read8(ptr + 24) ^ seed1);
+        seed2 = tau_hash_mix(tau_hash_read8(ptr + 32) ^ HASH_SECRET3, tau_hash_read8(ptr + 40) ^ seed2);
+        ptr += 48;
+        remaining -= 48;
+      }
+      while (remaining > 48);
+
+      seed ^= seed1 ^ seed2;
+    }
+
+    for (; remaining > 16; ptr += 16, remaining -= 16)
+      seed = tau_hash_mix(tau_hash_read8(ptr) ^ HASH_SECRET1, tau_hash_read8(ptr + 8) ^ seed);
+
+    // The last 16 bytes, overlapping the ones already mixed in.
+    a = tau_hash_read8(ptr + remaining - 16);
+    b = tau_hash_read8(ptr + remaining - 8);
+  }
+
+  a ^= HASH_SECRET1;
+  b ^= seed;
+  tau_hash_mum(&a, &b);
+
+  return tau_hash_mix(a ^ HASH_SECRET0 ^ (uint64_t)size, b ^ HASH_SECRET1);
+}
+
+uint64_t tau_hash_fnv1a(const void* data, size_t size)
 {
   /**
    * FNV-1a hash
@@ -32,6 +161,21 @@ uint64_t tau_hash_digest(const void* data, size_t size)
   return h;
 }
 
+uint64_t tau_hash_u64(uint64_t value)
+{
+  // The final steps of the digest, skipping the reads.
+  uint64_t a = ((value << 32) | (value >> 32)) ^ HASH_SECRET1;
+  uint64_t b = value ^ HASH_SECRET2;
+  tau_hash_mum(&a, &b);
+
+  return tau_hash_mix(a ^ HASH_SECRET0 ^ sizeof(value), b ^ HASH_SECRET1);
+}
+
+uint64_t tau_hash_ptr(const void* ptr)
+{
+  return tau_hash_u64((uint64_t)(uintptr_t)ptr);
+}
+
 uint64_t tau_hash_combine_with_data(uint64_t seed, const void* data, size_t size)
 {
   return tau_hash_combine_with_hash(seed, tau_hash_digest(data, size));
@@ -39,5 +183,9 @@ uint64_t tau_hash_combine_with_data(uint64_t seed, const void* data, size_t size
 
 uint64_t tau_hash_combine_with_hash(uint64_t seed, uint64_t hash)
 {
-  return seed ^ (hash + 0x9E3779B9ULL + (seed << 6) + (seed >> 2));
+  uint64_t a = seed ^ HASH_SECRET1;
+  uint64_t b = hash ^ HASH_SECRET2;
+  tau_hash_mum(&a, &b);
+
+  return tau_hash_mix(a ^ HASH_SECRET0, b ^ HASH_SECRET1);
 }
@@ -0,0 +1,161 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "utils/interner.h"
+
+#include "utils/hash.h"
+#include "utils/collections/hashmap.h"
+#include "utils/memory/arena.h"
+
+/// The initial number of strings the interner can hold before growing.
+#define TAU_INTERNER_INITIAL_CAPACITY ((size_t)512)
+
+/// The capacity of the arena chunks holding the interned strings.
+#define TAU_INTERNER_ARENA_CAPACITY ((size_t)64 * (1 << 10))
+
+/**
+ * \brief Represents an interned string.
+ */
+typedef struct tau_interner_entry_t
+{
+  const char* str; // Pointer to the null-terminated copy of the string.
+  size_t len; // The length of the string.
+  uint64_t hash; // The hash of the string.
+} tau_interner_entry_t;
+
+/**
+ * \brief Interned strings indexed by identifier. The first entry is reserved
+ * for `TAU_INTERNER_NULL_ID`.
+ */
+static TAU_THREAD_LOCAL tau_interner_entry_t* g_interner_entries = NULL;
+
+/// The number of entries including the reserved one.
+static TAU_THREAD_LOCAL size_t g_interner_size = 0;
+
+/// The number of entries the entry array can hold.
+static TAU_THREAD_LOCAL size_t g_interner_entries_capacity = 0;
+
+/// Hash map from strings to their identifiers, stored as pointer values.
+static TAU_THREAD_LOCAL tau_hashmap_t* g_interner_ids = NULL;
+
+/// Arena holding the copies of the interned strings.
+static TAU_THREAD_LOCAL tau_arena_t* g_interner_arena = NULL;
+
+/**
+ * \brief Checks whether the string of an identifier equals a string view.
+ */
+static bool tau_interner_match(const void* value, const void* key)
+{
+  tau_interner_entry_t* entry = &g_interner_entries[(uintptr_t)value];
+  const tau_string_view_t* view = (const tau_string_view_t*)key;
+
+  return entry->len == view->len && memcmp(entry->str, view->buf, view->len) == 0;
+}
+
+/**
+ * \brief Initializes the interner on first use.
+ */
+static void tau_interner_init(void)
+{
+  g_interner_ids = tau_hashmap_init_with_capacity(TAU_INTERNER_INITIAL_CAPACITY);
+
+  g_interner_entries_capacity = TAU_INTERNER_INITIAL_CAPACITY;
+  g_interner_entries = (tau_interner_entry_t*)malloc(sizeof(tau_interner_entry_t) * g_interner_entries_capacity);
+  TAU_ASSERT(g_interner_entries != NULL);
+
+  // The reserved entry is never matched, only its slot in the array is taken.
+  g_interner_entries[TAU_INTERNER_NULL_ID] = (tau_interner_entry_t){ .str = "", .len = 0, .hash = 0 };
+  g_interner_size = 1;
+
+  g_interner_arena = tau_arena_init_with_capacity(TAU_INTERNER_ARENA_CAPACITY);
+}
+
+uint32_t tau_interner_intern(const char* str, size_t len)
+{
+  if (g_interner_ids == NULL)
+    tau_interner_init();
+
+  uint64_t hash = tau_hash_digest(str, len);
+  tau_string_view_t view = tau_string_view_init_with_length(str, len);
+  tau_hashmap_entry_t* slot = tau_hashmap_find(g_interner_ids, hash, tau_interner_match, &view);
+
+  if (slot->value != NULL)
+    return (uint32_t)(uintptr_t)slot->value;
+
+  TAU_ASSERT(g_interner_size < UINT32_MAX);
+
+  char* copy = (char*)tau_arena_alloc_aligned(g_interner_arena, len + 1, 1);
+  TAU_ASSERT(copy != NULL);
+
+  memcpy(copy, str, len);
+  copy[len] = '\0';
+
+  if (g_interner_size == g_interner_entries_capacity)
+  {
+    g_interner_entries_capacity <<= 1;
+    g_interner_entries = (tau_interner_entry_t*)realloc(g_interner_entries, sizeof(tau_interner_entry_t) * g_interner_entries_capacity);
+    TAU_ASSERT(g_interner_entries != NULL);
+  }
+
+  uint32_t id = (uint32_t)g_interner_size++;
+
+  g_interner_entries[id] = (tau_interner_entry_t){ .str = copy, .len = len, .hash = hash };
+  tau_hashmap_insert(g_interner_ids, slot, (void*)(uintptr_t)id);
+
+  return id;
+}
+
+uint32_t tau_interner_find(const char* str, size_t len)
+{
+  if (g_interner_ids == NULL)
+    return TAU_INTERNER_NULL_ID;
+
+  tau_string_view_t view = tau_string_view_init_with_length(str, len);
+
+  return (uint32_t)(uintptr_t)tau_hashmap_get(g_interner_ids, tau_hash_digest(str, len), tau_interner_match, &view);
+}
+
+tau_string_view_t tau_interner_view(uint32_t id)
+{
+  if (id == TAU_INTERNER_NULL_ID)
+    return tau_string_view_init_with_length("", 0);
+
+  TAU_ASSERT(id < g_interner_size);
+
+  return tau_string_view_init_with_length(g_interner_entries[id].str, g_interner_entries[id].len);
+}
+
+uint64_t tau_interner_hash(uint32_t id)
+{
+  if (id == TAU_INTERNER_NULL_ID)
+    return 0;
+
+  TAU_ASSERT(id < g_interner_size);
+
+  return g_interner_entries[id].hash;
+}
+
+size_t tau_interner_size(void)
+{
+  return g_interner_size == 0 ? 0 : g_interner_size - 1;
+}
+
+void tau_interner_free(void)
+{
+  if (g_interner_ids == NULL)
+    return;
+
+  tau_hashmap_free(g_interner_ids);
+  free(g_interner_entries);
+  tau_arena_free(g_interner_arena);
+
+  g_interner_ids = NULL;
+  g_interner_entries = NULL;
+  g_interner_arena = NULL;
+  g_interner_size = 0;
+  g_interner_entries_capacity = 0;
+}
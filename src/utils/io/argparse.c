@@ -18,6 +18,8 @@ struct tau_argparse_ctx_t
   size_t argc;
 
   size_t idx;
+
+  const char* inline_arg; // Value given as `--name=value` or `NULL`.
 };
 
 tau_argparse_ctx_t* tau_argparse_ctx_init(const tau_argparse_option_t opts[], size_t opt_count, const char* argv[], int argc)
@@ -29,6 +31,7 @@ tau_argparse_ctx_t* tau_argparse_ctx_init(const tau_argparse_option_t opts[], si
   ctx->argv = argv;
   ctx->argc = (size_t)argc;
   ctx->idx = 1;
+  ctx->inline_arg = NULL;
 
   return ctx;
 }
@@ -45,12 +48,21 @@ int tau_argparse_fetch(tau_argparse_ctx_t* ctx)
 
   const char* arg = ctx->argv[ctx->idx++];
 
+  ctx->inline_arg = NULL;
+
   if (strncmp("--", arg, 2) == 0)
   {
+    const char* name = arg + 2;
+    const char* value = strchr(name, '=');
+    size_t name_len = value == NULL ? strlen(name) : (size_t)(value - name);
+
     for (size_t i = 0; i < ctx->opt_count; ++i)
       if (ctx->opts[i].long_name != NULL)
-        if (strcmp(arg + 2, ctx->opts[i].long_name) == 0)
+        if (strlen(ctx->opts[i].long_name) == name_len && strncmp(name, ctx->opts[i].long_name, name_len) == 0)
+        {
+          ctx->inline_arg = value == NULL ? NULL : value + 1;
           return ctx->opts[i].id;
+        }
 
     return TAU_ARGPARSE_UNKNOWN;
   }
@@ -134,6 +146,13 @@ const char* tau_argparse_get_arg_at(tau_argparse_ctx_t* ctx, size_t idx)
 
 const char* tau_argparse_next_arg(tau_argparse_ctx_t* ctx)
 {
+  if (ctx->inline_arg != NULL)
+  {
+    const char* arg = ctx->inline_arg;
+    ctx->inline_arg = NULL;
+    return arg;
+  }
+
   if (ctx->idx >= ctx->argc)
     return NULL;
 
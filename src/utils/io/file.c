@@ -7,8 +7,82 @@
 
 #include "utils/io/file.h"
 
+#include <string.h>
+
 #include "utils/common.h"
 
+/**
+ * \brief Initial capacity of the buffer used to read files of unknown size.
+ */
+#define TAU_FILE_VIEW_INITIAL_CAPACITY ((size_t)(16 * (1 << 10)))
+
+struct tau_file_view_t
+{
+  char* data; // Pointer to the contents followed by the padding.
+  size_t size; // Size of the contents in bytes.
+  size_t mapped; // Size of the memory mapping in bytes, or 0 if the contents are heap-allocated.
+};
+
+/**
+ * \brief Initializes a new file view.
+ *
+ * \param[in] data Pointer to the contents followed by the padding.
+ * \param[in] size Size of the contents in bytes.
+ * \param[in] mapped Size of the memory mapping in bytes, or 0 if the contents
+ * are heap-allocated.
+ * \returns Pointer to the newly initialized file view.
+ */
+static tau_file_view_t* tau_file_view_init(char* data, size_t size, size_t mapped)
+{
+  tau_file_view_t* view = (tau_file_view_t*)malloc(sizeof(tau_file_view_t));
+  TAU_ASSERT(view != NULL);
+
+  view->data = data;
+  view->size = size;
+  view->mapped = mapped;
+
+  return view;
+}
+
+/**
+ * \brief Ensures that a heap buffer can hold a number of bytes plus padding.
+ *
+ * \param[in,out] buf Pointer to the buffer.
+ * \param[in,out] cap Pointer to the capacity of the buffer.
+ * \param[in] len The number of bytes the buffer must be able to hold.
+ */
+static void tau_file_view_reserve(char** buf, size_t* cap, size_t len)
+{
+  if (len + TAU_FILE_VIEW_PADDING <= *cap)
+    return;
+
+  while (*cap < len + TAU_FILE_VIEW_PADDING)
+    *cap = *cap == 0 ? TAU_FILE_VIEW_INITIAL_CAPACITY : *cap * 2;
+
+  *buf = (char*)realloc(*buf, *cap);
+  TAU_ASSERT(*buf != NULL);
+}
+
+/**
+ * \brief Initializes a new file view from a heap buffer and zeroes its padding.
+ */
+static tau_file_view_t* tau_file_view_init_buffered(char* buf, size_t len)
+{
+  memset(buf + len, 0, TAU_FILE_VIEW_PADDING);
+
+  return tau_file_view_init(buf, len, 0);
+}
+
+const char* tau_file_view_data(tau_file_view_t* view)
+{
+  return view->data;
+}
+
+size_t tau_file_view_size(tau_file_view_t* view)
+{
+  return view->size;
+}
+
 #if TAU_OS_WINDOWS
 
 #include <windows.h>
@@ -167,6 +241,9 @@ size_t tau_file_read(tau_path_t* path, char* buf, size_t len)
   if (buf == NULL)
     return tau_file_size(path);
 
+  if (len == 0)
+    return 0;
+
   tau_string_t* tau_path_str = tau_path_to_string(path);
 
   HANDLE handle = CreateFileA(
@@ -184,20 +261,214 @@ size_t tau_file_read(tau_path_t* path, char* buf, size_t len)
   if (handle == INVALID_HANDLE_VALUE)
     return 0;
 
-  DWORD bytes_read = 0;
+  size_t total = 0;
+
+  while (total < len - 1)
+  {
+    DWORD bytes_read = 0;
+
+    if (!ReadFile(handle, buf + total, (DWORD)TAU_MIN(len - 1 - total, (size_t)MAXDWORD), &bytes_read, NULL) || bytes_read == 0)
+      break;
+
+    total += (size_t)bytes_read;
+  }
+
+  CloseHandle(handle);
+
+  buf[total] = '\0';
+
+  return total;
+}
+
+uint64_t tau_file_modification_time(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  BOOL is_ok = GetFileAttributesExA(tau_string_begin(tau_path_str), GetFileExInfoStandard, &data);
+
+  tau_string_free(tau_path_str);
 
-  if (!ReadFile(handle, buf, (DWORD)len, &bytes_read, NULL))
+  if (!is_ok)
     return 0;
 
-  buf[bytes_read] = '\0';
+  return ((uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) | (uint64_t)data.ftLastWriteTime.dwLowDateTime;
+}
+
+bool tau_file_touch(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+
+  HANDLE handle = CreateFileA(
+    tau_string_begin(tau_path_str),
+    FILE_WRITE_ATTRIBUTES,
+    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+    NULL,
+    OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL,
+    NULL
+  );
+
+  tau_string_free(tau_path_str);
+
+  if (handle == INVALID_HANDLE_VALUE)
+    return false;
+
+  FILETIME now;
+  GetSystemTimeAsFileTime(&now);
+
+  BOOL is_ok = SetFileTime(handle, NULL, NULL, &now);
+
+  CloseHandle(handle);
+
+  return is_ok != 0;
+}
+
+bool tau_file_rename(tau_path_t* from, tau_path_t* to)
+{
+  tau_string_t* from_str = tau_path_to_string(from);
+  tau_string_t* to_str = tau_path_to_string(to);
+
+  BOOL is_ok = MoveFileExA(tau_string_begin(from_str), tau_string_begin(to_str), MOVEFILE_REPLACE_EXISTING);
+
+  tau_string_free(to_str);
+  tau_string_free(from_str);
+
+  return is_ok != 0;
+}
+
+bool tau_file_remove(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+
+  BOOL is_ok = DeleteFileA(tau_string_begin(tau_path_str));
+
+  tau_string_free(tau_path_str);
+
+  return is_ok != 0;
+}
+
+bool tau_file_create_directory(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+  char* tau_path_cstr = tau_string_begin(tau_path_str);
+
+  // Parents are created first by cutting the path at each separator.
+  for (size_t i = 1; i < tau_string_length(tau_path_str); i++)
+    if (tau_path_cstr[i] == '/' || tau_path_cstr[i] == '\\')
+    {
+      char sep = tau_path_cstr[i];
+      tau_path_cstr[i] = '\0';
+      CreateDirectoryA(tau_path_cstr, NULL);
+      tau_path_cstr[i] = sep;
+    }
+
+  CreateDirectoryA(tau_path_cstr, NULL);
+
+  tau_string_free(tau_path_str);
+
+  return tau_file_is_directory(path);
+}
+
+tau_vector_t* tau_file_list_directory(tau_path_t* path)
+{
+  tau_path_t* pattern = tau_path_join_cstr(path, "*");
+  tau_string_t* pattern_str = tau_path_to_string(pattern);
+
+  WIN32_FIND_DATAA data;
+  HANDLE handle = FindFirstFileA(tau_string_begin(pattern_str), &data);
+
+  tau_string_free(pattern_str);
+  tau_path_free(pattern);
+
+  if (handle == INVALID_HANDLE_VALUE)
+    return GetLastError() == ERROR_FILE_NOT_FOUND ? tau_vector_init() : NULL;
+
+  tau_vector_t* entries = tau_vector_init();
+
+  do
+  {
+    if (strcmp(data.cFileName, ".") == 0 || strcmp(data.cFileName, "..") == 0)
+      continue;
 
-  return (size_t)bytes_read;
+    tau_vector_push(entries, tau_path_join_cstr(path, data.cFileName));
+  } while (FindNextFileA(handle, &data));
+
+  FindClose(handle);
+
+  return entries;
+}
+
+tau_file_view_t* tau_file_view_open(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+
+  HANDLE handle = CreateFileA(
+    tau_string_begin(tau_path_str),
+    GENERIC_READ,
+    FILE_SHARE_READ,
+    NULL,
+    OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+    NULL
+  );
+
+  tau_string_free(tau_path_str);
+
+  if (handle == INVALID_HANDLE_VALUE)
+    return NULL;
+
+  // Mapped views cannot be followed by guaranteed padding on Windows, so the
+  // contents are always read into a buffer.
+  LARGE_INTEGER size = { .QuadPart = 0 };
+
+  char* buf = NULL;
+  size_t cap = 0;
+  size_t len = 0;
+
+  if (GetFileType(handle) == FILE_TYPE_DISK && GetFileSizeEx(handle, &size))
+    tau_file_view_reserve(&buf, &cap, (size_t)size.QuadPart);
+
+  for (;;)
+  {
+    tau_file_view_reserve(&buf, &cap, len + 1);
+
+    DWORD bytes_read = 0;
+
+    if (!ReadFile(handle, buf + len, (DWORD)TAU_MIN(cap - TAU_FILE_VIEW_PADDING - len, (size_t)MAXDWORD), &bytes_read, NULL))
+    {
+      if (GetLastError() == ERROR_BROKEN_PIPE)
+        break;
+
+      CloseHandle(handle);
+      free(buf);
+      return NULL;
+    }
+
+    if (bytes_read == 0)
+      break;
+
+    len += (size_t)bytes_read;
+  }
+
+  CloseHandle(handle);
+
+  return tau_file_view_init_buffered(buf, len);
+}
+
+void tau_file_view_close(tau_file_view_t* view)
+{
+  free(view->data);
+  free(view);
 }
 
 #elif TAU_OS_LINUX
 
+#include <dirent.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 bool tau_file_is_directory(tau_path_t *path)
@@ -298,33 +569,247 @@ size_t tau_file_size(tau_path_t *path)
   return stat(tau_path_cstr, &st) == 0 ? st.st_size : 0;
 }
 
+/**
+ * \brief Reads from a file descriptor until a buffer is full or the end of the
+ * file is reached, retrying on short reads and interrupts.
+ *
+ * \param[in] fd The file descriptor to read from.
+ * \param[out] buf Pointer to the buffer.
+ * \param[in] len The number of bytes to be read.
+ * \returns The number of bytes read, or -1 if an error occurred.
+ */
+static ssize_t tau_file_read_fd(int fd, char* buf, size_t len)
+{
+  size_t total = 0;
+
+  while (total < len)
+  {
+    ssize_t bytes_read = read(fd, buf + total, len - total);
+
+    if (bytes_read == 0)
+      break;
+
+    if (bytes_read == -1)
+    {
+      if (errno == EINTR)
+        continue;
+
+      return -1;
+    }
+
+    total += (size_t)bytes_read;
+  }
+
+  return (ssize_t)total;
+}
+
 size_t tau_file_read(tau_path_t *path, char *buf, size_t len)
 {
   tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
   const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
 
+  if (buf == NULL)
+    return tau_file_size(path);
+
+  if (len == 0)
+    return 0;
+
   int fd = open(tau_path_cstr, O_RDONLY);
 
   if (fd == -1)
     return 0;
 
-  size_t bytes_read = 0;
+  ssize_t bytes_read = tau_file_read_fd(fd, buf, len - 1);
+
+  close(fd);
+
+  size_t total = bytes_read == -1 ? 0 : (size_t)bytes_read;
+
+  buf[total] = '\0';
+
+  return total;
+}
+
+uint64_t tau_file_modification_time(tau_path_t* path)
+{
+  tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
+  const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
+
+  struct stat st;
+
+  if (stat(tau_path_cstr, &st) != 0)
+    return 0;
+
+  return (uint64_t)st.st_mtim.tv_sec * 1000000000ULL + (uint64_t)st.st_mtim.tv_nsec;
+}
+
+bool tau_file_touch(tau_path_t* path)
+{
+  tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
+  const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
+
+  return utimensat(AT_FDCWD, tau_path_cstr, NULL, 0) == 0;
+}
+
+bool tau_file_rename(tau_path_t* from, tau_path_t* to)
+{
+  const char* from_cstr = tau_string_view_begin(tau_path_to_string_view(from));
+  const char* to_cstr = tau_string_view_begin(tau_path_to_string_view(to));
+
+  return rename(from_cstr, to_cstr) == 0;
+}
 
-  if (buf)
+bool tau_file_remove(tau_path_t* path)
+{
+  tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
+  const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
+
+  return unlink(tau_path_cstr) == 0;
+}
+
+bool tau_file_create_directory(tau_path_t* path)
+{
+  tau_string_t* tau_path_str = tau_path_to_string(path);
+  char* tau_path_cstr = tau_string_begin(tau_path_str);
+
+  // Parents are created first by cutting the path at each separator.
+  for (size_t i = 1; i < tau_string_length(tau_path_str); i++)
+    if (tau_path_cstr[i] == '/')
+    {
+      tau_path_cstr[i] = '\0';
+      mkdir(tau_path_cstr, 0777);
+      tau_path_cstr[i] = '/';
+    }
+
+  mkdir(tau_path_cstr, 0777);
+
+  tau_string_free(tau_path_str);
+
+  return tau_file_is_directory(path);
+}
+
+tau_vector_t* tau_file_list_directory(tau_path_t* path)
+{
+  tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
+  const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
+
+  DIR* dir = opendir(tau_path_cstr);
+
+  if (dir == NULL)
+    return NULL;
+
+  tau_vector_t* entries = tau_vector_init();
+
+  for (struct dirent* entry = readdir(dir); entry != NULL; entry = readdir(dir))
   {
-    bytes_read = read(fd, buf, len);
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+      continue;
+
+    tau_vector_push(entries, tau_path_join_cstr(path, entry->d_name));
   }
-  else
+
+  closedir(dir);
+
+  return entries;
+}
+
+/**
+ * \brief Memory-maps a regular file followed by zeroed padding.
+ *
+ * \param[in] fd The file descriptor of the file.
+ * \param[in] size The size of the file in bytes, must not be zero.
+ * \returns Pointer to the newly initialized file view, or `NULL` if the file
+ * could not be mapped.
+ */
+static tau_file_view_t* tau_file_view_map(int fd, size_t size)
+{
+  size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  size_t mapped = (size + TAU_FILE_VIEW_PADDING + page_size - 1) / page_size * page_size;
+
+  // Reserve zero-filled anonymous pages for both the contents and the padding,
+  // then map the file over the beginning of the reservation. The kernel fills
+  // the remainder of the last page of the file with zeros.
+  char* base = (char*)mmap(NULL, mapped, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (base == MAP_FAILED)
+    return NULL;
+
+  if (mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
   {
-    struct stat st;
+    munmap(base, mapped);
+    return NULL;
+  }
+
+  madvise(base, size, MADV_SEQUENTIAL);
+
+  return tau_file_view_init(base, size, mapped);
+}
+
+tau_file_view_t* tau_file_view_open(tau_path_t* path)
+{
+  tau_string_view_t tau_path_str_view = tau_path_to_string_view(path);
+  const char* tau_path_cstr = tau_string_view_begin(tau_path_str_view);
+
+  int fd = open(tau_path_cstr, O_RDONLY | O_CLOEXEC);
+
+  if (fd == -1)
+    return NULL;
 
-    if (fstat(fd, &st) == 0)
-      bytes_read = st.st_size;
+  struct stat st;
+
+  bool is_regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+
+  if (is_regular && st.st_size > 0)
+  {
+    tau_file_view_t* view = tau_file_view_map(fd, (size_t)st.st_size);
+
+    if (view != NULL)
+    {
+      close(fd);
+      return view;
+    }
+  }
+
+  // Pipes, character devices and files which cannot be mapped are read until
+  // the end of the file, since their size is not known in advance.
+  char* buf = NULL;
+  size_t cap = 0;
+  size_t len = 0;
+
+  tau_file_view_reserve(&buf, &cap, is_regular ? (size_t)st.st_size : 0);
+
+  for (;;)
+  {
+    tau_file_view_reserve(&buf, &cap, len + 1);
+
+    ssize_t bytes_read = tau_file_read_fd(fd, buf + len, cap - TAU_FILE_VIEW_PADDING - len);
+
+    if (bytes_read == -1)
+    {
+      close(fd);
+      free(buf);
+      return NULL;
+    }
+
+    len += (size_t)bytes_read;
+
+    if (len < cap - TAU_FILE_VIEW_PADDING)
+      break;
   }
 
   close(fd);
 
-  return bytes_read;
+  return tau_file_view_init_buffered(buf, len);
+}
+
+void tau_file_view_close(tau_file_view_t* view)
+{
+  if (view->mapped > 0)
+    munmap(view->data, view->mapped);
+  else
+    free(view->data);
+
+  free(view);
 }
 
 #else
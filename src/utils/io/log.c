@@ -11,7 +11,7 @@
 #include "utils/esc_seq.h"
 
 static tau_log_level_t g_log_level = TAU_LOG_LEVEL_TRACE;
-static FILE* g_log_stream = NULL;
+static TAU_THREAD_LOCAL FILE* g_log_stream = NULL;
 static bool g_log_verbose = false;
 
 void tau_log_log(tau_log_level_t lvl, const char* file, int line, const char* TAU_UNUSED(func), const char* name, const char* fmt, ...)
@@ -408,17 +408,7 @@ tau_path_t* tau_path_replace_extension(tau_path_t* path, const char* extension)
   while (last_dot_or_sep > 0 && str_ptr[last_dot_or_sep - 1] != '.' && !tau_path_is_directory_separator(str_ptr[last_dot_or_sep - 1]))
     --last_dot_or_sep;
 
-  if (last_dot_or_sep == 0)
-  {
-    tau_path_t* result = tau_path_copy(path);
-
-    tau_path_append_cstr(result, ".");
-    tau_path_append_cstr(result, extension);
-
-    return result;
-  }
-
-  if (str_ptr[last_dot_or_sep - 1] == '.')
+  if (last_dot_or_sep > 0 && str_ptr[last_dot_or_sep - 1] == '.')
   {
     tau_path_t* result = tau_path_init_with_cstr_and_length(str_ptr, last_dot_or_sep);
 
@@ -427,7 +417,8 @@ tau_path_t* tau_path_replace_extension(tau_path_t* path, const char* extension)
     return result;
   }
 
-  tau_path_t* result = tau_path_init_with_cstr_and_length(str_ptr, last_dot_or_sep);
+  // The filename has no extension, so the new one is appended to it.
+  tau_path_t* result = tau_path_copy(path);
 
   tau_path_append_cstr(result, ".");
   tau_path_append_cstr(result, extension);
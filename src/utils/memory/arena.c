@@ -1,6 +1,6 @@
 /**
  * \file
- * 
+ *
  * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
  */
@@ -14,6 +14,17 @@
  */
 #define ARENA_DEFAULT_CAPACITY (8 * (1 << 10))
 
+/**
+ * \brief Maximum capacity of a regular chunk, geometric growth stops here.
+ */
+#define ARENA_MAX_CHUNK_CAPACITY ((size_t)64 << 20)
+
+/**
+ * \brief Allocations larger than the chunk capacity divided by this value get
+ * a dedicated chunk.
+ */
+#define ARENA_LARGE_ALLOCATION_DIVISOR 4
+
 /**
  * \brief Represents a memory chunk in an arena allocator.
  *
@@ -25,46 +36,84 @@ typedef struct tau_arena_chunk_t tau_arena_chunk_t;
 struct tau_arena_chunk_t
 {
   size_t size; // Number of allocated bytes in the chunk.
-  tau_arena_chunk_t* next; // Pointer to the next chunk or `NULL`.
+  size_t capacity; // Number of bytes the chunk can hold.
+  bool is_large; // Whether the chunk is dedicated to a single allocation.
+  tau_arena_chunk_t* next; // Pointer to the previously added chunk or `NULL`.
 };
 
 struct tau_arena_t
 {
-  size_t capacity; // Capacity of a chunk.
-  tau_arena_chunk_t* head; // Pointer to the first chunk.
+  size_t capacity; // Capacity of the first chunk.
+  size_t chunk_capacity; // Capacity of the next regular chunk.
+  tau_arena_chunk_t* head; // Pointer to the most recently added chunk.
+  tau_arena_chunk_t* current; // Pointer to the chunk allocations are served from.
 };
 
 /**
- * \brief Rounds a size up to the nearest multiple of a specified alignment.
- * 
- * \param[in] size Size to be round up.
- * \param[in] alignment The alignment requirement.
- * \returns Rounded up size.
-*/
-static size_t tau_arena_round(size_t size, size_t alignment)
+ * \brief Size of a chunk header, rounded up so that the memory following it is
+ * suitably aligned for any type.
+ */
+#define ARENA_CHUNK_HEADER_SIZE ((sizeof(tau_arena_chunk_t) + TAU_ALIGNOF(max_align_t) - 1) / TAU_ALIGNOF(max_align_t) * TAU_ALIGNOF(max_align_t))
+
+/**
+ * \brief Returns a pointer to the memory of a chunk.
+ *
+ * \param[in] chunk Pointer to the chunk.
+ * \returns Pointer to the first byte of the chunk's memory.
+ */
+static inline uint8_t* tau_arena_chunk_data(tau_arena_chunk_t* chunk)
 {
-  return (size + alignment - 1) / alignment * alignment;
+  return (uint8_t*)chunk + ARENA_CHUNK_HEADER_SIZE;
 }
 
 /**
- * \brief Initializes a new chunk with a specified capacity.
- * 
+ * \brief Initializes a new chunk with a specified capacity and makes it the
+ * most recently added chunk of an arena.
+ *
+ * \param[in,out] arena Pointer to the arena allocator.
  * \param[in] cap The capacity of the chunk.
+ * \param[in] is_large Whether the chunk is dedicated to a single allocation.
  * \returns Pointer to the newly initialized chunk.
  */
-static tau_arena_chunk_t* tau_arena_chunk_init_with_capacity(size_t cap)
+static tau_arena_chunk_t* tau_arena_chunk_init(tau_arena_t* arena, size_t cap, bool is_large)
 {
-  size_t chunk_size = tau_arena_round(sizeof(tau_arena_chunk_t), TAU_ALIGNOF(max_align_t)) + cap;
+  TAU_ASSERT(cap <= SIZE_MAX - ARENA_CHUNK_HEADER_SIZE);
 
-  tau_arena_chunk_t* chunk = (tau_arena_chunk_t*)malloc(chunk_size);
+  tau_arena_chunk_t* chunk = (tau_arena_chunk_t*)malloc(ARENA_CHUNK_HEADER_SIZE + cap);
   TAU_ASSERT(chunk != NULL);
 
   chunk->size = 0;
-  chunk->next = NULL;
+  chunk->capacity = cap;
+  chunk->is_large = is_large;
+  chunk->next = arena->head;
+
+  arena->head = chunk;
 
   return chunk;
 }
 
+/**
+ * \brief Bumps the allocation pointer of a chunk.
+ *
+ * \param[in,out] chunk Pointer to the chunk.
+ * \param[in] size The number of bytes to be allocated.
+ * \param[in] alignment The alignment requirement.
+ * \returns Pointer to the allocated memory or `NULL` if the chunk is full.
+ */
+static inline void* tau_arena_chunk_bump(tau_arena_chunk_t* chunk, size_t size, size_t alignment)
+{
+  uintptr_t begin = (uintptr_t)tau_arena_chunk_data(chunk);
+  uintptr_t ptr = (begin + chunk->size + alignment - 1) & ~(uintptr_t)(alignment - 1);
+  size_t offset = (size_t)(ptr - begin);
+
+  if (offset > chunk->capacity || size > chunk->capacity - offset)
+    return NULL;
+
+  chunk->size = offset + size;
+
+  return (void*)ptr;
+}
+
 tau_arena_t* tau_arena_init(void)
 {
   return tau_arena_init_with_capacity(ARENA_DEFAULT_CAPACITY);
@@ -72,11 +121,15 @@ tau_arena_t* tau_arena_init(void)
 
 tau_arena_t* tau_arena_init_with_capacity(size_t cap)
 {
+  TAU_ASSERT(cap > 0);
+
   tau_arena_t* arena = (tau_arena_t*)malloc(sizeof(tau_arena_t));
   TAU_ASSERT(arena != NULL);
 
   arena->capacity = cap;
+  arena->chunk_capacity = cap;
   arena->head = NULL;
+  arena->current = NULL;
 
   return arena;
 }
@@ -92,6 +145,28 @@ void tau_arena_free(tau_arena_t* arena)
   free(arena);
 }
 
+void tau_arena_merge(tau_arena_t* dest, tau_arena_t* src)
+{
+  if (dest->head == NULL)
+    dest->head = src->head;
+  else
+  {
+    tau_arena_chunk_t* last_chunk = dest->head;
+
+    while (last_chunk->next != NULL)
+      last_chunk = last_chunk->next;
+
+    last_chunk->next = src->head;
+  }
+
+  if (dest->current == NULL)
+    dest->current = src->current;
+
+  dest->chunk_capacity = TAU_MAX(dest->chunk_capacity, src->chunk_capacity);
+
+  free(src);
+}
+
 size_t tau_arena_capacity(tau_arena_t* arena)
 {
   return arena->capacity;
@@ -99,12 +174,14 @@ size_t tau_arena_capacity(tau_arena_t* arena)
 
 bool tau_arena_owns(tau_arena_t* arena, void* ptr)
 {
+  // Chunks grow geometrically, so there are only logarithmically many of them
+  // besides the ones dedicated to large allocations.
   for (tau_arena_chunk_t* chunk = arena->head; chunk != NULL; chunk = chunk->next)
   {
-    void* begin = (uint8_t*)chunk + tau_arena_round(sizeof(tau_arena_chunk_t), TAU_ALIGNOF(max_align_t));
-    void* end = (uint8_t*)begin + chunk->size;
+    uint8_t* begin = tau_arena_chunk_data(chunk);
+    uint8_t* end = begin + chunk->size;
 
-    if (begin <= ptr && ptr < end)
+    if (begin <= (uint8_t*)ptr && (uint8_t*)ptr < end)
       return true;
   }
 
@@ -118,38 +195,93 @@ void* tau_arena_alloc(tau_arena_t* arena, size_t size)
 
 void* tau_arena_alloc_aligned(tau_arena_t* arena, size_t size, size_t alignment)
 {
-  if (size > arena->capacity)
+  TAU_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+  if (arena->current != NULL)
   {
-    tau_log_warn("arena", "Allocation size larger than capacity.");
+    void* ptr = tau_arena_chunk_bump(arena->current, size, alignment);
 
-    return NULL;
+    if (ptr != NULL)
+      return ptr;
   }
 
-  if (arena->head == NULL)
-    arena->head = tau_arena_chunk_init_with_capacity(arena->capacity);
+  // Chunk memory is only aligned to `max_align_t`, stricter alignments may
+  // need padding in front of the allocation.
+  size_t padded_size = size + (alignment > TAU_ALIGNOF(max_align_t) ? alignment - 1 : 0);
+
+  if (padded_size > arena->chunk_capacity / ARENA_LARGE_ALLOCATION_DIVISOR)
+    return tau_arena_chunk_bump(tau_arena_chunk_init(arena, padded_size, true), size, alignment);
+
+  arena->current = tau_arena_chunk_init(arena, arena->chunk_capacity, false);
+
+  if (arena->chunk_capacity < ARENA_MAX_CHUNK_CAPACITY)
+    arena->chunk_capacity = TAU_MIN(arena->chunk_capacity << 1, ARENA_MAX_CHUNK_CAPACITY);
+
+  return tau_arena_chunk_bump(arena->current, size, alignment);
+}
+
+tau_arena_mark_t tau_arena_mark(tau_arena_t* arena)
+{
+  return (tau_arena_mark_t){
+    .top = arena->head,
+    .current = arena->current,
+    .size = arena->current == NULL ? 0 : arena->current->size
+  };
+}
+
+void tau_arena_rollback(tau_arena_t* arena, tau_arena_mark_t mark)
+{
+  while (arena->head != (tau_arena_chunk_t*)mark.top)
+  {
+    TAU_ASSERT(arena->head != NULL);
+
+    tau_arena_chunk_t* next = arena->head->next;
+    free(arena->head);
+    arena->head = next;
+  }
 
-  tau_arena_chunk_t* last_chunk = NULL;
+  arena->current = (tau_arena_chunk_t*)mark.current;
 
-  for (tau_arena_chunk_t* chunk = arena->head; chunk != NULL; last_chunk = chunk, chunk = chunk->next)
+  if (arena->current != NULL)
   {
-    size_t new_size = tau_arena_round(chunk->size, TAU_MIN(TAU_ALIGNOF(max_align_t), alignment)) + size;
+    TAU_ASSERT(mark.size <= arena->current->size);
+    arena->current->size = mark.size;
+  }
+}
 
-    if (new_size > arena->capacity)
-      continue;
+void tau_arena_reset(tau_arena_t* arena)
+{
+  for (tau_arena_chunk_t *chunk = arena->head, *next = NULL; chunk != NULL; chunk = next)
+  {
+    next = chunk->next;
 
-    void* ptr = (uint8_t*)chunk + tau_arena_round(sizeof(tau_arena_chunk_t), TAU_ALIGNOF(max_align_t)) + new_size - size;
+    if (chunk != arena->current)
+      free(chunk);
+  }
 
-    chunk->size = new_size;
+  arena->head = arena->current;
 
-    return ptr;
+  if (arena->current != NULL)
+  {
+    arena->current->size = 0;
+    arena->current->next = NULL;
   }
+}
 
-  tau_arena_chunk_t* chunk = tau_arena_chunk_init_with_capacity(arena->capacity);
-  last_chunk->next = chunk;
+tau_arena_stats_t tau_arena_stats(tau_arena_t* arena)
+{
+  tau_arena_stats_t stats;
+  TAU_CLEAROBJ(&stats);
 
-  void* ptr = (uint8_t*)chunk + tau_arena_round(sizeof(tau_arena_chunk_t), TAU_ALIGNOF(max_align_t));
+  for (tau_arena_chunk_t* chunk = arena->head; chunk != NULL; chunk = chunk->next)
+  {
+    stats.used += chunk->size;
+    stats.reserved += chunk->capacity;
+    stats.chunk_count++;
 
-  chunk->size = size;
+    if (chunk->is_large)
+      stats.large_chunk_count++;
+  }
 
-  return ptr;
+  return stats;
 }
@@ -0,0 +1,327 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#define TAU_MEMSTAT_IMPL
+#include "utils/memory/memstat.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/max_align.h"
+#include "utils/thread_local.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+# include <malloc.h>
+# define MEMSTAT_HAS_HEAP_SIZE 1
+#else
+# define MEMSTAT_HAS_HEAP_SIZE 0
+#endif
+
+/// Maximum number of stages recorded by a memory report.
+#define MEMSTAT_REPORT_MAX_STAGES 16
+
+/// Owner stored in the header of allocations made while counting is disabled.
+#define MEMSTAT_UNCOUNTED TAU_MEMSTAT_OWNER_COUNT
+
+/**
+ * \brief Header preceding every allocation.
+ *
+ */
+typedef union tau_memstat_header_t
+{
+  struct
+  {
+    size_t size; // Size of the allocation in bytes.
+    size_t owner; // Owner of the allocation or `MEMSTAT_UNCOUNTED`.
+  } info;
+
+  max_align_t align; // Aligns the memory following the header.
+} tau_memstat_header_t;
+
+/**
+ * \brief Represents the counters of a thread.
+ */
+typedef struct tau_memstat_counters_t
+{
+  int64_t cur[TAU_MEMSTAT_OWNER_COUNT]; // Current bytes per owner.
+  int64_t peak[TAU_MEMSTAT_OWNER_COUNT]; // Peak bytes per owner since the last stage.
+  int64_t total_cur; // Current bytes of every owner.
+} tau_memstat_counters_t;
+
+/**
+ * \brief Represents a memory report.
+ */
+typedef struct tau_memstat_report_t
+{
+  tau_memstat_counters_t base; // Counters when the report began.
+  size_t heap_base; // Size of the heap when the report began.
+  const char* stages[MEMSTAT_REPORT_MAX_STAGES]; // Names of the recorded stages.
+  tau_memstat_counters_t counters[MEMSTAT_REPORT_MAX_STAGES]; // Counters after each stage.
+  size_t stage_count; // Number of recorded stages.
+} tau_memstat_report_t;
+
+static bool g_memstat_enabled = false;
+static TAU_THREAD_LOCAL tau_memstat_owner_t g_memstat_owner = TAU_MEMSTAT_OWNER_OTHER;
+static TAU_THREAD_LOCAL tau_memstat_counters_t g_memstat_counters;
+static TAU_THREAD_LOCAL tau_memstat_report_t* g_memstat_report = NULL;
+
+static void tau_memstat_count(size_t owner, int64_t delta)
+{
+  tau_memstat_counters_t* counters = &g_memstat_counters;
+
+  counters->cur[owner] += delta;
+  counters->total_cur += delta;
+
+  if (counters->peak[owner] < counters->cur[owner])
+    counters->peak[owner] = counters->cur[owner];
+}
+
+static void* tau_memstat_init_header(tau_memstat_header_t* header, size_t size)
+{
+  header->info.size = size;
+  header->info.owner = g_memstat_enabled ? (size_t)g_memstat_owner : MEMSTAT_UNCOUNTED;
+
+  if (header->info.owner != MEMSTAT_UNCOUNTED)
+    tau_memstat_count(header->info.owner, (int64_t)size);
+
+  return header + 1;
+}
+
+/**
+ * \brief Retrieves the number of bytes in use on the heap of the C library.
+ */
+static size_t tau_memstat_heap_size(void)
+{
+#if MEMSTAT_HAS_HEAP_SIZE
+  struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return 0;
+#endif
+}
+
+void* tau_memstat_malloc(size_t size)
+{
+  if (size > SIZE_MAX - sizeof(tau_memstat_header_t))
+    return NULL;
+
+  tau_memstat_header_t* header = (tau_memstat_header_t*)malloc(sizeof(tau_memstat_header_t) + size);
+
+  if (header == NULL)
+    return NULL;
+
+  return tau_memstat_init_header(header, size);
+}
+
+void* tau_memstat_calloc(size_t count, size_t size)
+{
+  if (size != 0 && count > (SIZE_MAX - sizeof(tau_memstat_header_t)) / size)
+    return NULL;
+
+  tau_memstat_header_t* header = (tau_memstat_header_t*)calloc(1, sizeof(tau_memstat_header_t) + count * size);
+
+  if (header == NULL)
+    return NULL;
+
+  return tau_memstat_init_header(header, count * size);
+}
+
+void* tau_memstat_realloc(void* ptr, size_t size)
+{
+  if (ptr == NULL)
+    return tau_memstat_malloc(size);
+
+  if (size > SIZE_MAX - sizeof(tau_memstat_header_t))
+    return NULL;
+
+  tau_memstat_header_t* header = (tau_memstat_header_t*)ptr - 1;
+
+  size_t old_size = header->info.size;
+  size_t owner = header->info.owner;
+
+  header = (tau_memstat_header_t*)realloc(header, sizeof(tau_memstat_header_t) + size);
+
+  if (header == NULL)
+    return NULL;
+
+  header->info.size = size;
+
+  if (owner != MEMSTAT_UNCOUNTED)
+    tau_memstat_count(owner, (int64_t)size - (int64_t)old_size);
+  else if (g_memstat_enabled)
+  {
+    header->info.owner = (size_t)g_memstat_owner;
+    tau_memstat_count(header->info.owner, (int64_t)size);
+  }
+
+  return header + 1;
+}
+
+void tau_memstat_free(void* ptr)
+{
+  if (ptr == NULL)
+    return;
+
+  tau_memstat_header_t* header = (tau_memstat_header_t*)ptr - 1;
+
+  if (header->info.owner != MEMSTAT_UNCOUNTED)
+    tau_memstat_count(header->info.owner, -(int64_t)header->info.size);
+
+  free(header);
+}
+
+size_t tau_memstat_size(const void* ptr)
+{
+  return ((const tau_memstat_header_t*)ptr - 1)->info.size;
+}
+
+void tau_memstat_enable(void)
+{
+  g_memstat_enabled = true;
+}
+
+bool tau_memstat_is_enabled(void)
+{
+  return g_memstat_enabled;
+}
+
+tau_memstat_owner_t tau_memstat_set_owner(tau_memstat_owner_t owner)
+{
+  tau_memstat_owner_t prev_owner = g_memstat_owner;
+  g_memstat_owner = owner;
+  return prev_owner;
+}
+
+const char* tau_memstat_owner_to_cstr(tau_memstat_owner_t owner)
+{
+  switch (owner)
+  {
+  case TAU_MEMSTAT_OWNER_TOKENS:    return "tokens";
+  case TAU_MEMSTAT_OWNER_AST:       return "ast";
+  case TAU_MEMSTAT_OWNER_SYMTABLE:  return "symtable";
+  case TAU_MEMSTAT_OWNER_TYPETABLE: return "typetable";
+  case TAU_MEMSTAT_OWNER_TYPEDESC:  return "typedesc";
+  case TAU_MEMSTAT_OWNER_LLVM:      return "llvm";
+  case TAU_MEMSTAT_OWNER_OTHER:     return "other";
+  default:                          return "unknown";
+  }
+}
+
+/**
+ * \brief Starts measuring the peaks of the next stage from the current usage.
+ */
+static void tau_memstat_reset_peaks(void)
+{
+  tau_memstat_counters_t* counters = &g_memstat_counters;
+
+  memcpy(counters->peak, counters->cur, sizeof(counters->peak));
+}
+
+void tau_memstat_report_begin(void)
+{
+  if (!g_memstat_enabled || g_memstat_report != NULL)
+    return;
+
+  // The report itself is not part of what it measures.
+  tau_memstat_report_t* report = (tau_memstat_report_t*)calloc(1, sizeof(tau_memstat_report_t));
+
+  if (report == NULL)
+    return;
+
+  tau_memstat_reset_peaks();
+
+  report->base = g_memstat_counters;
+  report->heap_base = tau_memstat_heap_size();
+
+  g_memstat_report = report;
+}
+
+void tau_memstat_report_stage(const char* stage)
+{
+  tau_memstat_report_t* report = g_memstat_report;
+
+  if (report == NULL || report->stage_count == MEMSTAT_REPORT_MAX_STAGES)
+    return;
+
+  tau_memstat_counters_t counters = g_memstat_counters;
+
+  // Bytes on the heap not allocated through the counting allocator belong to
+  // LLVM, which does not allocate through it.
+  int64_t heap_delta = (int64_t)tau_memstat_heap_size() - (int64_t)report->heap_base;
+  int64_t llvm = MEMSTAT_HAS_HEAP_SIZE ? heap_delta - (counters.total_cur - report->base.total_cur) : 0;
+
+  counters.cur[TAU_MEMSTAT_OWNER_LLVM] = report->base.cur[TAU_MEMSTAT_OWNER_LLVM] + llvm;
+
+  report->stages[report->stage_count] = stage;
+  report->counters[report->stage_count] = counters;
+  report->stage_count++;
+
+  tau_memstat_reset_peaks();
+}
+
+/**
+ * \brief Prints a row of kibibytes.
+ *
+ * \details Without the LLVM value the total would only cover part of the
+ * owners, so both are left blank.
+ */
+static void tau_memstat_print_row(FILE* stream, const char* stage, const char* kind, const int64_t* values, int64_t total, bool has_llvm)
+{
+  fprintf(stream, "%-12s %-9s", stage, kind);
+
+  for (size_t i = 0; i < TAU_MEMSTAT_OWNER_COUNT; i++)
+    if (i == TAU_MEMSTAT_OWNER_LLVM && !has_llvm)
+      fprintf(stream, " %10s", "-");
+    else
+      fprintf(stream, " %10.1f", (double)values[i] / 1024.0);
+
+  if (has_llvm)
+    fprintf(stream, " %10.1f\n", (double)total / 1024.0);
+  else
+    fprintf(stream, " %10s\n", "-");
+}
+
+void tau_memstat_report_end(FILE* stream, const char* title)
+{
+  tau_memstat_report_t* report = g_memstat_report;
+
+  if (report == NULL)
+    return;
+
+  g_memstat_report = NULL;
+
+  fprintf(stream, "Memory report for %s (KiB):\n", title);
+  fprintf(stream, "%-12s %-9s", "stage", "");
+
+  for (size_t i = 0; i < TAU_MEMSTAT_OWNER_COUNT; i++)
+    fprintf(stream, " %10s", tau_memstat_owner_to_cstr((tau_memstat_owner_t)i));
+
+  fprintf(stream, " %10s\n", "total");
+
+  for (size_t i = 0; i < report->stage_count; i++)
+  {
+    tau_memstat_counters_t* counters = &report->counters[i];
+
+    int64_t retained[TAU_MEMSTAT_OWNER_COUNT];
+    int64_t peak[TAU_MEMSTAT_OWNER_COUNT];
+
+    for (size_t j = 0; j < TAU_MEMSTAT_OWNER_COUNT; j++)
+    {
+      retained[j] = counters->cur[j] - report->base.cur[j];
+      peak[j] = counters->peak[j] - report->base.cur[j];
+    }
+
+    int64_t total_retained = counters->total_cur - report->base.total_cur + retained[TAU_MEMSTAT_OWNER_LLVM];
+
+    tau_memstat_print_row(stream, report->stages[i], "retained", retained, total_retained, MEMSTAT_HAS_HEAP_SIZE);
+
+    // LLVM is only sampled at the end of each stage, so its peak is unknown.
+    tau_memstat_print_row(stream, "", "peak", peak, 0, false);
+  }
+
+  free(report);
+}
@@ -1,6 +1,6 @@
 /**
  * \file
- * 
+ *
  * \copyright Copyright (c) Róna Balázs. All rights reserved.
  * \license This project is released under the Apache 2.0 license.
 */
@@ -9,7 +9,16 @@
 #include "utils/memory/memtrace.h"
 
 #include "utils/common.h"
+#include "utils/hash.h"
 #include "utils/timer.h"
+#include "utils/concurrency/mutex.h"
+#include "utils/memory/memstat.h"
+
+/// The initial number of slots in the allocation and site tables.
+#define MEMTRACE_MIN_CAPACITY ((size_t)1024)
+
+/// The default number of allocation sites in the report at program exit.
+#define MEMTRACE_DEFAULT_TOP_COUNT ((size_t)10)
 
 /**
  * \brief Enumeration of memory allocation kinds.
@@ -22,36 +31,63 @@ typedef enum tau_memtrace_alloc_kind_t
 } tau_memtrace_alloc_kind_t;
 
 /**
- * \brief Allocation metadata.
+ * \brief Allocation site.
  */
-typedef struct tau_memtrace_meta_t
+typedef struct tau_memtrace_site_t
 {
-  tau_memtrace_alloc_kind_t alloc_kind; // Allcation kind.
   const char* file; // Path to source file.
   const char* func; // Name of containing function.
   int line; // Line number in source file.
-  uint64_t time; // Time of allocation in ticks.
-} tau_memtrace_meta_t;
+  uint64_t hash; // Hash of the location.
+  size_t alloc_count; // Number of recorded allocations.
+  size_t alloc_bytes; // Bytes of recorded allocations.
+  size_t live_count; // Number of recorded allocations not yet deallocated.
+  size_t live_bytes; // Bytes of recorded allocations not yet deallocated.
+} tau_memtrace_site_t;
 
 /**
- * \brief Allocation data.
+ * \brief Allocation object.
  */
-typedef struct tau_memtrace_data_t
+typedef struct tau_memtrace_alloc_t
 {
-  void* ptr; // Pointer to memory.
+  void* ptr; // Pointer to memory or `NULL` if the slot is empty.
   size_t size; // Size of allocation in bytes.
-} tau_memtrace_data_t;
+  tau_memtrace_site_t* site; // Site of the last (re)allocation.
+  tau_memtrace_alloc_kind_t alloc_kind; // Allocation kind.
+  uint64_t time; // Time of allocation in ticks.
+} tau_memtrace_alloc_t;
 
 /**
- * \brief Allocation object.
+ * \brief Open addressing table of recorded allocations keyed by their pointers.
+ *
+ * \details This table and the site table are not `tau_hashmap_t` instances,
+ * since the allocations of those are traced themselves.
  */
-typedef struct tau_memtrace_alloc_t
-{
-  tau_memtrace_data_t data;
-  tau_memtrace_meta_t meta;
+static tau_memtrace_alloc_t* g_memtrace_allocs = NULL;
+static size_t g_memtrace_alloc_capacity = 0;
+static size_t g_memtrace_alloc_size = 0;
 
-  struct tau_memtrace_alloc_t *next; // Pointer to next allocation.
-} tau_memtrace_alloc_t;
+/**
+ * \brief Open addressing table of allocation sites keyed by their locations.
+ */
+static tau_memtrace_site_t** g_memtrace_sites = NULL;
+static size_t g_memtrace_site_capacity = 0;
+static size_t g_memtrace_site_size = 0;
+
+/**
+ * \brief Every how many allocations one is recorded.
+ */
+static size_t g_memtrace_sample_period = 1;
+
+/**
+ * \brief The number of allocation sites in the report at program exit.
+ */
+static size_t g_memtrace_top_count = MEMTRACE_DEFAULT_TOP_COUNT;
+
+/**
+ * \brief The number of allocations left until the next one is recorded.
+ */
+static TAU_THREAD_LOCAL size_t g_memtrace_sample_countdown = 0;
 
 /**
  * \brief The total amount of memory allocated by the program.
@@ -74,48 +110,320 @@ static size_t g_memtrace_stat_peak_alloc = 0;
 static size_t g_memtrace_stat_alloc_count = 0;
 
 /**
- * \brief The total number of memory deallocation requests.
+ * \brief The sum of the lifetimes of all deallocated recorded memory in ticks.
  */
-static size_t g_memtrace_stat_dealloc_count = 0;
+static uint64_t g_memtrace_stat_total_lifetime = 0;
 
 /**
- * \brief The sum of the lifetimes of all deallocated memory in ticks.
+ * \brief The number of deallocations of recorded memory.
  */
-static uint64_t g_memtrace_stat_total_lifetime = 0;
+static size_t g_memtrace_stat_lifetime_count = 0;
+
+/**
+ * \brief Mutex guarding the tables and the statistics.
+ */
+static tau_mutex_t g_memtrace_mutex;
 
 /**
  * \brief Function to be called at program exit.
  */
-void tau_memtrace_atexit(void);
+static void tau_memtrace_atexit(void);
+
+/**
+ * \brief Parses a positive number from an environment variable.
+ */
+static size_t tau_memtrace_getenv(const char* name, size_t default_value)
+{
+  const char* value = getenv(name);
+
+  if (value == NULL)
+    return default_value;
+
+  char* end = NULL;
+  unsigned long result = strtoul(value, &end, 10);
+
+  return end == value || *end != '\0' || result == 0 ? default_value : (size_t)result;
+}
+
+/**
+ * \brief Initializes the library on the first allocation.
+ */
+static void tau_memtrace_init(void)
+{
+  // The first allocation happens before any other thread is started, so
+  // initialization itself needs no synchronization.
+  if (g_memtrace_allocs != NULL)
+    return;
+
+  g_memtrace_allocs = (tau_memtrace_alloc_t*)calloc(MEMTRACE_MIN_CAPACITY, sizeof(tau_memtrace_alloc_t));
+  g_memtrace_alloc_capacity = MEMTRACE_MIN_CAPACITY;
+
+  g_memtrace_sites = (tau_memtrace_site_t**)calloc(MEMTRACE_MIN_CAPACITY, sizeof(tau_memtrace_site_t*));
+  g_memtrace_site_capacity = MEMTRACE_MIN_CAPACITY;
+
+  TAU_ASSERT(g_memtrace_allocs != NULL && g_memtrace_sites != NULL);
+
+  g_memtrace_sample_period = tau_memtrace_getenv("TAU_MEMTRACE_SAMPLE", 1);
+  g_memtrace_top_count = tau_memtrace_getenv("TAU_MEMTRACE_TOP", MEMTRACE_DEFAULT_TOP_COUNT);
+
+  tau_mutex_init(&g_memtrace_mutex);
+  atexit(tau_memtrace_atexit);
+}
+
+/**
+ * \brief Decides whether the next allocation of the calling thread is recorded.
+ */
+static bool tau_memtrace_should_record(void)
+{
+  if (g_memtrace_sample_period == 1)
+    return true;
+
+  if (g_memtrace_sample_countdown > 0)
+  {
+    g_memtrace_sample_countdown--;
+    return false;
+  }
+
+  g_memtrace_sample_countdown = g_memtrace_sample_period - 1;
+  return true;
+}
+
+/**
+ * \brief Finds the slot of an allocation or the empty slot where it belongs.
+ */
+static tau_memtrace_alloc_t* tau_memtrace_find_alloc(const void* ptr)
+{
+  size_t mask = g_memtrace_alloc_capacity - 1;
+  size_t idx = (size_t)tau_hash_ptr(ptr) & mask;
+
+  while (g_memtrace_allocs[idx].ptr != NULL && g_memtrace_allocs[idx].ptr != ptr)
+    idx = (idx + 1) & mask;
+
+  return &g_memtrace_allocs[idx];
+}
+
+/**
+ * \brief Doubles the number of slots in the allocation table.
+ */
+static void tau_memtrace_expand_allocs(void)
+{
+  tau_memtrace_alloc_t* old_allocs = g_memtrace_allocs;
+  size_t old_capacity = g_memtrace_alloc_capacity;
+
+  g_memtrace_allocs = (tau_memtrace_alloc_t*)calloc(old_capacity << 1, sizeof(tau_memtrace_alloc_t));
+  TAU_ASSERT(g_memtrace_allocs != NULL);
+
+  g_memtrace_alloc_capacity = old_capacity << 1;
+
+  for (size_t i = 0; i < old_capacity; i++)
+    if (old_allocs[i].ptr != NULL)
+      *tau_memtrace_find_alloc(old_allocs[i].ptr) = old_allocs[i];
+
+  free(old_allocs);
+}
+
+/**
+ * \brief Stores an allocation in the empty slot returned by
+ * `tau_memtrace_find_alloc`.
+ */
+static void tau_memtrace_insert_alloc(tau_memtrace_alloc_t* slot, const tau_memtrace_alloc_t* alloc)
+{
+  TAU_ASSERT(slot->ptr == NULL);
+
+  *slot = *alloc;
+
+  if (++g_memtrace_alloc_size * 2 > g_memtrace_alloc_capacity)
+    tau_memtrace_expand_allocs();
+}
+
+/**
+ * \brief Removes an allocation from the allocation table.
+ *
+ * \details The entries following the removed one in its probe sequence are
+ * shifted back, so that lookups need no tombstones.
+ */
+static void tau_memtrace_remove_alloc(tau_memtrace_alloc_t* slot)
+{
+  size_t mask = g_memtrace_alloc_capacity - 1;
+  size_t hole = (size_t)(slot - g_memtrace_allocs);
+
+  for (size_t idx = (hole + 1) & mask; g_memtrace_allocs[idx].ptr != NULL; idx = (idx + 1) & mask)
+  {
+    size_t home = (size_t)tau_hash_ptr(g_memtrace_allocs[idx].ptr) & mask;
+
+    // The entry can fill the hole if its home slot is not between the hole
+    // and the entry itself.
+    if (((idx - home) & mask) >= ((idx - hole) & mask))
+    {
+      g_memtrace_allocs[hole] = g_memtrace_allocs[idx];
+      hole = idx;
+    }
+  }
+
+  g_memtrace_allocs[hole].ptr = NULL;
+  g_memtrace_alloc_size--;
+}
 
 /**
- * \brief Returns the root allocation object.
+ * \brief Retrieves the allocation site at a location, creating it on first use.
  */
-tau_memtrace_alloc_t* tau_memtrace_alloc_root(void)
+static tau_memtrace_site_t* tau_memtrace_get_site(const char* file, int line, const char* func)
 {
-  static tau_memtrace_alloc_t* root = NULL;
+  uint64_t hash = tau_hash_combine_with_hash(tau_hash_ptr(file), (uint64_t)(uintptr_t)func ^ (uint64_t)line);
+  size_t mask = g_memtrace_site_capacity - 1;
+  size_t idx = (size_t)hash & mask;
 
-  // Initialize root.
-  if (root == NULL)
+  for (; g_memtrace_sites[idx] != NULL; idx = (idx + 1) & mask)
   {
-    root = (tau_memtrace_alloc_t*)calloc(1, sizeof(tau_memtrace_alloc_t));
-    atexit(tau_memtrace_atexit);
+    tau_memtrace_site_t* site = g_memtrace_sites[idx];
+
+    if (site->hash == hash && site->line == line && site->file == file && site->func == func)
+      return site;
   }
 
-  return root;
+  tau_memtrace_site_t* site = (tau_memtrace_site_t*)calloc(1, sizeof(tau_memtrace_site_t));
+  TAU_ASSERT(site != NULL);
+
+  site->file = file;
+  site->func = func;
+  site->line = line;
+  site->hash = hash;
+
+  g_memtrace_sites[idx] = site;
+
+  if (++g_memtrace_site_size * 2 > g_memtrace_site_capacity)
+  {
+    tau_memtrace_site_t** old_sites = g_memtrace_sites;
+    size_t old_capacity = g_memtrace_site_capacity;
+
+    g_memtrace_sites = (tau_memtrace_site_t**)calloc(old_capacity << 1, sizeof(tau_memtrace_site_t*));
+    TAU_ASSERT(g_memtrace_sites != NULL);
+
+    g_memtrace_site_capacity = old_capacity << 1;
+    mask = g_memtrace_site_capacity - 1;
+
+    for (size_t i = 0; i < old_capacity; i++)
+    {
+      if (old_sites[i] == NULL)
+        continue;
+
+      size_t new_idx = (size_t)old_sites[i]->hash & mask;
+
+      while (g_memtrace_sites[new_idx] != NULL)
+        new_idx = (new_idx + 1) & mask;
+
+      g_memtrace_sites[new_idx] = old_sites[i];
+    }
+
+    free(old_sites);
+  }
+
+  return site;
+}
+
+/**
+ * \brief Records an allocation. Must be called with the mutex held.
+ */
+static void tau_memtrace_record(void* ptr, size_t size, tau_memtrace_alloc_kind_t alloc_kind, const char* file, int line, const char* func)
+{
+  tau_memtrace_alloc_t alloc = {
+    .ptr = ptr,
+    .size = size,
+    .site = tau_memtrace_get_site(file, line, func),
+    .alloc_kind = alloc_kind,
+    .time = tau_timer_now(),
+  };
+
+  alloc.site->alloc_count++;
+  alloc.site->alloc_bytes += size;
+  alloc.site->live_count++;
+  alloc.site->live_bytes += size;
+
+  tau_memtrace_insert_alloc(tau_memtrace_find_alloc(ptr), &alloc);
+}
+
+/**
+ * \brief Removes the record of an allocation. Must be called with the mutex
+ * held.
+ */
+static void tau_memtrace_unrecord(tau_memtrace_alloc_t* slot)
+{
+  slot->site->live_count--;
+  slot->site->live_bytes -= slot->size;
+
+  g_memtrace_stat_total_lifetime += tau_timer_now() - slot->time;
+  g_memtrace_stat_lifetime_count++;
+
+  tau_memtrace_remove_alloc(slot);
 }
 
-void tau_memtrace_atexit(void)
+/**
+ * \brief Counts an allocation in the statistics. Must be called with the mutex
+ * held.
+ */
+static void tau_memtrace_count_alloc(size_t size)
 {
-  tau_memtrace_alloc_t* root = tau_memtrace_alloc_root();
+  g_memtrace_stat_total_alloc += size;
+  g_memtrace_stat_cur_alloc += size;
+  g_memtrace_stat_alloc_count++;
+
+  if (g_memtrace_stat_peak_alloc < g_memtrace_stat_cur_alloc)
+    g_memtrace_stat_peak_alloc = g_memtrace_stat_cur_alloc;
+}
 
+static int tau_memtrace_site_compare_bytes(const void* lhs, const void* rhs)
+{
+  const tau_memtrace_site_t* lhs_site = *(const tau_memtrace_site_t* const*)lhs;
+  const tau_memtrace_site_t* rhs_site = *(const tau_memtrace_site_t* const*)rhs;
+
+  return (lhs_site->alloc_bytes < rhs_site->alloc_bytes) - (lhs_site->alloc_bytes > rhs_site->alloc_bytes);
+}
+
+static int tau_memtrace_site_compare_count(const void* lhs, const void* rhs)
+{
+  const tau_memtrace_site_t* lhs_site = *(const tau_memtrace_site_t* const*)lhs;
+  const tau_memtrace_site_t* rhs_site = *(const tau_memtrace_site_t* const*)rhs;
+
+  return (lhs_site->alloc_count < rhs_site->alloc_count) - (lhs_site->alloc_count > rhs_site->alloc_count);
+}
+
+/**
+ * \brief Logs the allocation sites with the most recorded allocations.
+ */
+static void tau_memtrace_log_top_sites(tau_memtrace_site_t** sites, int (*compare)(const void*, const void*), const char* order)
+{
+  qsort(sites, g_memtrace_site_size, sizeof(tau_memtrace_site_t*), compare);
+
+  size_t count = TAU_MIN(g_memtrace_top_count, g_memtrace_site_size);
+
+  tau_log_debug("memtrace", "Top %zu allocation sites by %s:", count, order);
+
+  for (size_t i = 0; i < count; i++)
+    tau_log_debug("memtrace", "%zu bytes in %zu allocations at %s:%d (%s)", sites[i]->alloc_bytes, sites[i]->alloc_count, sites[i]->file, sites[i]->line, sites[i]->func);
+}
+
+static void tau_memtrace_atexit(void)
+{
   tau_log_debug("memtrace", "Total allocated memory: %zu bytes", tau_memtrace_stat_total_alloc());
   tau_log_debug("memtrace", "Peak allocated memory: %zu bytes", tau_memtrace_stat_peak_alloc());
   tau_log_debug("memtrace", "Total allocation count: %zu", tau_memtrace_stat_alloc_count());
   tau_log_debug("memtrace", "Average allocation size: %zu bytes", tau_memtrace_stat_avg_alloc_size());
   tau_log_debug("memtrace", "Average lifetime: %.6g ms", tau_memtrace_stat_avg_lifetime());
 
-  if (root->next == NULL)
+  if (g_memtrace_sample_period > 1)
+    tau_log_debug("memtrace", "Recorded 1 in %zu allocations.", g_memtrace_sample_period);
+
+  tau_memtrace_site_t** sites = (tau_memtrace_site_t**)malloc(sizeof(tau_memtrace_site_t*) * TAU_MAX(g_memtrace_site_size, (size_t)1));
+  TAU_ASSERT(sites != NULL);
+
+  for (size_t i = 0, j = 0; i < g_memtrace_site_capacity; i++)
+    if (g_memtrace_sites[i] != NULL)
+      sites[j++] = g_memtrace_sites[i];
+
+  tau_memtrace_log_top_sites(sites, tau_memtrace_site_compare_bytes, "bytes");
+  tau_memtrace_log_top_sites(sites, tau_memtrace_site_compare_count, "count");
+
+  if (g_memtrace_alloc_size == 0)
     tau_log_debug("memtrace", "No leaks detected.");
   else
   {
@@ -123,15 +431,21 @@ void tau_memtrace_atexit(void)
     TAU_DEBUGBREAK();
   }
 
-  for (tau_memtrace_alloc_t *alloc = root->next, *next; alloc != NULL; alloc = next)
-  {
-    next = alloc->next;
+  for (size_t i = 0; i < g_memtrace_site_size; i++)
+    if (sites[i]->live_count > 0)
+      tau_log_debug("memtrace", "%zu bytes in %zu allocations leaked at %s:%d (%s)", sites[i]->live_bytes, sites[i]->live_count, sites[i]->file, sites[i]->line, sites[i]->func);
 
-    tau_log_debug("memtrace", "%zu bytes at %p (%s:%d)", alloc->data.size, alloc->data.ptr, alloc->meta.file, alloc->meta.line);
+  free(sites);
 
-    free(alloc->data.ptr);
-    free(alloc);
-  }
+  // The tables stay in place for deallocations by later exit handlers.
+  for (size_t i = 0; i < g_memtrace_alloc_capacity; i++)
+    if (g_memtrace_allocs[i].ptr != NULL)
+    {
+      tau_memstat_free(g_memtrace_allocs[i].ptr);
+      g_memtrace_allocs[i].ptr = NULL;
+    }
+
+  g_memtrace_alloc_size = 0;
 }
 
 void* tau_memtrace_malloc(size_t size, const char* file, int line, const char* func)
@@ -143,7 +457,7 @@ void* tau_memtrace_malloc(size_t size, const char* file, int line, const char* f
     return NULL;
   }
 
-  void* ptr = malloc(size);
+  void* ptr = tau_memstat_malloc(size);
 
   if (ptr == NULL)
   {
@@ -152,27 +466,18 @@ void* tau_memtrace_malloc(size_t size, const char* file, int line, const char* f
     return NULL;
   }
 
-  tau_memtrace_alloc_t* alloc = (tau_memtrace_alloc_t*)malloc(sizeof(tau_memtrace_alloc_t));
-  TAU_ASSERT(alloc != NULL);
-  alloc->data.ptr = ptr;
-  alloc->data.size = size;
-  alloc->meta.alloc_kind = TAU_MEMTRACE_MALLOC;
-  alloc->meta.file = file;
-  alloc->meta.line = line;
-  alloc->meta.func = func;
-  alloc->meta.time = tau_timer_now();
+  tau_memtrace_init();
 
-  tau_memtrace_alloc_t* root = tau_memtrace_alloc_root();
+  bool should_record = tau_memtrace_should_record();
 
-  alloc->next = root->next;
-  root->next = alloc;
+  tau_mutex_lock(&g_memtrace_mutex);
 
-  g_memtrace_stat_total_alloc += size;
-  g_memtrace_stat_cur_alloc += size;
-  g_memtrace_stat_alloc_count++;
+  if (should_record)
+    tau_memtrace_record(ptr, size, TAU_MEMTRACE_MALLOC, file, line, func);
 
-  if (g_memtrace_stat_peak_alloc < g_memtrace_stat_cur_alloc)
-    g_memtrace_stat_peak_alloc = g_memtrace_stat_cur_alloc;
+  tau_memtrace_count_alloc(size);
+
+  tau_mutex_unlock(&g_memtrace_mutex);
 
   return ptr;
 }
@@ -186,7 +491,7 @@ void* tau_memtrace_calloc(size_t count, size_t size, const char* file, int line,
     return NULL;
   }
 
-  void* ptr = calloc(count, size);
+  void* ptr = tau_memstat_calloc(count, size);
 
   if (ptr == NULL)
   {
@@ -195,27 +500,18 @@ void* tau_memtrace_calloc(size_t count, size_t size, const char* file, int line,
     return NULL;
   }
 
-  tau_memtrace_alloc_t* alloc = (tau_memtrace_alloc_t*)malloc(sizeof(tau_memtrace_alloc_t));
-  TAU_ASSERT(alloc != NULL);
-  alloc->data.ptr = ptr;
-  alloc->data.size = size;
-  alloc->meta.alloc_kind = TAU_MEMTRACE_CALLOC;
-  alloc->meta.file = file;
-  alloc->meta.line = line;
-  alloc->meta.func = func;
-  alloc->meta.time = tau_timer_now();
+  tau_memtrace_init();
 
-  tau_memtrace_alloc_t* root = tau_memtrace_alloc_root();
+  bool should_record = tau_memtrace_should_record();
 
-  alloc->next = root->next;
-  root->next = alloc;
+  tau_mutex_lock(&g_memtrace_mutex);
 
-  g_memtrace_stat_total_alloc += size;
-  g_memtrace_stat_cur_alloc += size;
-  g_memtrace_stat_alloc_count++;
+  if (should_record)
+    tau_memtrace_record(ptr, count * size, TAU_MEMTRACE_CALLOC, file, line, func);
 
-  if (g_memtrace_stat_peak_alloc < g_memtrace_stat_cur_alloc)
-    g_memtrace_stat_peak_alloc = g_memtrace_stat_cur_alloc;
+  tau_memtrace_count_alloc(count * size);
+
+  tau_mutex_unlock(&g_memtrace_mutex);
 
   return ptr;
 }
@@ -233,51 +529,49 @@ void* tau_memtrace_realloc(void* ptr, size_t size, const char* file, int line, c
     return NULL;
   }
 
-  tau_memtrace_alloc_t* alloc = tau_memtrace_alloc_root();
-  alloc = alloc->next;
+  tau_memtrace_init();
+
+  tau_mutex_lock(&g_memtrace_mutex);
 
-  for (; alloc != NULL; alloc = alloc->next)
-    if (alloc->data.ptr == ptr)
-      break;
+  tau_memtrace_alloc_t* slot = tau_memtrace_find_alloc(ptr);
+  bool is_recorded = slot->ptr != NULL;
 
-  if (alloc == NULL)
+  // Unless every allocation is recorded, a missing one may not be sampled.
+  if (!is_recorded && g_memtrace_sample_period == 1)
   {
+    tau_mutex_unlock(&g_memtrace_mutex);
     tau_log_error("memtrace", "Reallocating invalid memory: %p.", ptr);
     TAU_DEBUGBREAK();
     return NULL;
   }
 
-  void* new_ptr = realloc(alloc->data.ptr, size);
+  size_t old_size = tau_memstat_size(ptr);
+
+  void* new_ptr = tau_memstat_realloc(ptr, size);
 
   if (new_ptr == NULL)
   {
+    tau_mutex_unlock(&g_memtrace_mutex);
     tau_log_warn("memtrace", "Reallocation failed.");
     TAU_DEBUGBREAK();
     return NULL;
   }
 
-  g_memtrace_stat_cur_alloc += size - alloc->data.size;
-
-  alloc->data.ptr = new_ptr;
-  alloc->data.size = size;
-  alloc->meta.alloc_kind = TAU_MEMTRACE_REALLOC;
-  alloc->meta.file = file;
-  alloc->meta.line = line;
-  alloc->meta.func = func;
+  if (is_recorded)
+    tau_memtrace_unrecord(slot);
 
-  uint64_t now = tau_timer_now();
-  g_memtrace_stat_total_lifetime += now - alloc->meta.time;
+  // Recorded memory stays recorded, other memory is sampled as a new
+  // allocation.
+  if (is_recorded || tau_memtrace_should_record())
+    tau_memtrace_record(new_ptr, size, TAU_MEMTRACE_REALLOC, file, line, func);
 
-  alloc->meta.time = now;
+  g_memtrace_stat_cur_alloc -= old_size;
 
-  g_memtrace_stat_total_alloc += size;
-  g_memtrace_stat_alloc_count++;
-  g_memtrace_stat_dealloc_count++;
+  tau_memtrace_count_alloc(size);
 
-  if (g_memtrace_stat_peak_alloc < g_memtrace_stat_cur_alloc)
-    g_memtrace_stat_peak_alloc = g_memtrace_stat_cur_alloc;
+  tau_mutex_unlock(&g_memtrace_mutex);
 
-  return alloc->data.ptr;
+  return new_ptr;
 }
 
 void tau_memtrace_free(void* ptr, const char* TAU_UNUSED(file), int TAU_UNUSED(line), const char* TAU_UNUSED(func))
@@ -285,28 +579,27 @@ void tau_memtrace_free(void* ptr, const char* TAU_UNUSED(file), int TAU_UNUSED(l
   if (ptr == NULL)
     return;
 
-  tau_memtrace_alloc_t *alloc = tau_memtrace_alloc_root(), *prev = alloc;
-  alloc = alloc->next;
+  tau_memtrace_init();
+
+  tau_mutex_lock(&g_memtrace_mutex);
 
-  for (; alloc != NULL; prev = alloc, alloc = alloc->next)
-    if (alloc->data.ptr == ptr)
-      break;
+  tau_memtrace_alloc_t* slot = tau_memtrace_find_alloc(ptr);
 
-  if (alloc == NULL)
+  if (slot->ptr != NULL)
+    tau_memtrace_unrecord(slot);
+  else if (g_memtrace_sample_period == 1)
   {
+    tau_mutex_unlock(&g_memtrace_mutex);
     tau_log_error("memtrace", "Deallocating invalid memory: %p.", ptr);
     TAU_DEBUGBREAK();
     return;
   }
 
-  prev->next = alloc->next;
+  g_memtrace_stat_cur_alloc -= tau_memstat_size(ptr);
 
-  g_memtrace_stat_total_lifetime += tau_timer_now() - alloc->meta.time;
-  g_memtrace_stat_cur_alloc -= alloc->data.size;
-  g_memtrace_stat_dealloc_count++;
+  tau_mutex_unlock(&g_memtrace_mutex);
 
-  free(alloc->data.ptr);
-  free(alloc);
+  tau_memstat_free(ptr);
 }
 
 size_t tau_memtrace_stat_total_alloc(void)
@@ -336,5 +629,5 @@ size_t tau_memtrace_stat_avg_alloc_size(void)
 
 double tau_memtrace_stat_avg_lifetime(void)
 {
-  return (double)g_memtrace_stat_total_lifetime / (double)g_memtrace_stat_dealloc_count / (double)tau_timer_freq() * 1000.0;
+  return (double)g_memtrace_stat_total_lifetime / (double)g_memtrace_stat_lifetime_count / (double)tau_timer_freq() * 1000.0;
 }
@@ -0,0 +1,309 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "utils/scan.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/compiler_detect.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define TAU_SCAN_SSE2 1
+#else
+# define TAU_SCAN_SSE2 0
+#endif
+
+#if TAU_SCAN_SSE2 && (TAU_COMPILER_GCC || TAU_COMPILER_CLANG)
+// AVX2 functions are compiled for AVX2 regardless of the target flags and are
+// only called if the processor reports AVX2 support.
+# define TAU_SCAN_AVX2 1
+# define TAU_SCAN_AVX2_TARGET __attribute__((target("avx2")))
+# define tau_scan_avx2_supported() __builtin_cpu_supports("avx2")
+#elif TAU_SCAN_SSE2 && defined(__AVX2__)
+# define TAU_SCAN_AVX2 1
+# define TAU_SCAN_AVX2_TARGET
+# define tau_scan_avx2_supported() true
+#else
+# define TAU_SCAN_AVX2 0
+#endif
+
+#if TAU_SCAN_SSE2
+# include <emmintrin.h>
+#endif
+
+#if TAU_SCAN_AVX2
+# include <immintrin.h>
+#endif
+
+#if TAU_COMPILER_MSVC
+# include <intrin.h>
+#endif
+
+/**
+ * \brief Counts the number of trailing zero bits in a non-zero mask.
+ *
+ * \param[in] mask The mask, must not be zero.
+ * \returns The index of the lowest set bit.
+ */
+static inline uint32_t tau_scan_ctz(uint32_t mask)
+{
+#if TAU_COMPILER_MSVC
+  unsigned long idx;
+  _BitScanForward(&idx, mask);
+  return (uint32_t)idx;
+#else
+  return (uint32_t)__builtin_ctz(mask);
+#endif
+}
+
+static inline bool tau_scan_is_blank(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\v' || ch == '\f' || ch == '\r';
+}
+
+static inline bool tau_scan_is_word(char ch)
+{
+  return ('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') || ('0' <= ch && ch <= '9') || ch == '_';
+}
+
+#if TAU_SCAN_SSE2
+
+/**
+ * \brief Checks which bytes in a vector are within an inclusive range.
+ *
+ * \details Both bounds must be ASCII characters. Bytes with their highest bit
+ * set compare as negative and are never in range.
+ */
+static inline __m128i tau_scan_sse2_in_range(__m128i v, char lo, char hi)
+{
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(lo - 1))), _mm_cmplt_epi8(v, _mm_set1_epi8((char)(hi + 1))));
+}
+
+static inline __m128i tau_scan_sse2_blank(__m128i v)
+{
+  __m128i space = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+  __m128i control = tau_scan_sse2_in_range(v, '\t', '\r');
+  __m128i newline = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+
+  return _mm_or_si128(space, _mm_andnot_si128(newline, control));
+}
+
+static inline __m128i tau_scan_sse2_word(__m128i v)
+{
+  __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  __m128i alpha = tau_scan_sse2_in_range(lower, 'a', 'z');
+  __m128i digit = tau_scan_sse2_in_range(v, '0', '9');
+  __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+
+  return _mm_or_si128(_mm_or_si128(alpha, digit), underscore);
+}
+
+/**
+ * \brief Scans full 16-byte blocks starting at `*it`.
+ *
+ * \details `MASK` is evaluated with the loaded block in `v` and must yield a
+ * bit mask of the bytes being searched for. Returns the first such byte from
+ * the enclosing function, otherwise leaves `*it` at the unscanned tail.
+ */
+#define TAU_SCAN_SSE2_BLOCKS(IT, END, MASK)\
+  do {\
+    for (; (END) - *(IT) >= 16; *(IT) += 16)\
+    {\
+      __m128i v = _mm_loadu_si128((const __m128i*)*(IT));\
+      uint32_t mask = (uint32_t)(MASK);\
+      if (mask != 0)\
+        return *(IT) + tau_scan_ctz(mask);\
+    }\
+    return NULL;\
+  } while (0)
+
+static const char* tau_scan_sse2_skip_blank(const char** it, const char* end)
+{
+  TAU_SCAN_SSE2_BLOCKS(it, end, ~_mm_movemask_epi8(tau_scan_sse2_blank(v)) & 0xFFFF);
+}
+
+static const char* tau_scan_sse2_skip_word(const char** it, const char* end)
+{
+  TAU_SCAN_SSE2_BLOCKS(it, end, ~_mm_movemask_epi8(tau_scan_sse2_word(v)) & 0xFFFF);
+}
+
+static const char* tau_scan_sse2_find_either(const char** it, const char* end, char a, char b)
+{
+  __m128i va = _mm_set1_epi8(a);
+  __m128i vb = _mm_set1_epi8(b);
+
+  TAU_SCAN_SSE2_BLOCKS(it, end, _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))));
+}
+
+#endif
+
+#if TAU_SCAN_AVX2
+
+TAU_SCAN_AVX2_TARGET
+static inline __m256i tau_scan_avx2_in_range(__m256i v, char lo, char hi)
+{
+  return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8((char)(lo - 1))), _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(hi + 1)), v));
+}
+
+TAU_SCAN_AVX2_TARGET
+static inline __m256i tau_scan_avx2_blank(__m256i v)
+{
+  __m256i space = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+  __m256i control = tau_scan_avx2_in_range(v, '\t', '\r');
+  __m256i newline = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+
+  return _mm256_or_si256(space, _mm256_andnot_si256(newline, control));
+}
+
+TAU_SCAN_AVX2_TARGET
+static inline __m256i tau_scan_avx2_word(__m256i v)
+{
+  __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+  __m256i alpha = tau_scan_avx2_in_range(lower, 'a', 'z');
+  __m256i digit = tau_scan_avx2_in_range(v, '0', '9');
+  __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+
+  return _mm256_or_si256(_mm256_or_si256(alpha, digit), underscore);
+}
+
+/**
+ * \brief Scans full 32-byte blocks starting at `*it`, see
+ * `TAU_SCAN_SSE2_BLOCKS`.
+ */
+#define TAU_SCAN_AVX2_BLOCKS(IT, END, MASK)\
+  do {\
+    for (; (END) - *(IT) >= 32; *(IT) += 32)\
+    {\
+      __m256i v = _mm256_loadu_si256((const __m256i*)*(IT));\
+      uint32_t mask = (uint32_t)(MASK);\
+      if (mask != 0)\
+        return *(IT) + tau_scan_ctz(mask);\
+    }\
+    return NULL;\
+  } while (0)
+
+TAU_SCAN_AVX2_TARGET
+static const char* tau_scan_avx2_skip_blank(const char** it, const char* end)
+{
+  TAU_SCAN_AVX2_BLOCKS(it, end, ~(uint32_t)_mm256_movemask_epi8(tau_scan_avx2_blank(v)));
+}
+
+TAU_SCAN_AVX2_TARGET
+static const char* tau_scan_avx2_skip_word(const char** it, const char* end)
+{
+  TAU_SCAN_AVX2_BLOCKS(it, end, ~(uint32_t)_mm256_movemask_epi8(tau_scan_avx2_word(v)));
+}
+
+TAU_SCAN_AVX2_TARGET
+static const char* tau_scan_avx2_find_either(const char** it, const char* end, char a, char b)
+{
+  __m256i va = _mm256_set1_epi8(a);
+  __m256i vb = _mm256_set1_epi8(b);
+
+  TAU_SCAN_AVX2_BLOCKS(it, end, _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb))));
+}
+
+#endif
+
+const char* tau_scan_skip_blank(const char* begin, const char* end)
+{
+  const char* it = begin;
+
+  // Short runs such as single spaces between tokens are cheaper to test
+  // directly than to load into a vector.
+  if (it < end && !tau_scan_is_blank(*it))
+    return it;
+
+#if TAU_SCAN_AVX2
+  if (tau_scan_avx2_supported())
+  {
+    const char* hit = tau_scan_avx2_skip_blank(&it, end);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+#if TAU_SCAN_SSE2
+  {
+    const char* hit = tau_scan_sse2_skip_blank(&it, end);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+  while (it < end && tau_scan_is_blank(*it))
+    it++;
+
+  return it;
+}
+
+const char* tau_scan_skip_word(const char* begin, const char* end)
+{
+  const char* it = begin;
+
+#if TAU_SCAN_AVX2
+  if (tau_scan_avx2_supported())
+  {
+    const char* hit = tau_scan_avx2_skip_word(&it, end);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+#if TAU_SCAN_SSE2
+  {
+    const char* hit = tau_scan_sse2_skip_word(&it, end);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+  while (it < end && tau_scan_is_word(*it))
+    it++;
+
+  return it;
+}
+
+const char* tau_scan_find_newline(const char* begin, const char* end)
+{
+  return tau_scan_find_either(begin, end, '\n', '\n');
+}
+
+const char* tau_scan_find_either(const char* begin, const char* end, char a, char b)
+{
+  const char* it = begin;
+
+#if TAU_SCAN_AVX2
+  if (tau_scan_avx2_supported())
+  {
+    const char* hit = tau_scan_avx2_find_either(&it, end, a, b);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+#if TAU_SCAN_SSE2
+  {
+    const char* hit = tau_scan_sse2_find_either(&it, end, a, b);
+
+    if (hit != NULL)
+      return hit;
+  }
+#endif
+
+  while (it < end && *it != a && *it != b)
+    it++;
+
+  return it;
+}
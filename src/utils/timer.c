@@ -21,10 +21,8 @@ uint64_t tau_timer_freq(void)
   LARGE_INTEGER f;
   QueryPerformanceFrequency(&f);
   return (uint64_t)f.QuadPart;
-#elif TAU_OS_UNIX
-  struct timespec ts;
-  clock_getres(CLOCK_MONOTONIC, &ts);
-  return (uint64_t)(ts.tv_sec * 1000000ull + ts.tv_nsec);
+#elif TAU_OS_LINUX || TAU_OS_DARWIN
+  return 1000000000ull;
 #else
   return (uint64_t)CLOCKS_PER_SEC;
 #endif
@@ -36,10 +34,10 @@ uint64_t tau_timer_now(void)
   LARGE_INTEGER t;
   QueryPerformanceCounter(&t);
   return (uint64_t)t.QuadPart;
-#elif TAU_OS_UNIX
+#elif TAU_OS_LINUX || TAU_OS_DARWIN
   struct timespec ts;
   clock_gettime(CLOCK_MONOTONIC, &ts);
-  return (uint64_t)(ts.tv_sec * 1000000ull + ts.tv_nsec);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
 #else
   return (uint64_t)clock();
 #endif
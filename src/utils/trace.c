@@ -0,0 +1,257 @@
+/**
+ * \file
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#include "utils/trace.h"
+
+#include <string.h>
+
+#include "utils/common.h"
+#include "utils/timer.h"
+#include "utils/collections/vector.h"
+#include "utils/concurrency/mutex.h"
+
+/**
+ * \brief Represents a recorded span.
+ */
+typedef struct tau_trace_event_t
+{
+  const char* name; // Name of the span.
+  char* detail; // Null-terminated copy of the detail or `NULL`.
+  uint64_t begin; // Time the span began in ticks.
+  uint64_t end; // Time the span ended in ticks or `0` if still open.
+} tau_trace_event_t;
+
+/**
+ * \brief Represents the spans recorded by a thread.
+ */
+typedef struct tau_trace_thread_t
+{
+  size_t tid; // Index of the thread in the order of its first span.
+  size_t generation; // Generation of the library the thread recorded into.
+  tau_trace_event_t* events; // Array of recorded spans in the order they began.
+  size_t event_count; // Number of recorded spans.
+  size_t event_capacity; // Capacity of the array of spans.
+  size_t* open; // Stack of indices of the open spans.
+  size_t open_count; // Number of open spans.
+  size_t open_capacity; // Capacity of the stack of open spans.
+} tau_trace_thread_t;
+
+static bool g_trace_enabled = false;
+static size_t g_trace_generation = 0;
+static uint64_t g_trace_begin = 0;
+static tau_mutex_t g_trace_mutex;
+static tau_vector_t* g_trace_threads = NULL;
+static TAU_THREAD_LOCAL tau_trace_thread_t* g_trace_thread = NULL;
+
+/**
+ * \brief Retrieves the spans of the calling thread, registering the thread on
+ * its first span.
+ */
+static tau_trace_thread_t* tau_trace_get_thread(void)
+{
+  if (g_trace_thread != NULL && g_trace_thread->generation == g_trace_generation)
+    return g_trace_thread;
+
+  tau_trace_thread_t* thread = (tau_trace_thread_t*)calloc(1, sizeof(tau_trace_thread_t));
+  TAU_ASSERT(thread != NULL);
+
+  thread->generation = g_trace_generation;
+
+  tau_mutex_lock(&g_trace_mutex);
+
+  thread->tid = tau_vector_size(g_trace_threads);
+  tau_vector_push(g_trace_threads, thread);
+
+  tau_mutex_unlock(&g_trace_mutex);
+
+  g_trace_thread = thread;
+
+  return thread;
+}
+
+/**
+ * \brief Writes a string as a JSON string literal.
+ */
+static void tau_trace_write_string(FILE* stream, const char* str)
+{
+  fputc('"', stream);
+
+  for (const char* it = str; *it != '\0'; it++)
+  {
+    unsigned char ch = (unsigned char)*it;
+
+    if (ch == '"' || ch == '\\')
+      fprintf(stream, "\\%c", ch);
+    else if (ch < 0x20)
+      fprintf(stream, "\\u%04x", ch);
+    else
+      fputc(ch, stream);
+  }
+
+  fputc('"', stream);
+}
+
+void tau_trace_init(void)
+{
+  if (g_trace_enabled)
+    return;
+
+  tau_mutex_init(&g_trace_mutex);
+
+  g_trace_threads = tau_vector_init();
+  g_trace_generation++;
+  g_trace_begin = tau_timer_now();
+  g_trace_enabled = true;
+
+  // The initializing thread is the first one in the trace.
+  tau_trace_get_thread();
+}
+
+void tau_trace_free(void)
+{
+  if (!g_trace_enabled)
+    return;
+
+  g_trace_enabled = false;
+
+  TAU_VECTOR_FOR_LOOP(i, g_trace_threads)
+  {
+    tau_trace_thread_t* thread = (tau_trace_thread_t*)tau_vector_get(g_trace_threads, i);
+
+    for (size_t j = 0; j < thread->event_count; j++)
+      free(thread->events[j].detail);
+
+    free(thread->events);
+    free(thread->open);
+    free(thread);
+  }
+
+  tau_vector_free(g_trace_threads);
+  g_trace_threads = NULL;
+  g_trace_thread = NULL;
+
+  tau_mutex_free(&g_trace_mutex);
+}
+
+bool tau_trace_is_enabled(void)
+{
+  return g_trace_enabled;
+}
+
+void tau_trace_begin(const char* name)
+{
+  tau_trace_begin_with_detail(name, NULL, 0);
+}
+
+void tau_trace_begin_with_detail(const char* name, const char* detail, size_t len)
+{
+  if (!g_trace_enabled)
+    return;
+
+  tau_trace_thread_t* thread = tau_trace_get_thread();
+
+  if (thread->event_count == thread->event_capacity)
+  {
+    thread->event_capacity = thread->event_capacity == 0 ? 64 : thread->event_capacity * 2;
+    thread->events = (tau_trace_event_t*)realloc(thread->events, sizeof(tau_trace_event_t) * thread->event_capacity);
+    TAU_ASSERT(thread->events != NULL);
+  }
+
+  if (thread->open_count == thread->open_capacity)
+  {
+    thread->open_capacity = thread->open_capacity == 0 ? 16 : thread->open_capacity * 2;
+    thread->open = (size_t*)realloc(thread->open, sizeof(size_t) * thread->open_capacity);
+    TAU_ASSERT(thread->open != NULL);
+  }
+
+  tau_trace_event_t* event = &thread->events[thread->event_count];
+
+  event->name = name;
+  event->detail = NULL;
+  event->end = 0;
+
+  if (detail != NULL)
+  {
+    event->detail = (char*)malloc(sizeof(char) * (len + 1));
+    TAU_ASSERT(event->detail != NULL);
+
+    memcpy(event->detail, detail, len);
+    event->detail[len] = '\0';
+  }
+
+  thread->open[thread->open_count++] = thread->event_count++;
+
+  // Taken last so that recording the span is not part of it.
+  event->begin = tau_timer_now();
+}
+
+void tau_trace_end(void)
+{
+  if (!g_trace_enabled)
+    return;
+
+  uint64_t now = tau_timer_now();
+
+  tau_trace_thread_t* thread = tau_trace_get_thread();
+
+  TAU_ASSERT(thread->open_count > 0);
+
+  thread->events[thread->open[--thread->open_count]].end = now;
+}
+
+bool tau_trace_write(const char* path)
+{
+  if (!g_trace_enabled)
+    return false;
+
+  FILE* stream = fopen(path, "w");
+
+  if (stream == NULL)
+    return false;
+
+  uint64_t now = tau_timer_now();
+  double usec_per_tick = 1000000.0 / (double)tau_timer_freq();
+
+  fputs("{\"traceEvents\":[", stream);
+
+  TAU_VECTOR_FOR_LOOP(i, g_trace_threads)
+  {
+    tau_trace_thread_t* thread = (tau_trace_thread_t*)tau_vector_get(g_trace_threads, i);
+
+    fprintf(stream, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"%s\"}}", i == 0 ? "" : ",", thread->tid, thread->tid == 0 ? "main" : "worker");
+
+    for (size_t j = 0; j < thread->event_count; j++)
+    {
+      tau_trace_event_t* event = &thread->events[j];
+
+      uint64_t end = event->end == 0 ? now : event->end;
+
+      fputs(",\n{\"name\":", stream);
+      tau_trace_write_string(stream, event->name);
+      fprintf(stream, ",\"cat\":\"tau\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f",
+        thread->tid,
+        (double)(event->begin - g_trace_begin) * usec_per_tick,
+        (double)(end - event->begin) * usec_per_tick
+      );
+
+      if (event->detail != NULL)
+      {
+        fputs(",\"args\":{\"detail\":", stream);
+        tau_trace_write_string(stream, event->detail);
+        fputc('}', stream);
+      }
+
+      fputc('}', stream);
+    }
+  }
+
+  fputs("\n],\"displayTimeUnit\":\"ms\"}\n", stream);
+
+  bool is_written = !ferror(stream);
+
+  return fclose(stream) == 0 && is_written;
+}
@@ -0,0 +1,64 @@
+#include "bench.h"
+
+#include "utils/memory/arena.h"
+
+BENCH_CASE(tau_arena_alloc)
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  BENCH_LOOP(10000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_arena_alloc(arena, 24));
+  }
+
+  tau_arena_free(arena);
+}
+
+BENCH_CASE(tau_arena_alloc_aligned)
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  BENCH_LOOP(10000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_arena_alloc_aligned(arena, 24, 64));
+  }
+
+  tau_arena_free(arena);
+}
+
+BENCH_CASE(tau_arena_mark_rollback)
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  // Rolling back to an empty arena would free its only chunk every time.
+  tau_arena_alloc(arena, 16);
+
+  BENCH_LOOP(10000)
+  {
+    tau_arena_mark_t mark = tau_arena_mark(arena);
+
+    BENCH_DO_NOT_OPTIMIZE(tau_arena_alloc(arena, 256));
+
+    tau_arena_rollback(arena, mark);
+  }
+
+  tau_arena_free(arena);
+}
+
+BENCH_CASE(malloc_free)
+{
+  BENCH_LOOP(10000)
+  {
+    void* ptr = malloc(24);
+    BENCH_DO_NOT_OPTIMIZE(ptr);
+    free(ptr);
+  }
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_arena_alloc);
+  TEST_RUN(tau_arena_alloc_aligned);
+  TEST_RUN(tau_arena_mark_rollback);
+  TEST_RUN(malloc_free);
+}
@@ -1,5 +1,7 @@
 #include "test.h"
 
+#include <stdint.h>
+
 #include "utils/memory/arena.h"
 
 TEST_CASE(tau_arena_init)
@@ -34,14 +36,60 @@ TEST_CASE(tau_arena_alloc)
   tau_arena_free(arena);
 }
 
-TEST_CASE(tau_arena_alloc_fail)
+TEST_CASE(tau_arena_alloc_large)
 {
   tau_arena_t* arena = tau_arena_init();
 
   size_t capacity = tau_arena_capacity(arena);
-  void* mem = tau_arena_alloc(arena, capacity + 1);
+  void* mem1 = tau_arena_alloc(arena, 16);
+  void* mem2 = tau_arena_alloc(arena, capacity + 1);
+  void* mem3 = tau_arena_alloc(arena, 16);
+
+  TEST_ASSERT_NOT_NULL(mem2);
+  TEST_ASSERT_TRUE(tau_arena_owns(arena, mem2));
+  TEST_ASSERT_TRUE(tau_arena_owns(arena, (char*)mem2 + capacity));
+
+  // Small allocations keep being served from the same chunk.
+  TEST_ASSERT_PTR_EQUAL((char*)mem3, (char*)mem1 + 16);
+
+  tau_arena_stats_t stats = tau_arena_stats(arena);
+
+  TEST_ASSERT_EQUAL(stats.chunk_count, 2);
+  TEST_ASSERT_EQUAL(stats.large_chunk_count, 1);
+
+  tau_arena_free(arena);
+}
+
+TEST_CASE(tau_arena_alloc_aligned)
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  for (size_t alignment = 1; alignment <= 4096; alignment <<= 1)
+  {
+    tau_arena_alloc_aligned(arena, 1, 1);
+
+    void* mem = tau_arena_alloc_aligned(arena, 24, alignment);
 
-  TEST_ASSERT_NULL(mem);
+    TEST_ASSERT_EQUAL((uintptr_t)mem % alignment, 0);
+  }
+
+  tau_arena_free(arena);
+}
+
+TEST_CASE(tau_arena_alloc_growth)
+{
+  tau_arena_t* arena = tau_arena_init_with_capacity(1024);
+
+  for (size_t i = 0; i < 100000; i++)
+    TEST_ASSERT_NOT_NULL(tau_arena_alloc(arena, 24));
+
+  tau_arena_stats_t stats = tau_arena_stats(arena);
+
+  // Chunk capacities double, so a few chunks hold every allocation.
+  TEST_ASSERT_TRUE(stats.chunk_count <= 16);
+  TEST_ASSERT_EQUAL(stats.large_chunk_count, 0);
+  TEST_ASSERT_TRUE(stats.used >= 100000 * 24);
+  TEST_ASSERT_TRUE(stats.reserved >= stats.used);
 
   tau_arena_free(arena);
 }
@@ -80,11 +128,84 @@ TEST_CASE(tau_arena_capacity_alloc_extend)
   tau_arena_free(arena);
 }
 
+TEST_CASE(tau_arena_merge)
+{
+  size_t capacity = 1024;
+  tau_arena_t* dest = tau_arena_init_with_capacity(capacity);
+  tau_arena_t* src = tau_arena_init_with_capacity(capacity);
+
+  void* mem1 = tau_arena_alloc(dest, capacity);
+  void* mem2 = tau_arena_alloc(src, capacity);
+
+  tau_arena_merge(dest, src);
+
+  TEST_ASSERT_TRUE(tau_arena_owns(dest, mem1));
+  TEST_ASSERT_TRUE(tau_arena_owns(dest, mem2));
+
+  tau_arena_free(dest);
+}
+
+TEST_CASE(tau_arena_rollback)
+{
+  tau_arena_t* arena = tau_arena_init_with_capacity(1024);
+
+  void* mem1 = tau_arena_alloc(arena, 16);
+
+  tau_arena_mark_t mark = tau_arena_mark(arena);
+
+  void* mem2 = tau_arena_alloc(arena, 16);
+
+  for (size_t i = 0; i < 1000; i++)
+    tau_arena_alloc(arena, 64);
+
+  tau_arena_alloc(arena, 4096);
+
+  tau_arena_rollback(arena, mark);
+
+  tau_arena_stats_t stats = tau_arena_stats(arena);
+
+  TEST_ASSERT_EQUAL(stats.chunk_count, 1);
+  TEST_ASSERT_TRUE(tau_arena_owns(arena, mem1));
+  TEST_ASSERT_FALSE(tau_arena_owns(arena, mem2));
+  TEST_ASSERT_PTR_EQUAL(tau_arena_alloc(arena, 16), mem2);
+
+  tau_arena_free(arena);
+}
+
+TEST_CASE(tau_arena_reset)
+{
+  tau_arena_t* arena = tau_arena_init_with_capacity(1024);
+
+  for (size_t i = 0; i < 1000; i++)
+    tau_arena_alloc(arena, 64);
+
+  tau_arena_alloc(arena, 4096);
+
+  tau_arena_reset(arena);
+
+  tau_arena_stats_t stats = tau_arena_stats(arena);
+
+  TEST_ASSERT_EQUAL(stats.chunk_count, 1);
+  TEST_ASSERT_EQUAL(stats.used, 0);
+  TEST_ASSERT_TRUE(stats.reserved >= 1024);
+
+  TEST_ASSERT_NOT_NULL(tau_arena_alloc(arena, 64));
+  TEST_ASSERT_EQUAL(tau_arena_stats(arena).chunk_count, 1);
+
+  tau_arena_free(arena);
+}
+
 TEST_MAIN()
 {
   TEST_RUN(tau_arena_init);
   TEST_RUN(tau_arena_init_with_capacity);
   TEST_RUN(tau_arena_alloc);
+  TEST_RUN(tau_arena_alloc_large);
+  TEST_RUN(tau_arena_alloc_aligned);
+  TEST_RUN(tau_arena_alloc_growth);
   TEST_RUN(tau_arena_alloc_extend);
   TEST_RUN(tau_arena_capacity_alloc_extend);
+  TEST_RUN(tau_arena_merge);
+  TEST_RUN(tau_arena_rollback);
+  TEST_RUN(tau_arena_reset);
 }
@@ -0,0 +1,148 @@
+/**
+ * \file
+ *
+ * \brief Micro-benchmark harness.
+ *
+ * \details A companion of `test.h` for timing code. A benchmark case is a test
+ * case with a single `BENCH_LOOP` measuring its body. The loop first runs a few
+ * warm-up samples, which are discarded, then a fixed number of measured
+ * samples. Every sample runs the body the given number of times, and the case
+ * reports the median and 99th percentile time per operation over all samples.
+ * Benchmark cases are run with `TEST_RUN` from `TEST_MAIN` and may use the test
+ * assertions to check their results. Unit tests do not time code, every
+ * measurement lives in a `*_bench.c` file using this harness.
+ *
+ * Debug builds route every allocation through the memory tracer, so numbers
+ * are only representative in release builds.
+ *
+ * \copyright Copyright (c) 2023 Róna Balázs. All rights reserved.
+ * \license This project is released under the Apache 2.0 license.
+ */
+
+#ifndef TAU_BENCH_H
+#define TAU_BENCH_H
+
+#include "test.h"
+
+#include <stdint.h>
+
+#include "utils/compiler_detect.h"
+#include "utils/timer.h"
+
+/// The number of discarded warm-up samples of a benchmark case.
+#define BENCH_WARMUP_COUNT ((size_t)5)
+
+/// The number of measured samples of a benchmark case.
+#define BENCH_SAMPLE_COUNT ((size_t)50)
+
+#define BENCH_CASE(BENCH_NAME)\
+  void bench_case_##BENCH_NAME##_impl(void);\
+  void test_case_##BENCH_NAME(void)\
+  {\
+    printf(TAU_ESC_FG_BRIGHT_BLACK "[" #BENCH_NAME "]" TAU_ESC_RESET "\n");\
+    g_test_case_status = TEST_STATUS_PASSED;\
+    g_bench_sample_idx = 0;\
+    g_bench_iterations = 0;\
+    bench_case_##BENCH_NAME##_impl();\
+    switch (g_test_case_status) {\
+    case TEST_STATUS_PASSED: bench_report(); printf(TAU_ESC_FG_GREEN "PASSED" TAU_ESC_RESET "\n"); break;\
+    case TEST_STATUS_IGNORED: printf(TAU_ESC_FG_YELLOW "IGNORED" TAU_ESC_RESET "\n"); break;\
+    case TEST_STATUS_FAILED: fprintf(stderr, TAU_ESC_FG_RED "FAILED" TAU_ESC_RESET "\n"); break;\
+    default: break;\
+    }\
+  }\
+  void bench_case_##BENCH_NAME##_impl(void)
+
+/**
+ * \brief Measures the statement following it.
+ *
+ * \details Every sample runs the statement `ITERATIONS` times. Only the loop is
+ * timed, so setup and cleanup code around it is free.
+ *
+ * \param[in] ITERATIONS The number of operations per sample.
+ */
+#define BENCH_LOOP(ITERATIONS)\
+  for (bench_begin((size_t)(ITERATIONS)); bench_next(); )\
+    for (size_t bench_iteration = 0; bench_iteration < g_bench_iterations; bench_iteration++)
+
+/**
+ * \brief Keeps the compiler from optimizing away the computation of a scalar
+ * value.
+ *
+ * \param[in] VALUE The integer or pointer value to be kept.
+ */
+#if TAU_COMPILER_MSVC
+# define BENCH_DO_NOT_OPTIMIZE(VALUE)\
+  do {\
+    g_bench_sink = (uintptr_t)(VALUE);\
+  } while (0)
+#else
+# define BENCH_DO_NOT_OPTIMIZE(VALUE)\
+  do {\
+    __asm__ volatile("" : : "r"(VALUE) : "memory");\
+  } while (0)
+#endif
+
+static size_t g_bench_iterations = 0;
+static size_t g_bench_sample_idx = 0;
+static bool g_bench_is_sampling = false;
+static uint64_t g_bench_sample_begin = 0;
+static uint64_t g_bench_samples[BENCH_WARMUP_COUNT + BENCH_SAMPLE_COUNT];
+
+#if TAU_COMPILER_MSVC
+static volatile uintptr_t g_bench_sink = 0;
+#endif
+
+static inline void bench_begin(size_t iterations)
+{
+  g_bench_iterations = iterations;
+  g_bench_sample_idx = 0;
+  g_bench_is_sampling = false;
+}
+
+static inline bool bench_next(void)
+{
+  uint64_t now = tau_timer_now();
+
+  if (g_bench_is_sampling)
+    g_bench_samples[g_bench_sample_idx++] = now - g_bench_sample_begin;
+
+  g_bench_is_sampling = g_bench_sample_idx < BENCH_WARMUP_COUNT + BENCH_SAMPLE_COUNT;
+
+  if (!g_bench_is_sampling)
+    return false;
+
+  g_bench_sample_begin = tau_timer_now();
+
+  return true;
+}
+
+static int bench_sample_cmp(const void* lhs, const void* rhs)
+{
+  uint64_t lhs_sample = *(const uint64_t*)lhs;
+  uint64_t rhs_sample = *(const uint64_t*)rhs;
+
+  return lhs_sample < rhs_sample ? -1 : (lhs_sample > rhs_sample ? 1 : 0);
+}
+
+/**
+ * \brief Prints the median and 99th percentile time per operation of the
+ * measured samples.
+ */
+static void bench_report(void)
+{
+  if (g_bench_sample_idx < BENCH_WARMUP_COUNT + BENCH_SAMPLE_COUNT || g_bench_iterations == 0)
+    return;
+
+  uint64_t* samples = g_bench_samples + BENCH_WARMUP_COUNT;
+
+  qsort(samples, BENCH_SAMPLE_COUNT, sizeof(uint64_t), bench_sample_cmp);
+
+  double ns_per_tick = 1e9 / (double)tau_timer_freq() / (double)g_bench_iterations;
+  double median = (double)samples[BENCH_SAMPLE_COUNT / 2] * ns_per_tick;
+  double p99 = (double)samples[(BENCH_SAMPLE_COUNT * 99 + 99) / 100 - 1] * ns_per_tick;
+
+  printf(TAU_ESC_FG_BRIGHT_BLACK "median %.2f ns/op, p99 %.2f ns/op (%zu samples of %zu ops)" TAU_ESC_RESET "\n", median, p99, BENCH_SAMPLE_COUNT, g_bench_iterations);
+}
+
+#endif
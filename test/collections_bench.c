@@ -0,0 +1,156 @@
+#include "bench.h"
+
+#include "utils/collections/list.h"
+#include "utils/collections/queue.h"
+#include "utils/collections/set.h"
+#include "utils/collections/stack.h"
+#include "utils/collections/vector.h"
+
+/// The number of elements of the collections.
+#define COLLECTIONS_BENCH_COUNT ((size_t)1000)
+
+static int collections_bench_cmp(const void* lhs, const void* rhs)
+{
+  uintptr_t lhs_value = (uintptr_t)lhs;
+  uintptr_t rhs_value = (uintptr_t)rhs;
+
+  return lhs_value < rhs_value ? -1 : (lhs_value > rhs_value ? 1 : 0);
+}
+
+/**
+ * \brief Returns the i-th element of a pseudo-random permutation of
+ * `[0, COLLECTIONS_BENCH_COUNT)`.
+ */
+static size_t collections_bench_idx(size_t i)
+{
+  // 613 is coprime with the element count.
+  return i * 613 % COLLECTIONS_BENCH_COUNT;
+}
+
+/**
+ * \brief Returns a distinct non-null key for every index.
+ */
+static void* collections_bench_key(size_t idx)
+{
+  return (void*)(uintptr_t)(idx + 1);
+}
+
+BENCH_CASE(tau_vector_push)
+{
+  tau_vector_t* vec = tau_vector_init();
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    tau_vector_push(vec, collections_bench_key(bench_iteration));
+  }
+
+  tau_vector_free(vec);
+}
+
+BENCH_CASE(tau_vector_get)
+{
+  tau_vector_t* vec = tau_vector_init();
+
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_vector_push(vec, collections_bench_key(i));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_vector_get(vec, collections_bench_idx(bench_iteration)));
+  }
+
+  tau_vector_free(vec);
+}
+
+BENCH_CASE(tau_list_push_back_pop_front)
+{
+  tau_list_t* list = tau_list_init();
+
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_list_push_back(list, collections_bench_key(i));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    tau_list_push_back(list, tau_list_pop_front(list));
+  }
+
+  tau_list_free(list);
+}
+
+BENCH_CASE(tau_queue_offer_poll)
+{
+  tau_queue_t* que = tau_queue_init();
+
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_queue_offer(que, collections_bench_key(i));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    tau_queue_offer(que, tau_queue_poll(que));
+  }
+
+  tau_queue_free(que);
+}
+
+BENCH_CASE(tau_stack_push_pop)
+{
+  tau_stack_t* stack = tau_stack_init();
+
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_stack_push(stack, collections_bench_key(i));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    tau_stack_push(stack, collections_bench_key(bench_iteration));
+    BENCH_DO_NOT_OPTIMIZE(tau_stack_pop(stack));
+  }
+
+  tau_stack_free(stack);
+}
+
+BENCH_CASE(tau_set_add_remove)
+{
+  tau_set_t* set = tau_set_init(collections_bench_cmp);
+
+  // Even keys stay in the set, odd keys are added and removed.
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_set_add(set, collections_bench_key(collections_bench_idx(i) * 2 + 1));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    void* key = collections_bench_key(collections_bench_idx(bench_iteration) * 2);
+
+    tau_set_add(set, key);
+    tau_set_remove(set, key);
+  }
+
+  TEST_ASSERT_EQUAL(tau_set_size(set), COLLECTIONS_BENCH_COUNT);
+
+  tau_set_free(set);
+}
+
+BENCH_CASE(tau_set_contains)
+{
+  tau_set_t* set = tau_set_init(collections_bench_cmp);
+
+  for (size_t i = 0; i < COLLECTIONS_BENCH_COUNT; i++)
+    tau_set_add(set, collections_bench_key(collections_bench_idx(i)));
+
+  BENCH_LOOP(COLLECTIONS_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_set_contains(set, collections_bench_key(bench_iteration)));
+  }
+
+  tau_set_free(set);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_vector_push);
+  TEST_RUN(tau_vector_get);
+  TEST_RUN(tau_list_push_back_pop_front);
+  TEST_RUN(tau_queue_offer_poll);
+  TEST_RUN(tau_stack_push_pop);
+  TEST_RUN(tau_set_add_remove);
+  TEST_RUN(tau_set_contains);
+}
@@ -0,0 +1,146 @@
+#include "test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "compiler/compiler.h"
+#include "utils/io/file.h"
+#include "utils/io/path.h"
+
+/// The directory of the compilation cache.
+#define COMPILER_CACHE_TEST_DIR "compiler_cache_test"
+
+/**
+ * \brief Writes an input file defining a few simple functions.
+ */
+static bool write_source(const char* path)
+{
+  FILE* file = fopen(path, "wb");
+
+  if (file == NULL)
+    return false;
+
+  for (int i = 0; i < 4; i++)
+    fprintf(file, "fun func%d(a: i32, b: i32): i32 {\n  return a + b * %d\n}\n\n", i, i);
+
+  fclose(file);
+
+  return true;
+}
+
+/**
+ * \brief Checks whether a file contains a string.
+ */
+static bool file_contains(const char* path, const char* str)
+{
+  tau_path_t* file_path = tau_path_init_with_cstr(path);
+  tau_file_view_t* view = tau_file_view_open(file_path);
+  tau_path_free(file_path);
+
+  if (view == NULL)
+    return false;
+
+  size_t len = strlen(str);
+  const char* data = tau_file_view_data(view);
+  size_t size = tau_file_view_size(view);
+  bool is_found = false;
+
+  for (size_t i = 0; !is_found && i + len <= size; i++)
+    is_found = memcmp(data + i, str, len) == 0;
+
+  tau_file_view_close(view);
+
+  return is_found;
+}
+
+/**
+ * \brief Removes a directory along with the files in it.
+ */
+static void remove_directory(const char* path)
+{
+  tau_path_t* dir_path = tau_path_init_with_cstr(path);
+  tau_vector_t* entries = tau_file_list_directory(dir_path);
+
+  if (entries != NULL)
+  {
+    TAU_VECTOR_FOR_LOOP(i, entries)
+    {
+      tau_path_t* entry_path = (tau_path_t*)tau_vector_get(entries, i);
+      tau_file_remove(entry_path);
+      tau_path_free(entry_path);
+    }
+
+    tau_vector_free(entries);
+  }
+
+  tau_path_free(dir_path);
+
+  remove(path);
+}
+
+/**
+ * \brief Checks whether a file exists and removes it.
+ */
+static bool take_file(const char* path)
+{
+  tau_path_t* file_path = tau_path_init_with_cstr(path);
+  bool is_found = tau_file_exists(file_path);
+
+  if (is_found)
+    tau_file_remove(file_path);
+
+  tau_path_free(file_path);
+
+  return is_found;
+}
+
+TEST_CASE(identical_files_with_different_paths)
+{
+  TEST_ASSERT(write_source("compiler_cache_a.tau"));
+  TEST_ASSERT(write_source("compiler_cache_b.tau"));
+
+  // Without a job count the files are compiled in order. The second file would
+  // be restored from the entry of the first one if the path was not part of
+  // the key, and the third one is restored with fewer partitions than
+  // requested, since the files only define four functions.
+  const char* argv[] = {
+    "tauc", "--cache-dir", COMPILER_CACHE_TEST_DIR, "--dump-tokens", "--split-module", "8",
+    "compiler_cache_a.tau", "compiler_cache_b.tau", "compiler_cache_a.tau"
+  };
+
+  tau_compiler_t* compiler = tau_compiler_init();
+  int result = tau_compiler_main(compiler, (int)TAU_COUNTOF(argv), argv);
+  tau_compiler_free(compiler);
+
+  TEST_ASSERT_EQUAL(result, EXIT_SUCCESS);
+
+  TEST_ASSERT(file_contains("compiler_cache_b.tokens.json", "\"path\":\"compiler_cache_b.tau\""));
+  TEST_ASSERT_FALSE(file_contains("compiler_cache_b.tokens.json", "\"path\":\"compiler_cache_a.tau\""));
+
+  // Hits, misses, stores and evictions.
+  TEST_ASSERT(file_contains(COMPILER_CACHE_TEST_DIR "/stats", "1 2 2 0"));
+
+  TEST_ASSERT(take_file("compiler_cache_a.tokens.json"));
+  TEST_ASSERT(take_file("compiler_cache_b.tokens.json"));
+
+  for (int i = 0; i < 8; i++)
+  {
+    char obj_path[48];
+
+    snprintf(obj_path, sizeof(obj_path), "compiler_cache_a.%d.obj", i);
+    TEST_ASSERT(take_file(obj_path) == (i < 4));
+
+    snprintf(obj_path, sizeof(obj_path), "compiler_cache_b.%d.obj", i);
+    TEST_ASSERT(take_file(obj_path) == (i < 4));
+  }
+
+  remove("compiler_cache_a.tau");
+  remove("compiler_cache_b.tau");
+
+  remove_directory(COMPILER_CACHE_TEST_DIR);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(identical_files_with_different_paths);
+}
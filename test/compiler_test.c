@@ -0,0 +1,88 @@
+#include "test.h"
+
+#include <stdio.h>
+
+#include "compiler/compiler.h"
+#include "utils/io/file.h"
+#include "utils/io/path.h"
+
+/// The number of generated input files.
+#define COMPILER_TEST_FILE_COUNT 8
+
+/// The number of functions per generated input file.
+#define COMPILER_TEST_FUNCTION_COUNT 64
+
+/// The number of partitions of every module.
+#define COMPILER_TEST_PARTITION_COUNT 4
+
+/**
+ * \brief Writes an input file defining a run of simple functions.
+ */
+static bool write_source(const char* path)
+{
+  FILE* file = fopen(path, "wb");
+
+  if (file == NULL)
+    return false;
+
+  for (int i = 0; i < COMPILER_TEST_FUNCTION_COUNT; i++)
+    fprintf(file, "fun func%d(a: i32, b: i32): i32 {\n  return a + b * %d - a / 3\n}\n\n", i, i);
+
+  fclose(file);
+
+  return true;
+}
+
+/**
+ * \brief Checks whether a file exists and removes it.
+ */
+static bool take_file(const char* path)
+{
+  tau_path_t* file_path = tau_path_init_with_cstr(path);
+  bool is_found = tau_file_exists(file_path);
+
+  if (is_found)
+    tau_file_remove(file_path);
+
+  tau_path_free(file_path);
+
+  return is_found;
+}
+
+TEST_CASE(split_module_with_more_files_than_threads)
+{
+  char paths[COMPILER_TEST_FILE_COUNT][32];
+  const char* argv[5 + COMPILER_TEST_FILE_COUNT] = { "tauc", "-j", "3", "--split-module", "4" };
+
+  for (int i = 0; i < COMPILER_TEST_FILE_COUNT; i++)
+  {
+    snprintf(paths[i], sizeof(paths[i]), "compiler_test_%d.tau", i);
+    TEST_ASSERT(write_source(paths[i]));
+    argv[5 + i] = paths[i];
+  }
+
+  // Partitions of one file must not run other files on a thread that is
+  // still compiling a file.
+  tau_compiler_t* compiler = tau_compiler_init();
+  int result = tau_compiler_main(compiler, (int)TAU_COUNTOF(argv), argv);
+  tau_compiler_free(compiler);
+
+  TEST_ASSERT_EQUAL(result, EXIT_SUCCESS);
+
+  for (int i = 0; i < COMPILER_TEST_FILE_COUNT; i++)
+  {
+    for (int j = 0; j < COMPILER_TEST_PARTITION_COUNT; j++)
+    {
+      char obj_path[48];
+      snprintf(obj_path, sizeof(obj_path), "compiler_test_%d.%d.obj", i, j);
+      TEST_ASSERT(take_file(obj_path));
+    }
+
+    remove(paths[i]);
+  }
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(split_module_with_more_files_than_threads);
+}
@@ -0,0 +1,165 @@
+#include "test.h"
+
+#include <stdint.h>
+
+#include "utils/io/file.h"
+
+#define FILE_TEST_PATH "file_test.tmp"
+
+/**
+ * \brief Writes a file of the given size with a repeating pattern.
+ */
+static void file_test_write(size_t size)
+{
+  FILE* file = fopen(FILE_TEST_PATH, "wb");
+
+  for (size_t i = 0; i < size; i++)
+    fputc('a' + (int)(i % 26), file);
+
+  fclose(file);
+}
+
+TEST_CASE(tau_file_view_open)
+{
+  static const size_t sizes[] = { 0, 1, 100, 4095, 4096, 4097, 4096 - TAU_FILE_VIEW_PADDING, 65536 + 7 };
+
+  tau_path_t* path = tau_path_init_with_cstr(FILE_TEST_PATH);
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    file_test_write(sizes[i]);
+
+    tau_file_view_t* view = tau_file_view_open(path);
+
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL(tau_file_view_size(view), sizes[i]);
+
+    const char* data = tau_file_view_data(view);
+
+    for (size_t j = 0; j < sizes[i]; j++)
+      TEST_ASSERT_EQUAL(data[j], 'a' + (int)(j % 26));
+
+    for (size_t j = 0; j < TAU_FILE_VIEW_PADDING; j++)
+      TEST_ASSERT_EQUAL(data[sizes[i] + j], '\0');
+
+    tau_file_view_close(view);
+  }
+
+  remove(FILE_TEST_PATH);
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_file_view_open_missing)
+{
+  tau_path_t* path = tau_path_init_with_cstr("file_test_missing.tmp");
+
+  TEST_ASSERT_NULL(tau_file_view_open(path));
+
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_file_read)
+{
+  file_test_write(100);
+
+  tau_path_t* path = tau_path_init_with_cstr(FILE_TEST_PATH);
+
+  TEST_ASSERT_EQUAL(tau_file_read(path, NULL, 0), 100);
+
+  char buf[64];
+
+  TEST_ASSERT_EQUAL(tau_file_read(path, buf, sizeof(buf)), sizeof(buf) - 1);
+  TEST_ASSERT_EQUAL(buf[sizeof(buf) - 1], '\0');
+
+  remove(FILE_TEST_PATH);
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_file_rename)
+{
+  file_test_write(10);
+
+  tau_path_t* from = tau_path_init_with_cstr(FILE_TEST_PATH);
+  tau_path_t* to = tau_path_init_with_cstr("file_test_renamed.tmp");
+
+  TEST_ASSERT(tau_file_rename(from, to));
+  TEST_ASSERT_FALSE(tau_file_exists(from));
+  TEST_ASSERT_EQUAL(tau_file_size(to), 10);
+
+  file_test_write(20);
+
+  // Renaming over an existing file replaces it.
+  TEST_ASSERT(tau_file_rename(from, to));
+  TEST_ASSERT_EQUAL(tau_file_size(to), 20);
+
+  TEST_ASSERT(tau_file_remove(to));
+  TEST_ASSERT_FALSE(tau_file_exists(to));
+  TEST_ASSERT_FALSE(tau_file_remove(to));
+
+  tau_path_free(to);
+  tau_path_free(from);
+}
+
+TEST_CASE(tau_file_touch)
+{
+  file_test_write(10);
+
+  tau_path_t* path = tau_path_init_with_cstr(FILE_TEST_PATH);
+
+  uint64_t time = tau_file_modification_time(path);
+
+  TEST_ASSERT(time != 0);
+  TEST_ASSERT(tau_file_touch(path));
+  TEST_ASSERT(tau_file_modification_time(path) >= time);
+
+  remove(FILE_TEST_PATH);
+
+  TEST_ASSERT_EQUAL(tau_file_modification_time(path), 0);
+  TEST_ASSERT_FALSE(tau_file_touch(path));
+
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_file_create_directory)
+{
+  tau_path_t* root = tau_path_init_with_cstr("file_test_dir.tmp");
+  tau_path_t* dir = tau_path_join_cstr(root, "a");
+  tau_path_t* nested = tau_path_join_cstr(dir, "b");
+
+  TEST_ASSERT(tau_file_create_directory(nested));
+  TEST_ASSERT(tau_file_is_directory(nested));
+  TEST_ASSERT(tau_file_create_directory(nested));
+
+  tau_vector_t* entries = tau_file_list_directory(dir);
+
+  TEST_ASSERT_NOT_NULL(entries);
+  TEST_ASSERT_EQUAL(tau_vector_size(entries), 1);
+  TEST_ASSERT_EQUAL(tau_path_compare((tau_path_t*)tau_vector_get(entries, 0), nested), 0);
+
+  tau_path_free((tau_path_t*)tau_vector_get(entries, 0));
+  tau_vector_free(entries);
+
+  tau_path_t* missing = tau_path_join_cstr(nested, "missing");
+
+  TEST_ASSERT_NULL(tau_file_list_directory(missing));
+
+  tau_path_free(missing);
+
+  remove("file_test_dir.tmp/a/b");
+  remove("file_test_dir.tmp/a");
+  remove("file_test_dir.tmp");
+
+  tau_path_free(nested);
+  tau_path_free(dir);
+  tau_path_free(root);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_file_view_open);
+  TEST_RUN(tau_file_view_open_missing);
+  TEST_RUN(tau_file_read);
+  TEST_RUN(tau_file_rename);
+  TEST_RUN(tau_file_touch);
+  TEST_RUN(tau_file_create_directory);
+}
@@ -0,0 +1,60 @@
+#include "bench.h"
+
+#include "utils/hash.h"
+
+/// The size of the hashed buffer.
+#define HASH_BENCH_BUFFER_SIZE ((size_t)4096)
+
+static unsigned char g_hash_bench_buffer[HASH_BENCH_BUFFER_SIZE];
+
+static void hash_bench_fill(void)
+{
+  for (size_t i = 0; i < HASH_BENCH_BUFFER_SIZE; i++)
+    g_hash_bench_buffer[i] = (unsigned char)(i * 131 + 7);
+}
+
+BENCH_CASE(tau_hash_digest_8)
+{
+  BENCH_LOOP(10000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_hash_digest(g_hash_bench_buffer + bench_iteration % 64, 8));
+  }
+}
+
+BENCH_CASE(tau_hash_digest_32)
+{
+  BENCH_LOOP(10000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_hash_digest(g_hash_bench_buffer + bench_iteration % 64, 32));
+  }
+}
+
+BENCH_CASE(tau_hash_digest_1024)
+{
+  BENCH_LOOP(1000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_hash_digest(g_hash_bench_buffer + bench_iteration % 64, 1024));
+  }
+}
+
+BENCH_CASE(tau_hash_combine_with_hash)
+{
+  uint64_t seed = 0;
+
+  BENCH_LOOP(10000)
+  {
+    seed = tau_hash_combine_with_hash(seed, (uint64_t)bench_iteration);
+  }
+
+  BENCH_DO_NOT_OPTIMIZE(seed);
+}
+
+TEST_MAIN()
+{
+  hash_bench_fill();
+
+  TEST_RUN(tau_hash_digest_8);
+  TEST_RUN(tau_hash_digest_32);
+  TEST_RUN(tau_hash_digest_1024);
+  TEST_RUN(tau_hash_combine_with_hash);
+}
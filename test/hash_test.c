@@ -6,29 +6,88 @@ TEST_CASE(tau_hash_secret)
 {
   uint64_t digest = tau_hash_digest("secret", 6);
 
-  TEST_ASSERT_EQUAL(digest, 0xAB23F0EEC020C951ULL);
+  TEST_ASSERT_EQUAL(digest, 0x20A784E72A425269ULL);
 }
 
 TEST_CASE(tau_hash_password)
 {
   uint64_t digest = tau_hash_digest("password", 8);
 
-  TEST_ASSERT_EQUAL(digest, 0x4B1A493507B3A318ULL);
+  TEST_ASSERT_EQUAL(digest, 0x134ABA441968B237ULL);
 }
 
 TEST_CASE(tau_hash_quick_brown_fox)
 {
   uint64_t digest = tau_hash_digest("The quick brown fox jumps over the lazy dog", 43);
 
+  TEST_ASSERT_EQUAL(digest, 0x08E445DF107BB587ULL);
+}
+
+TEST_CASE(tau_hash_lengths)
+{
+  unsigned char data[128] = { 0 };
+  uint64_t digests[129];
+
+  // Every code path of the digest, with inputs that differ only in length.
+  for (size_t i = 0; i <= 128; i++)
+  {
+    digests[i] = tau_hash_digest(data, i);
+
+    for (size_t j = 0; j < i; j++)
+      TEST_ASSERT_NOT_EQUAL(digests[i], digests[j]);
+  }
+}
+
+TEST_CASE(tau_hash_fnv1a_secret)
+{
+  uint64_t digest = tau_hash_fnv1a("secret", 6);
+
+  TEST_ASSERT_EQUAL(digest, 0xAB23F0EEC020C951ULL);
+}
+
+TEST_CASE(tau_hash_fnv1a_password)
+{
+  uint64_t digest = tau_hash_fnv1a("password", 8);
+
+  TEST_ASSERT_EQUAL(digest, 0x4B1A493507B3A318ULL);
+}
+
+TEST_CASE(tau_hash_fnv1a_quick_brown_fox)
+{
+  uint64_t digest = tau_hash_fnv1a("The quick brown fox jumps over the lazy dog", 43);
+
   TEST_ASSERT_EQUAL(digest, 0xF3F9B7F5E7E47110ULL);
 }
 
+TEST_CASE(tau_hash_u64)
+{
+  TEST_ASSERT_EQUAL(tau_hash_u64(0), 0x7FD86127CC315DE1ULL);
+  TEST_ASSERT_EQUAL(tau_hash_u64(1), 0x61AAECE890D7E6BCULL);
+
+  // Aligned keys still fill every bucket of a small table.
+  size_t counts[16] = { 0 };
+
+  for (uint64_t i = 0; i < 1600; i++)
+    counts[tau_hash_u64(i * 64) & 15]++;
+
+  for (size_t i = 0; i < 16; i++)
+    TEST_ASSERT(counts[i] > 50 && counts[i] < 150);
+}
+
+TEST_CASE(tau_hash_ptr)
+{
+  int data[2] = { 0 };
+
+  TEST_ASSERT_EQUAL(tau_hash_ptr(&data[0]), tau_hash_u64((uint64_t)(uintptr_t)&data[0]));
+  TEST_ASSERT_NOT_EQUAL(tau_hash_ptr(&data[0]), tau_hash_ptr(&data[1]));
+}
+
 TEST_CASE(tau_hash_combine_with_data)
 {
   uint64_t seed = tau_hash_digest("secret", 6);
   uint64_t combined = tau_hash_combine_with_data(seed, "password", 8);
 
-  TEST_ASSERT_EQUAL(combined, 0x95FC71CF9E056A34ULL);
+  TEST_ASSERT_EQUAL(combined, 0xF388985171063A9EULL);
 }
 
 TEST_CASE(tau_hash_combine_with_hash)
@@ -37,7 +96,16 @@ TEST_CASE(tau_hash_combine_with_hash)
   uint64_t hash = tau_hash_digest("password", 8);
   uint64_t combined = tau_hash_combine_with_hash(seed, hash);
 
-  TEST_ASSERT_EQUAL(combined, 0x95FC71CF9E056A34ULL);
+  TEST_ASSERT_EQUAL(combined, 0xF388985171063A9EULL);
+}
+
+TEST_CASE(tau_hash_combine_with_hash_order)
+{
+  uint64_t lhs = tau_hash_u64(1);
+  uint64_t rhs = tau_hash_u64(2);
+
+  TEST_ASSERT_NOT_EQUAL(tau_hash_combine_with_hash(lhs, rhs), tau_hash_combine_with_hash(rhs, lhs));
+  TEST_ASSERT_NOT_EQUAL(tau_hash_combine_with_hash(0, 0), 0);
 }
 
 TEST_MAIN()
@@ -45,6 +113,13 @@ TEST_MAIN()
   TEST_RUN(tau_hash_secret);
   TEST_RUN(tau_hash_password);
   TEST_RUN(tau_hash_quick_brown_fox);
+  TEST_RUN(tau_hash_lengths);
+  TEST_RUN(tau_hash_fnv1a_secret);
+  TEST_RUN(tau_hash_fnv1a_password);
+  TEST_RUN(tau_hash_fnv1a_quick_brown_fox);
+  TEST_RUN(tau_hash_u64);
+  TEST_RUN(tau_hash_ptr);
   TEST_RUN(tau_hash_combine_with_data);
   TEST_RUN(tau_hash_combine_with_hash);
+  TEST_RUN(tau_hash_combine_with_hash_order);
 }
@@ -0,0 +1,158 @@
+#include "test.h"
+
+#include "utils/hash.h"
+#include "utils/collections/hashmap.h"
+
+bool match_int(const void* value, const void* key)
+{
+  return *(const int*)value == *(const int*)key;
+}
+
+void iter_increment(void* data)
+{
+  ++*(int*)data;
+}
+
+/**
+ * \brief Inserts a value keyed by itself unless its key is present.
+ */
+static bool hashmap_test_add(tau_hashmap_t* map, uint64_t hash, int* value)
+{
+  tau_hashmap_entry_t* entry = tau_hashmap_find(map, hash, match_int, value);
+
+  if (entry->value != NULL)
+    return false;
+
+  tau_hashmap_insert(map, entry, value);
+
+  return true;
+}
+
+TEST_CASE(tau_hashmap_init)
+{
+  tau_hashmap_t* map = tau_hashmap_init();
+
+  TEST_ASSERT_NOT_NULL(map);
+  TEST_ASSERT_EQUAL(tau_hashmap_size(map), 0);
+
+  tau_hashmap_free(map);
+}
+
+TEST_CASE(tau_hashmap_insert)
+{
+  int data1 = 1, data2 = 2, data3 = 3;
+
+  tau_hashmap_t* map = tau_hashmap_init();
+
+  TEST_ASSERT_TRUE(hashmap_test_add(map, tau_hash_u64(1), &data1));
+  TEST_ASSERT_TRUE(hashmap_test_add(map, tau_hash_u64(2), &data2));
+  TEST_ASSERT_TRUE(hashmap_test_add(map, tau_hash_u64(3), &data3));
+  TEST_ASSERT_FALSE(hashmap_test_add(map, tau_hash_u64(1), &data1));
+  TEST_ASSERT_EQUAL(tau_hashmap_size(map), 3);
+
+  int key = 2;
+
+  TEST_ASSERT_PTR_EQUAL(tau_hashmap_get(map, tau_hash_u64(2), match_int, &key), &data2);
+  TEST_ASSERT_PTR_EQUAL(tau_hashmap_find(map, tau_hash_u64(2), match_int, &key)->value, &data2);
+
+  key = 4;
+
+  TEST_ASSERT_NULL(tau_hashmap_get(map, tau_hash_u64(4), match_int, &key));
+  TEST_ASSERT_NULL(tau_hashmap_find(map, tau_hash_u64(4), match_int, &key)->value);
+
+  tau_hashmap_free(map);
+}
+
+TEST_CASE(tau_hashmap_expand)
+{
+  int data[1000];
+
+  tau_hashmap_t* map = tau_hashmap_init_with_capacity(4);
+
+  for (int i = 0; i < 1000; i++)
+  {
+    data[i] = i;
+    TEST_ASSERT_TRUE(hashmap_test_add(map, tau_hash_u64((uint64_t)i), &data[i]));
+  }
+
+  TEST_ASSERT_EQUAL(tau_hashmap_size(map), 1000);
+
+  for (int i = 0; i < 1000; i++)
+    TEST_ASSERT_PTR_EQUAL(tau_hashmap_get(map, tau_hash_u64((uint64_t)i), match_int, &i), &data[i]);
+
+  tau_hashmap_free(map);
+}
+
+TEST_CASE(tau_hashmap_same_hash)
+{
+  int data1 = 1, data2 = 2;
+
+  tau_hashmap_t* map = tau_hashmap_init();
+
+  // Values with equal hashes are told apart by the match function.
+  TEST_ASSERT_TRUE(hashmap_test_add(map, 42, &data1));
+  TEST_ASSERT_TRUE(hashmap_test_add(map, 42, &data2));
+
+  TEST_ASSERT_PTR_EQUAL(tau_hashmap_get(map, 42, match_int, &data1), &data1);
+  TEST_ASSERT_PTR_EQUAL(tau_hashmap_get(map, 42, match_int, &data2), &data2);
+
+  tau_hashmap_free(map);
+}
+
+TEST_CASE(tau_hashmap_remove)
+{
+  int data[64];
+
+  tau_hashmap_t* map = tau_hashmap_init_with_capacity(64);
+
+  // Hashes sharing their low bits form a single probe sequence, which has to
+  // be repaired by every removal.
+  for (int i = 0; i < 64; i++)
+  {
+    data[i] = i;
+    TEST_ASSERT_TRUE(hashmap_test_add(map, (uint64_t)(i % 4) << 32, &data[i]));
+  }
+
+  for (int i = 0; i < 64; i += 2)
+    TEST_ASSERT_PTR_EQUAL(tau_hashmap_remove(map, (uint64_t)(i % 4) << 32, match_int, &i), &data[i]);
+
+  TEST_ASSERT_EQUAL(tau_hashmap_size(map), 32);
+
+  for (int i = 0; i < 64; i++)
+    TEST_ASSERT_PTR_EQUAL(tau_hashmap_get(map, (uint64_t)(i % 4) << 32, match_int, &i), i % 2 == 0 ? NULL : &data[i]);
+
+  int key = 0;
+
+  TEST_ASSERT_NULL(tau_hashmap_remove(map, 0, match_int, &key));
+
+  tau_hashmap_free(map);
+}
+
+TEST_CASE(tau_hashmap_for_each)
+{
+  int data1 = 1, data2 = 2, data3 = 3;
+
+  tau_hashmap_t* map = tau_hashmap_init();
+
+  hashmap_test_add(map, tau_hash_u64(1), &data1);
+  hashmap_test_add(map, tau_hash_u64(2), &data2);
+  hashmap_test_add(map, tau_hash_u64(3), &data3);
+
+  tau_hashmap_for_each(map, iter_increment);
+
+  TEST_ASSERT_EQUAL(data1, 2);
+  TEST_ASSERT_EQUAL(data2, 3);
+  TEST_ASSERT_EQUAL(data3, 4);
+
+  tau_hashmap_free(map);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_hashmap_init);
+  TEST_RUN(tau_hashmap_insert);
+  TEST_RUN(tau_hashmap_expand);
+  TEST_RUN(tau_hashmap_same_hash);
+  TEST_RUN(tau_hashmap_remove);
+  TEST_RUN(tau_hashmap_for_each);
+}
@@ -0,0 +1,82 @@
+#include "test.h"
+
+#include <stdio.h>
+
+#include "utils/hash.h"
+#include "utils/interner.h"
+
+TEST_CASE(tau_interner_intern)
+{
+  uint32_t foo = tau_interner_intern("foo", 3);
+  uint32_t bar = tau_interner_intern("bar", 3);
+
+  TEST_ASSERT_TRUE(foo != TAU_INTERNER_NULL_ID);
+  TEST_ASSERT_TRUE(bar != TAU_INTERNER_NULL_ID);
+  TEST_ASSERT_TRUE(foo != bar);
+
+  TEST_ASSERT_EQUAL(tau_interner_intern("foobar", 3), foo);
+  TEST_ASSERT_EQUAL(tau_interner_intern("bar", 3), bar);
+  TEST_ASSERT_EQUAL(tau_interner_size(), 2);
+
+  tau_interner_free();
+}
+
+TEST_CASE(tau_interner_find)
+{
+  TEST_ASSERT_EQUAL(tau_interner_find("foo", 3), TAU_INTERNER_NULL_ID);
+
+  uint32_t foo = tau_interner_intern("foo", 3);
+
+  TEST_ASSERT_EQUAL(tau_interner_find("foo", 3), foo);
+  TEST_ASSERT_EQUAL(tau_interner_find("fo", 2), TAU_INTERNER_NULL_ID);
+  TEST_ASSERT_EQUAL(tau_interner_size(), 1);
+
+  tau_interner_free();
+}
+
+TEST_CASE(tau_interner_view)
+{
+  char buf[] = "identifier";
+
+  uint32_t id = tau_interner_intern(buf, sizeof(buf) - 1);
+
+  // Interned strings are copies.
+  buf[0] = 'X';
+
+  tau_string_view_t view = tau_interner_view(id);
+
+  TEST_ASSERT_EQUAL(tau_string_view_length(view), 10);
+  TEST_ASSERT_EQUAL(memcmp(tau_string_view_begin(view), "identifier", 10), 0);
+  TEST_ASSERT_EQUAL(tau_interner_hash(id), tau_hash_digest("identifier", 10));
+
+  tau_interner_free();
+}
+
+TEST_CASE(tau_interner_expand)
+{
+  char buf[16];
+  uint32_t ids[5000];
+
+  for (size_t i = 0; i < 5000; i++)
+    ids[i] = tau_interner_intern(buf, (size_t)snprintf(buf, sizeof(buf), "id%zu", i));
+
+  TEST_ASSERT_EQUAL(tau_interner_size(), 5000);
+
+  for (size_t i = 0; i < 5000; i++)
+  {
+    size_t len = (size_t)snprintf(buf, sizeof(buf), "id%zu", i);
+
+    TEST_ASSERT_EQUAL(tau_interner_find(buf, len), ids[i]);
+    TEST_ASSERT_EQUAL(tau_string_view_length(tau_interner_view(ids[i])), len);
+  }
+
+  tau_interner_free();
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_interner_intern);
+  TEST_RUN(tau_interner_find);
+  TEST_RUN(tau_interner_view);
+  TEST_RUN(tau_interner_expand);
+}
@@ -0,0 +1,77 @@
+#include "bench.h"
+
+#include "stages/lexer/lexer.h"
+#include "stages/lexer/token/registry.h"
+
+/// The number of lines of the generated sources.
+#define LEXER_BENCH_LINE_COUNT ((size_t)2000)
+
+/**
+ * \brief Creates a source string consisting of `lines` copies of a line.
+ */
+static char* lexer_bench_make_source(const char* line, size_t lines)
+{
+  size_t line_len = strlen(line);
+
+  char* src = (char*)malloc(lines * line_len + 1);
+
+  for (size_t i = 0; i < lines; i++)
+    memcpy(src + i * line_len, line, line_len);
+
+  src[lines * line_len] = '\0';
+
+  return src;
+}
+
+/**
+ * \brief Measures lexing a source string, where every operation lexes the
+ * whole source and releases its tokens.
+ */
+static void lexer_bench_lex(const char* name, const char* src)
+{
+  BENCH_LOOP(1)
+  {
+    tau_lexer_t* lex = tau_lexer_init();
+    tau_vector_t* toks = tau_vector_init();
+    tau_error_bag_t* errors = tau_error_bag_init(10);
+
+    tau_lexer_lex(lex, name, src, toks, errors);
+
+    TEST_ASSERT_FALSE(tau_error_bag_full(errors));
+
+    tau_error_bag_free(errors);
+    tau_vector_free(toks);
+    tau_lexer_free(lex);
+    tau_token_registry_free();
+  }
+}
+
+BENCH_CASE(tau_lexer_identifiers)
+{
+  char* src = lexer_bench_make_source(
+    "fun compute_value(alpha: i32, beta_value: vec3f32, mut gamma: mat4x4f32): usize "
+    "{ return alpha_beta + gamma_delta * epsilon_zeta - sizeof(eta_theta) }\n", LEXER_BENCH_LINE_COUNT);
+
+  lexer_bench_lex("identifiers", src);
+
+  free(src);
+}
+
+BENCH_CASE(tau_lexer_comments)
+{
+  char* src = lexer_bench_make_source(
+    "    // Line comments and indentation make up a large part of real sources.\n"
+    "    /* Block comments may span\n"
+    "       multiple lines. */\n"
+    "\t\t  x\n", LEXER_BENCH_LINE_COUNT);
+
+  lexer_bench_lex("comments", src);
+
+  free(src);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_lexer_identifiers);
+  TEST_RUN(tau_lexer_comments);
+}
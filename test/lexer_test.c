@@ -0,0 +1,199 @@
+#include "test.h"
+
+#include "stages/lexer/lexer.h"
+#include "stages/lexer/token/registry.h"
+
+/**
+ * \brief Lexes a source string and returns the kind of its first token.
+ */
+static tau_token_kind_t lexer_test_first_kind(const char* src)
+{
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "lexer_test.tau", src, toks, errors);
+
+  tau_token_kind_t kind = ((tau_token_t*)tau_vector_front(toks))->kind;
+
+  tau_error_bag_free(errors);
+  tau_vector_free(toks);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+
+  return kind;
+}
+
+TEST_CASE(tau_lexer_keywords)
+{
+  static const struct { const char* src; tau_token_kind_t kind; } cases[] = {
+    { "is",       TAU_TOK_KW_IS       }, { "as",       TAU_TOK_KW_AS       },
+    { "sizeof",   TAU_TOK_KW_SIZEOF   }, { "alignof",  TAU_TOK_KW_ALIGNOF  },
+    { "use",      TAU_TOK_KW_USE      }, { "in",       TAU_TOK_KW_IN       },
+    { "pub",      TAU_TOK_KW_PUB      }, { "extern",   TAU_TOK_KW_EXTERN   },
+    { "fun",      TAU_TOK_KW_FUN      }, { "struct",   TAU_TOK_KW_STRUCT   },
+    { "union",    TAU_TOK_KW_UNION    }, { "enum",     TAU_TOK_KW_ENUM     },
+    { "mod",      TAU_TOK_KW_MOD      }, { "if",       TAU_TOK_KW_IF       },
+    { "then",     TAU_TOK_KW_THEN     }, { "else",     TAU_TOK_KW_ELSE     },
+    { "for",      TAU_TOK_KW_FOR      }, { "while",    TAU_TOK_KW_WHILE    },
+    { "do",       TAU_TOK_KW_DO       }, { "loop",     TAU_TOK_KW_LOOP     },
+    { "break",    TAU_TOK_KW_BREAK    }, { "continue", TAU_TOK_KW_CONTINUE },
+    { "return",   TAU_TOK_KW_RETURN   }, { "defer",    TAU_TOK_KW_DEFER    },
+    { "mut",      TAU_TOK_KW_MUT      }, { "i8",       TAU_TOK_KW_I8       },
+    { "i16",      TAU_TOK_KW_I16      }, { "i32",      TAU_TOK_KW_I32      },
+    { "i64",      TAU_TOK_KW_I64      }, { "isize",    TAU_TOK_KW_ISIZE    },
+    { "u8",       TAU_TOK_KW_U8       }, { "u16",      TAU_TOK_KW_U16      },
+    { "u32",      TAU_TOK_KW_U32      }, { "u64",      TAU_TOK_KW_U64      },
+    { "usize",    TAU_TOK_KW_USIZE    }, { "f32",      TAU_TOK_KW_F32      },
+    { "f64",      TAU_TOK_KW_F64      }, { "c64",      TAU_TOK_KW_C64      },
+    { "c128",     TAU_TOK_KW_C128     }, { "char",     TAU_TOK_KW_CHAR     },
+    { "bool",     TAU_TOK_KW_BOOL     }, { "unit",     TAU_TOK_KW_UNIT     },
+    { "type",     TAU_TOK_KW_TYPE     }, { "undef",    TAU_TOK_KW_UNDEF    },
+    { "true",     TAU_TOK_LIT_BOOL    }, { "false",    TAU_TOK_LIT_BOOL    },
+    { "null",     TAU_TOK_LIT_NULL    },
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    TEST_ASSERT_EQUAL(lexer_test_first_kind(cases[i].src), cases[i].kind);
+}
+
+TEST_CASE(tau_lexer_identifiers)
+{
+  static const char* cases[] = {
+    "i", "x", "iff", "i3", "i128", "funny", "types", "nul", "_if", "if_",
+    "continues", "u", "c", "f16", "Struct",
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    TEST_ASSERT_EQUAL(lexer_test_first_kind(cases[i]), TAU_TOK_ID);
+}
+
+TEST_CASE(tau_lexer_interned_identifiers)
+{
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "interned.tau", "foo bar fun foo", toks, errors);
+
+  tau_token_t* foo1 = (tau_token_t*)tau_vector_get(toks, 0);
+  tau_token_t* bar = (tau_token_t*)tau_vector_get(toks, 1);
+  tau_token_t* fun = (tau_token_t*)tau_vector_get(toks, 2);
+  tau_token_t* foo2 = (tau_token_t*)tau_vector_get(toks, 3);
+
+  TEST_ASSERT_TRUE(foo1->id != TAU_INTERNER_NULL_ID);
+  TEST_ASSERT_TRUE(foo1->id != bar->id);
+  TEST_ASSERT_EQUAL(foo1->id, foo2->id);
+  TEST_ASSERT_EQUAL(fun->id, TAU_INTERNER_NULL_ID);
+  TEST_ASSERT_EQUAL(tau_interner_find("bar", 3), bar->id);
+
+  tau_error_bag_free(errors);
+  tau_vector_free(toks);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+  tau_interner_free();
+}
+
+TEST_CASE(tau_lexer_vec_mat)
+{
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec3f32"), TAU_TOK_KW_VEC);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec4u8"), TAU_TOK_KW_VEC);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec16i64"), TAU_TOK_KW_VEC);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("mat4f64"), TAU_TOK_KW_MAT);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("mat2x3i16"), TAU_TOK_KW_MAT);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("mat10x12u32"), TAU_TOK_KW_MAT);
+
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec3"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vecf32"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec3i1"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec3f32x"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("vec3f32_"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("mat2xf32"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("mat2x3"), TAU_TOK_ID);
+  TEST_ASSERT_EQUAL(lexer_test_first_kind("matrix"), TAU_TOK_ID);
+}
+
+TEST_CASE(tau_lexer_newline_flag)
+{
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "newline.tau", "a b\n\n  c \"d\ne\" f\n", toks, errors);
+
+  static const struct { tau_token_kind_t kind; uint32_t flags; } expected[] = {
+    { TAU_TOK_ID,      0                      },
+    { TAU_TOK_ID,      0                      },
+    { TAU_TOK_ID,      TAU_TOKEN_FLAG_NEWLINE },
+    { TAU_TOK_LIT_STR, 0                      },
+    { TAU_TOK_ID,      0                      },
+    { TAU_TOK_EOF,     TAU_TOKEN_FLAG_NEWLINE },
+  };
+
+  TEST_ASSERT_EQUAL(tau_vector_size(toks), sizeof(expected) / sizeof(expected[0]));
+
+  for (size_t i = 0; i < tau_vector_size(toks); i++)
+  {
+    tau_token_t* tok = (tau_token_t*)tau_vector_get(toks, i);
+
+    TEST_ASSERT_EQUAL(tok->kind, expected[i].kind);
+    TEST_ASSERT_EQUAL(tok->flags, expected[i].flags);
+  }
+
+  tau_error_bag_free(errors);
+  tau_vector_free(toks);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+}
+
+TEST_CASE(tau_lexer_comments)
+{
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "comments.tau", "a // b\n/* c\n**/ d /* e", toks, errors);
+
+  static const tau_token_kind_t kinds[] = {
+    TAU_TOK_ID, TAU_TOK_ID, TAU_TOK_EOF
+  };
+
+  TEST_ASSERT_EQUAL(tau_vector_size(toks), sizeof(kinds) / sizeof(kinds[0]));
+
+  for (size_t i = 0; i < tau_vector_size(toks); i++)
+    TEST_ASSERT_EQUAL(((tau_token_t*)tau_vector_get(toks, i))->kind, kinds[i]);
+
+  tau_token_t* a = (tau_token_t*)tau_vector_get(toks, 0);
+  tau_token_t* d = (tau_token_t*)tau_vector_get(toks, 1);
+
+  TEST_ASSERT_EQUAL(a->flags & TAU_TOKEN_FLAG_NEWLINE, 0);
+  TEST_ASSERT_EQUAL(d->flags & TAU_TOKEN_FLAG_NEWLINE, TAU_TOKEN_FLAG_NEWLINE);
+
+  // The newline is recovered from the source for the first line feed after
+  // the previous token.
+  tau_token_t newline = tau_token_newline_before(a, d);
+
+  TEST_ASSERT_EQUAL(newline.kind, TAU_TOK_NEWLINE);
+  TEST_ASSERT_EQUAL(newline.pos, 6);
+
+  tau_location_t loc = tau_token_location(d);
+
+  TEST_ASSERT_EQUAL(loc.row, 2);
+  TEST_ASSERT_EQUAL(loc.col, 4);
+
+  tau_error_bag_free(errors);
+  tau_vector_free(toks);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_lexer_keywords);
+  TEST_RUN(tau_lexer_identifiers);
+  TEST_RUN(tau_lexer_interned_identifiers);
+  TEST_RUN(tau_lexer_vec_mat);
+  TEST_RUN(tau_lexer_newline_flag);
+  TEST_RUN(tau_lexer_comments);
+}
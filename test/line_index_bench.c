@@ -0,0 +1,73 @@
+#include "bench.h"
+
+#include "stages/lexer/token/registry.h"
+#include "stages/lexer/token/token.h"
+
+/// The number of tokens whose location is queried.
+#define LINE_INDEX_BENCH_TOKEN_COUNT ((size_t)1024)
+
+/**
+ * \brief Creates a source string consisting of `lines` identical lines.
+ */
+static char* line_index_bench_make_source(size_t lines)
+{
+  static const char line[] = "  identifier_with_some_length\n";
+  size_t line_len = sizeof(line) - 1;
+
+  char* src = (char*)malloc(lines * line_len + 1);
+
+  for (size_t i = 0; i < lines; i++)
+    memcpy(src + i * line_len, line, line_len);
+
+  src[lines * line_len] = '\0';
+
+  return src;
+}
+
+/**
+ * \brief Measures location queries of tokens on pseudo-random lines of a
+ * source file.
+ */
+static void line_index_bench_token_location(const char* path, size_t lines)
+{
+  char* src = line_index_bench_make_source(lines);
+  size_t line_len = strlen(src) / lines;
+
+  uint32_t file = tau_token_registry_register_file(path, src);
+
+  tau_token_t* toks[LINE_INDEX_BENCH_TOKEN_COUNT];
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+  for (size_t i = 0; i < LINE_INDEX_BENCH_TOKEN_COUNT; i++)
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    size_t row = (size_t)(state >> 33) % lines;
+
+    toks[i] = tau_token_registry_token_init(file, TAU_TOK_ID, row * line_len + 2);
+  }
+
+  BENCH_LOOP(LINE_INDEX_BENCH_TOKEN_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_token_location(toks[bench_iteration]).row);
+  }
+
+  tau_token_registry_free();
+
+  free(src);
+}
+
+BENCH_CASE(tau_token_location_small_file)
+{
+  line_index_bench_token_location("small.tau", 1000);
+}
+
+BENCH_CASE(tau_token_location_large_file)
+{
+  line_index_bench_token_location("large.tau", 100000);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_token_location_small_file);
+  TEST_RUN(tau_token_location_large_file);
+}
@@ -0,0 +1,71 @@
+#include "test.h"
+
+#include "stages/lexer/line_index.h"
+#include "stages/lexer/token/registry.h"
+
+TEST_CASE(tau_line_index_init_empty)
+{
+  tau_line_index_t* idx = tau_line_index_init("");
+
+  TEST_ASSERT_EQUAL(tau_line_index_count(idx), 1);
+
+  size_t row = 1, col = 1;
+  tau_line_index_resolve(idx, 0, &row, &col);
+
+  TEST_ASSERT_EQUAL(row, 0);
+  TEST_ASSERT_EQUAL(col, 0);
+
+  tau_line_index_free(idx);
+}
+
+TEST_CASE(tau_line_index_resolve)
+{
+  const char* src = "ab\ncde\n\nf";
+  tau_line_index_t* idx = tau_line_index_init(src);
+
+  TEST_ASSERT_EQUAL(tau_line_index_count(idx), 4);
+
+  static const struct { size_t pos, row, col; } cases[] = {
+    { 0, 0, 0 }, { 1, 0, 1 }, { 2, 0, 2 },
+    { 3, 1, 0 }, { 5, 1, 2 }, { 6, 1, 3 },
+    { 7, 2, 0 },
+    { 8, 3, 0 }, { 9, 3, 1 },
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    size_t row = 0, col = 0;
+    tau_line_index_resolve(idx, cases[i].pos, &row, &col);
+
+    TEST_ASSERT_EQUAL(row, cases[i].row);
+    TEST_ASSERT_EQUAL(col, cases[i].col);
+  }
+
+  tau_line_index_free(idx);
+}
+
+TEST_CASE(tau_token_location)
+{
+  const char* path = "tau_token_location.tau";
+  const char* src = "fun\n  main\n";
+
+  uint32_t file = tau_token_registry_register_file(path, src);
+
+  tau_token_t* tok = tau_token_registry_token_init(file, TAU_TOK_ID, 6);
+  tok->len = 4;
+  tau_location_t loc = tau_token_location(tok);
+
+  TEST_ASSERT_STR_EQUAL(loc.path, path);
+  TEST_ASSERT_EQUAL(loc.row, 1);
+  TEST_ASSERT_EQUAL(loc.col, 2);
+  TEST_ASSERT_EQUAL(loc.len, 4);
+
+  tau_token_registry_free();
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_line_index_init_empty);
+  TEST_RUN(tau_line_index_resolve);
+  TEST_RUN(tau_token_location);
+}
@@ -0,0 +1,113 @@
+#include "test.h"
+
+#include <string.h>
+
+#include "utils/memory/memstat.h"
+
+/**
+ * \brief Prints the memory report of the calling thread into a buffer.
+ */
+static void memstat_test_report_end(char* buf, size_t len)
+{
+  FILE* stream = tmpfile();
+
+  tau_memstat_report_end(stream, "memstat_test");
+
+  rewind(stream);
+
+  size_t read = fread(buf, sizeof(char), len - 1, stream);
+  buf[read] = '\0';
+
+  fclose(stream);
+}
+
+TEST_CASE(tau_memstat_disabled)
+{
+  TEST_ASSERT_FALSE(tau_memstat_is_enabled());
+
+  char* ptr = (char*)tau_memstat_malloc(16);
+  TEST_ASSERT_NOT_NULL(ptr);
+
+  memset(ptr, 'a', 16);
+
+  ptr = (char*)tau_memstat_realloc(ptr, 64);
+  TEST_ASSERT_NOT_NULL(ptr);
+  TEST_ASSERT_EQUAL(ptr[15], 'a');
+
+  tau_memstat_free(ptr);
+
+  // Reports are not recorded without counting.
+  tau_memstat_report_begin();
+  tau_memstat_report_stage("ignored");
+
+  char buf[1024];
+  memstat_test_report_end(buf, sizeof(buf));
+
+  TEST_ASSERT_STR_EQUAL(buf, "");
+}
+
+TEST_CASE(tau_memstat_set_owner)
+{
+  TEST_ASSERT_EQUAL(tau_memstat_set_owner(TAU_MEMSTAT_OWNER_AST), TAU_MEMSTAT_OWNER_OTHER);
+  TEST_ASSERT_EQUAL(tau_memstat_set_owner(TAU_MEMSTAT_OWNER_OTHER), TAU_MEMSTAT_OWNER_AST);
+
+  TEST_ASSERT_STR_EQUAL(tau_memstat_owner_to_cstr(TAU_MEMSTAT_OWNER_TOKENS), "tokens");
+  TEST_ASSERT_STR_EQUAL(tau_memstat_owner_to_cstr(TAU_MEMSTAT_OWNER_TYPETABLE), "typetable");
+}
+
+TEST_CASE(tau_memstat_report)
+{
+  void* uncounted = tau_memstat_calloc(4, 256);
+  TEST_ASSERT_NOT_NULL(uncounted);
+
+  tau_memstat_enable();
+
+  TEST_ASSERT(tau_memstat_is_enabled());
+
+  tau_memstat_report_begin();
+
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_AST);
+
+  void* ptr = tau_memstat_malloc(2048);
+  TEST_ASSERT_NOT_NULL(ptr);
+
+  void* tmp = tau_memstat_malloc(1024);
+  TEST_ASSERT_NOT_NULL(tmp);
+
+  tau_memstat_free(tmp);
+
+  tau_memstat_set_owner(TAU_MEMSTAT_OWNER_OTHER);
+  tau_memstat_report_stage("alloc");
+
+  // Reallocation keeps the owner of the block.
+  ptr = tau_memstat_realloc(ptr, 4096);
+  TEST_ASSERT_NOT_NULL(ptr);
+
+  tau_memstat_report_stage("realloc");
+
+  tau_memstat_free(ptr);
+  tau_memstat_free(uncounted);
+
+  tau_memstat_report_stage("free");
+
+  char buf[4096];
+  memstat_test_report_end(buf, sizeof(buf));
+
+  TEST_ASSERT(strstr(buf, "Memory report for memstat_test (KiB):") == buf);
+  TEST_ASSERT_NOT_NULL(strstr(buf, "alloc        retained         0.0        2.0"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "             peak             0.0        3.0"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "realloc      retained         0.0        4.0"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "free         retained         0.0        0.0"));
+
+  // The peak of LLVM is unknown, so the total peak is left blank.
+  const char* peak_end = strchr(strstr(buf, "             peak"), '\n');
+  TEST_ASSERT_NOT_NULL(peak_end);
+  TEST_ASSERT_EQUAL(peak_end[-1], '-');
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_memstat_disabled);
+  TEST_RUN(tau_memstat_set_owner);
+  TEST_RUN(tau_memstat_report);
+}
@@ -0,0 +1,95 @@
+#include "bench.h"
+
+#include <stdio.h>
+
+#include "ast/ast.h"
+#include "stages/analysis/nameres.h"
+#include "stages/lexer/lexer.h"
+#include "stages/lexer/token/registry.h"
+#include "stages/parser/parser.h"
+#include "utils/interner.h"
+
+/// The number of functions of the generated source.
+#define NAMERES_BENCH_FUNCTION_COUNT ((size_t)2000)
+
+/// The loop nesting depth of the functions of the generated source.
+#define NAMERES_BENCH_DEPTH ((size_t)24)
+
+/**
+ * \brief Generates a source of `funs` functions whose bodies are nested
+ * `depth` loops deep. Every level declares a variable initialized from the
+ * level above and the innermost one calls the previous function.
+ */
+static char* nameres_bench_make_source(size_t funs, size_t depth)
+{
+  size_t cap = funs * (depth + 4) * (4 * depth + 96);
+  char* src = (char*)malloc(cap);
+  size_t len = 0;
+
+  for (size_t i = 0; i < funs; i++)
+  {
+    len += (size_t)snprintf(src + len, cap - len, "fun proc%zu(a: i32, b: i32): i32 {\n  x0: i32 = a\n", i);
+
+    for (size_t d = 1; d <= depth; d++)
+    {
+      if (d < depth || i == 0)
+        len += (size_t)snprintf(src + len, cap - len, "%*swhile x%zu < b do {\n%*sx%zu: i32 = x%zu + a\n",
+          (int)d * 2, "", d - 1, (int)d * 2 + 2, "", d, d - 1);
+      else
+        len += (size_t)snprintf(src + len, cap - len, "%*swhile x%zu < b do {\n%*sx%zu: i32 = proc%zu(x%zu, b)\n",
+          (int)d * 2, "", d - 1, (int)d * 2 + 2, "", d, i - 1, d - 1);
+    }
+
+    for (size_t d = depth; d >= 1; d--)
+      len += (size_t)snprintf(src + len, cap - len, "%*s}\n", (int)d * 2, "");
+
+    len += (size_t)snprintf(src + len, cap - len, "  return x0\n}\n");
+  }
+
+  return src;
+}
+
+BENCH_CASE(tau_nameres_deep_nesting)
+{
+  char* src = nameres_bench_make_source(NAMERES_BENCH_FUNCTION_COUNT, NAMERES_BENCH_DEPTH);
+
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_parser_t* par = tau_parser_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_arena_t* arena = tau_arena_init();
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "nameres_bench.tau", src, toks, errors);
+  tau_ast_node_t* root = tau_parser_parse(par, toks, arena, errors);
+
+  TEST_ASSERT_TRUE(tau_error_bag_empty(errors));
+
+  // Every operation resolves the whole syntax tree into a fresh symbol table.
+  BENCH_LOOP(1)
+  {
+    tau_symtable_t* symtable = tau_symtable_init(NULL);
+    tau_nameres_ctx_t* ctx = tau_nameres_ctx_init(symtable, errors);
+
+    tau_ast_node_nameres(ctx, root);
+
+    tau_nameres_ctx_free(ctx);
+    tau_symtable_free(symtable);
+  }
+
+  TEST_ASSERT_TRUE(tau_error_bag_empty(errors));
+
+  tau_error_bag_free(errors);
+  tau_arena_free(arena);
+  tau_vector_free(toks);
+  tau_parser_free(par);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+  tau_interner_free();
+
+  free(src);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_nameres_deep_nesting);
+}
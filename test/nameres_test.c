@@ -0,0 +1,173 @@
+#include "test.h"
+
+#include "ast/ast.h"
+#include "stages/analysis/nameres.h"
+#include "stages/analysis/scopestack.h"
+#include "stages/lexer/lexer.h"
+#include "stages/lexer/token/registry.h"
+#include "stages/parser/parser.h"
+#include "utils/interner.h"
+
+/**
+ * \brief Resolves the names of a source string and records whether it
+ * resolved without errors.
+ */
+static void nameres_test_run(const char* src, bool* ok)
+{
+  tau_lexer_t* lex = tau_lexer_init();
+  tau_parser_t* par = tau_parser_init();
+  tau_vector_t* toks = tau_vector_init();
+  tau_arena_t* arena = tau_arena_init();
+  tau_symtable_t* symtable = tau_symtable_init(NULL);
+  tau_error_bag_t* errors = tau_error_bag_init(10);
+
+  tau_lexer_lex(lex, "nameres_test.tau", src, toks, errors);
+  TEST_ASSERT_TRUE(tau_error_bag_empty(errors));
+
+  tau_ast_node_t* root = tau_parser_parse(par, toks, arena, errors);
+  TEST_ASSERT_TRUE(tau_error_bag_empty(errors));
+
+  tau_nameres_ctx_t* ctx = tau_nameres_ctx_init(symtable, errors);
+  tau_ast_node_nameres(ctx, root);
+
+  *ok = tau_error_bag_empty(errors);
+
+  tau_nameres_ctx_free(ctx);
+  tau_error_bag_free(errors);
+  tau_symtable_free(symtable);
+  tau_arena_free(arena);
+  tau_vector_free(toks);
+  tau_parser_free(par);
+  tau_lexer_free(lex);
+  tau_token_registry_free();
+  tau_interner_free();
+}
+
+/**
+ * \brief Returns whether a source string resolves without errors.
+ */
+static bool nameres_test_resolve(const char* src)
+{
+  bool ok = false;
+
+  nameres_test_run(src, &ok);
+
+  return ok;
+}
+
+TEST_CASE(tau_scopestack)
+{
+  tau_ast_node_t* nodes = (tau_ast_node_t*)calloc(4, sizeof(tau_ast_node_t));
+  tau_symtable_t* members = tau_symtable_init(NULL);
+  tau_scopestack_t* stack = tau_scopestack_init();
+
+  uint32_t x = tau_interner_intern("x", 1);
+  uint32_t y = tau_interner_intern("y", 1);
+
+  tau_scopestack_begin(stack, NULL);
+
+  TEST_ASSERT_NULL(tau_scopestack_insert(stack, x, &nodes[0]));
+  TEST_ASSERT_PTR_EQUAL(tau_scopestack_insert(stack, x, &nodes[1]), &nodes[0]);
+
+  tau_scopestack_begin(stack, members);
+
+  TEST_ASSERT_NULL(tau_scopestack_insert(stack, x, &nodes[2]));
+  TEST_ASSERT_NULL(tau_scopestack_insert(stack, y, &nodes[3]));
+  TEST_ASSERT_PTR_EQUAL(tau_scopestack_lookup(stack, x), &nodes[2]);
+  TEST_ASSERT_EQUAL(tau_scopestack_depth(stack), 2);
+
+  tau_scopestack_end(stack);
+
+  TEST_ASSERT_PTR_EQUAL(tau_scopestack_lookup(stack, x), &nodes[0]);
+  TEST_ASSERT_NULL(tau_scopestack_lookup(stack, y));
+  TEST_ASSERT_PTR_EQUAL(tau_symtable_get(members, x)->node, &nodes[2]);
+  TEST_ASSERT_PTR_EQUAL(tau_symtable_get(members, y)->node, &nodes[3]);
+
+  tau_scopestack_end(stack);
+
+  TEST_ASSERT_NULL(tau_scopestack_lookup(stack, x));
+  TEST_ASSERT_EQUAL(tau_scopestack_depth(stack), 0);
+
+  tau_scopestack_free(stack);
+  tau_symtable_free(members);
+  tau_interner_free();
+  free(nodes);
+}
+
+TEST_CASE(tau_nameres_scopes)
+{
+  // Functions are only visible after their declaration.
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "fun f(a: i32): i32 {\n"
+    "  x: i32 = a\n"
+    "  { y: i32 = x }\n"
+    "  { y: i32 = a }\n"
+    "  return g(x)\n"
+    "}\n"
+    "fun g(a: i32): i32 { return a }\n"));
+
+  TEST_ASSERT_TRUE(nameres_test_resolve(
+    "fun g(a: i32): i32 { return a }\n"
+    "fun f(a: i32): i32 {\n"
+    "  x: i32 = a\n"
+    "  { y: i32 = x }\n"
+    "  { y: i32 = a }\n"
+    "  return g(x)\n"
+    "}\n"));
+}
+
+TEST_CASE(tau_nameres_scope_end)
+{
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "fun f(a: i32): i32 {\n"
+    "  { y: i32 = a }\n"
+    "  return y\n"
+    "}\n"));
+}
+
+TEST_CASE(tau_nameres_collision)
+{
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "fun f(a: i32): i32 {\n"
+    "  x: i32 = a\n"
+    "  x: i32 = a\n"
+    "  return x\n"
+    "}\n"));
+
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "fun f(a: i32): i32 { return a }\n"
+    "fun f(a: i32): i32 { return a }\n"));
+}
+
+TEST_CASE(tau_nameres_shadowing)
+{
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "fun f(a: i32): i32 {\n"
+    "  x: i32 = a\n"
+    "  { x: i32 = a }\n"
+    "  return x\n"
+    "}\n"));
+}
+
+TEST_CASE(tau_nameres_members)
+{
+  TEST_ASSERT_TRUE(nameres_test_resolve(
+    "mod m {\n"
+    "  pub struct S { x: i32 }\n"
+    "}\n"
+    "struct T { x: i32 }\n"
+    "fun f(s: m.S, t: T): i32 { return 0 }\n"));
+
+  TEST_ASSERT_FALSE(nameres_test_resolve(
+    "struct T { x: i32 x: i32 }\n"));
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_scopestack);
+  TEST_RUN(tau_nameres_scopes);
+  TEST_RUN(tau_nameres_scope_end);
+  TEST_RUN(tau_nameres_collision);
+  TEST_RUN(tau_nameres_shadowing);
+  TEST_RUN(tau_nameres_members);
+}
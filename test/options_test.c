@@ -0,0 +1,112 @@
+#include "test.h"
+
+#include <stdio.h>
+
+#include "compiler/options.h"
+#include "utils/concurrency/thread.h"
+
+/**
+ * \brief Parses the value of a single option followed by an input file.
+ */
+static tau_options_ctx_t* parse_option(const char* option, const char* value)
+{
+  const char* argv[] = { "tauc", option, value, "main.tau" };
+
+  tau_options_ctx_t* ctx = tau_options_ctx_init();
+  tau_options_parse(ctx, (int)TAU_COUNTOF(argv), argv);
+
+  return ctx;
+}
+
+/**
+ * \brief Returns the job count parsed from an argument.
+ */
+static size_t parse_job_count(const char* value)
+{
+  tau_options_ctx_t* ctx = parse_option("-j", value);
+  size_t count = tau_options_get_job_count(ctx);
+  tau_options_ctx_free(ctx);
+
+  return count;
+}
+
+TEST_CASE(tau_options_job_count)
+{
+  TEST_ASSERT_EQUAL(parse_job_count("1"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count("2"), 2);
+  TEST_ASSERT_EQUAL(parse_job_count("0"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count("-1"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count("+2"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count(" 2"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count("2x"), 1);
+  TEST_ASSERT_EQUAL(parse_job_count("99999999999999999999999"), 1);
+}
+
+TEST_CASE(tau_options_job_count_is_capped)
+{
+  size_t max_count = tau_thread_hardware_concurrency() * 4;
+
+  TEST_ASSERT_EQUAL(parse_job_count("99999999999"), max_count);
+}
+
+/**
+ * \brief Returns the split count parsed from an argument.
+ */
+static size_t parse_split_count(const char* value)
+{
+  tau_options_ctx_t* ctx = parse_option("--split-module", value);
+  size_t count = tau_options_get_split_count(ctx);
+  tau_options_ctx_free(ctx);
+
+  return count;
+}
+
+TEST_CASE(tau_options_split_count)
+{
+  TEST_ASSERT_EQUAL(parse_split_count("1"), 1);
+  TEST_ASSERT_EQUAL(parse_split_count("4"), 4);
+  TEST_ASSERT_EQUAL(parse_split_count("0"), 1);
+  TEST_ASSERT_EQUAL(parse_split_count("-1"), 1);
+  TEST_ASSERT_EQUAL(parse_split_count("4x"), 1);
+  TEST_ASSERT_EQUAL(parse_split_count("99999999999999999999999"), 1);
+  TEST_ASSERT_EQUAL(parse_split_count("99999999999"), 256);
+}
+
+/**
+ * \brief Returns the cache size parsed from an argument.
+ */
+static size_t parse_cache_size(const char* value)
+{
+  tau_options_ctx_t* ctx = parse_option("--cache-size", value);
+  size_t size = tau_options_get_cache_size(ctx);
+  tau_options_ctx_free(ctx);
+
+  return size;
+}
+
+TEST_CASE(tau_options_cache_size)
+{
+  size_t default_size = (size_t)1024 * 1024 * 1024;
+
+  TEST_ASSERT_EQUAL(parse_cache_size("1"), 1024 * 1024);
+  TEST_ASSERT_EQUAL(parse_cache_size("0"), default_size);
+  TEST_ASSERT_EQUAL(parse_cache_size("-1"), default_size);
+  TEST_ASSERT_EQUAL(parse_cache_size("1x"), default_size);
+  TEST_ASSERT_EQUAL(parse_cache_size("99999999999999999999999"), default_size);
+
+  // The size in bytes would overflow.
+  char arg[32];
+  snprintf(arg, sizeof(arg), "%zu", SIZE_MAX / (1024 * 1024) + 1);
+  TEST_ASSERT_EQUAL(parse_cache_size(arg), default_size);
+
+  snprintf(arg, sizeof(arg), "%zu", SIZE_MAX / (1024 * 1024));
+  TEST_ASSERT_EQUAL(parse_cache_size(arg), SIZE_MAX / (1024 * 1024) * 1024 * 1024);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_options_job_count);
+  TEST_RUN(tau_options_job_count_is_capped);
+  TEST_RUN(tau_options_split_count);
+  TEST_RUN(tau_options_cache_size);
+}
@@ -0,0 +1,49 @@
+#include "test.h"
+
+#include "utils/str.h"
+#include "utils/io/path.h"
+
+/**
+ * \brief Checks the result of replacing the extension of a path.
+ */
+static void check_replace_extension(const char* path_cstr, const char* extension, const char* expected)
+{
+  tau_path_t* path = tau_path_init_with_cstr(path_cstr);
+  tau_path_t* result = tau_path_replace_extension(path, extension);
+  tau_string_t* result_str = tau_path_to_string(result);
+
+  TEST_ASSERT_STR_EQUAL(tau_string_begin(result_str), expected);
+
+  tau_string_free(result_str);
+  tau_path_free(result);
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_path_replace_extension)
+{
+  check_replace_extension("main.tau", "obj", "main.obj");
+  check_replace_extension("build/main.tau", "obj", "build/main.obj");
+  check_replace_extension("build/main.tau", "time-trace.json", "build/main.time-trace.json");
+  check_replace_extension("build.d/main.tau", "obj", "build.d/main.obj");
+}
+
+TEST_CASE(tau_path_replace_extension_without_extension)
+{
+  check_replace_extension("app", "obj", "app.obj");
+  check_replace_extension("build/app", "obj", "build/app.obj");
+  check_replace_extension("build.d/app", "obj", "build.d/app.obj");
+  check_replace_extension("/tmp/app", "time-trace.json", "/tmp/app.time-trace.json");
+}
+
+TEST_CASE(tau_path_replace_extension_of_directory)
+{
+  check_replace_extension("", "obj", ".obj");
+  check_replace_extension("build/", "obj", "build/.obj");
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_path_replace_extension);
+  TEST_RUN(tau_path_replace_extension_without_extension);
+  TEST_RUN(tau_path_replace_extension_of_directory);
+}
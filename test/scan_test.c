@@ -0,0 +1,115 @@
+#include "test.h"
+
+#include <ctype.h>
+#include <stdint.h>
+
+#include "utils/scan.h"
+
+#define SCAN_TEST_BUFFER_SIZE 200
+
+/**
+ * \brief Fills a buffer with a random mix of characters from a set.
+ */
+static void scan_test_fill(char* buf, size_t size, const char* set, uint64_t* state)
+{
+  size_t set_len = strlen(set);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    buf[i] = set[(*state >> 33) % set_len];
+  }
+}
+
+static const char* scan_test_ref_skip_blank(const char* begin, const char* end)
+{
+  while (begin < end && isspace((unsigned char)*begin) && *begin != '\n')
+    begin++;
+
+  return begin;
+}
+
+static const char* scan_test_ref_skip_word(const char* begin, const char* end)
+{
+  while (begin < end && (isalnum((unsigned char)*begin) || *begin == '_'))
+    begin++;
+
+  return begin;
+}
+
+static const char* scan_test_ref_find_either(const char* begin, const char* end, char a, char b)
+{
+  while (begin < end && *begin != a && *begin != b)
+    begin++;
+
+  return begin;
+}
+
+TEST_CASE(tau_scan_skip_blank)
+{
+  char buf[SCAN_TEST_BUFFER_SIZE];
+  uint64_t state = 1;
+
+  for (size_t round = 0; round < 64; round++)
+  {
+    // Mostly blanks so that runs cross vector boundaries.
+    scan_test_fill(buf, sizeof(buf), "    \t\t\r\v\f      \t  \t  \nx\x80", &state);
+
+    for (size_t begin = 0; begin < 40; begin++)
+      for (size_t end = begin; end <= sizeof(buf); end += 7)
+        TEST_ASSERT_PTR_EQUAL(tau_scan_skip_blank(buf + begin, buf + end), scan_test_ref_skip_blank(buf + begin, buf + end));
+  }
+}
+
+TEST_CASE(tau_scan_skip_word)
+{
+  char buf[SCAN_TEST_BUFFER_SIZE];
+  uint64_t state = 2;
+
+  for (size_t round = 0; round < 64; round++)
+  {
+    scan_test_fill(buf, sizeof(buf), "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_@[`{/:\x80\xE1 ", &state);
+
+    for (size_t begin = 0; begin < 40; begin++)
+      for (size_t end = begin; end <= sizeof(buf); end += 7)
+        TEST_ASSERT_PTR_EQUAL(tau_scan_skip_word(buf + begin, buf + end), scan_test_ref_skip_word(buf + begin, buf + end));
+  }
+}
+
+TEST_CASE(tau_scan_find_newline)
+{
+  char buf[SCAN_TEST_BUFFER_SIZE];
+  uint64_t state = 3;
+
+  for (size_t round = 0; round < 64; round++)
+  {
+    scan_test_fill(buf, sizeof(buf), "abcdefghijklmnopqrstuvwxyz /*\t\n", &state);
+
+    for (size_t begin = 0; begin < 40; begin++)
+      for (size_t end = begin; end <= sizeof(buf); end += 7)
+        TEST_ASSERT_PTR_EQUAL(tau_scan_find_newline(buf + begin, buf + end), scan_test_ref_find_either(buf + begin, buf + end, '\n', '\n'));
+  }
+}
+
+TEST_CASE(tau_scan_find_either)
+{
+  char buf[SCAN_TEST_BUFFER_SIZE];
+  uint64_t state = 4;
+
+  for (size_t round = 0; round < 64; round++)
+  {
+    scan_test_fill(buf, sizeof(buf), "abcdefghijklmnopqrstuvwxyz0123456789 /*\n", &state);
+
+    for (size_t begin = 0; begin < 40; begin++)
+      for (size_t end = begin; end <= sizeof(buf); end += 7)
+        TEST_ASSERT_PTR_EQUAL(tau_scan_find_either(buf + begin, buf + end, '*', '\n'), scan_test_ref_find_either(buf + begin, buf + end, '*', '\n'));
+  }
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_scan_skip_blank);
+  TEST_RUN(tau_scan_skip_word);
+  TEST_RUN(tau_scan_find_newline);
+  TEST_RUN(tau_scan_find_either);
+}
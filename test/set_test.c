@@ -58,6 +58,35 @@ TEST_CASE(tau_set_remove)
   tau_set_free(set);
 }
 
+TEST_CASE(tau_set_remove_inner)
+{
+  int data[64];
+
+  tau_set_t* set = tau_set_init(cmp_int);
+
+  // Insert in an order that leaves nodes with two children.
+  for (int i = 0; i < 64; i++)
+  {
+    data[i] = i * 37 % 64;
+    tau_set_add(set, &data[i]);
+  }
+
+  for (int i = 0; i < 64; i += 2)
+    TEST_ASSERT_TRUE(tau_set_remove(set, &data[i]));
+
+  TEST_ASSERT_EQUAL(tau_set_size(set), 32);
+
+  for (int i = 0; i < 64; i++)
+    TEST_ASSERT_EQUAL(tau_set_contains(set, &data[i]), i % 2 == 1);
+
+  for (int i = 1; i < 64; i += 2)
+    TEST_ASSERT_TRUE(tau_set_remove(set, &data[i]));
+
+  TEST_ASSERT_TRUE(tau_set_empty(set));
+
+  tau_set_free(set);
+}
+
 TEST_CASE(tau_set_contains)
 {
   int data1 = 1, data2 = 2, data3 = 3;
@@ -195,6 +224,7 @@ TEST_MAIN()
   TEST_RUN(tau_set_init);
   TEST_RUN(tau_set_add);
   TEST_RUN(tau_set_remove);
+  TEST_RUN(tau_set_remove_inner);
   TEST_RUN(tau_set_contains);
   TEST_RUN(tau_set_get);
   TEST_RUN(tau_set_min);
@@ -0,0 +1,75 @@
+#include "bench.h"
+
+#include "utils/str.h"
+
+/// The text used to build strings.
+#define STR_BENCH_TEXT "The quick brown fox jumps over the lazy dog. "
+
+BENCH_CASE(tau_string_append_cstr)
+{
+  tau_string_t* str = tau_string_init();
+
+  BENCH_LOOP(1000)
+  {
+    // Keep the length bounded so every sample measures the same work.
+    if (tau_string_length(str) >= 4096)
+      tau_string_clear(str);
+
+    tau_string_append_cstr(str, STR_BENCH_TEXT);
+  }
+
+  tau_string_free(str);
+}
+
+BENCH_CASE(tau_string_copy)
+{
+  tau_string_t* str = tau_string_init_with_cstr(STR_BENCH_TEXT STR_BENCH_TEXT);
+
+  BENCH_LOOP(1000)
+  {
+    tau_string_t* copy = tau_string_copy(str);
+    BENCH_DO_NOT_OPTIMIZE(copy);
+    tau_string_free(copy);
+  }
+
+  tau_string_free(str);
+}
+
+BENCH_CASE(tau_string_compare)
+{
+  tau_string_t* lhs = tau_string_init_with_cstr(STR_BENCH_TEXT STR_BENCH_TEXT "a");
+  tau_string_t* rhs = tau_string_init_with_cstr(STR_BENCH_TEXT STR_BENCH_TEXT "b");
+
+  BENCH_LOOP(1000)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_string_compare(lhs, rhs));
+  }
+
+  tau_string_free(lhs);
+  tau_string_free(rhs);
+}
+
+BENCH_CASE(tau_string_find_cstr)
+{
+  tau_string_t* str = tau_string_init();
+
+  for (size_t i = 0; i < 16; i++)
+    tau_string_append_cstr(str, STR_BENCH_TEXT);
+
+  tau_string_append_cstr(str, "needle");
+
+  BENCH_LOOP(100)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_string_find_cstr(str, "needle"));
+  }
+
+  tau_string_free(str);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_string_append_cstr);
+  TEST_RUN(tau_string_copy);
+  TEST_RUN(tau_string_compare);
+  TEST_RUN(tau_string_find_cstr);
+}
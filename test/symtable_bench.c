@@ -0,0 +1,96 @@
+#include "bench.h"
+
+#include <stdio.h>
+
+#include "stages/analysis/symtable.h"
+#include "utils/interner.h"
+
+/// The number of symbols of the tables.
+#define SYMTABLE_BENCH_COUNT ((size_t)1000)
+
+/// The number of nested scopes of the lookup benchmark.
+#define SYMTABLE_BENCH_DEPTH ((size_t)8)
+
+static uint32_t g_symtable_bench_ids[SYMTABLE_BENCH_COUNT];
+
+static void symtable_bench_intern(void)
+{
+  for (size_t i = 0; i < SYMTABLE_BENCH_COUNT; i++)
+  {
+    char name[32];
+    int len = snprintf(name, sizeof(name), "symbol_%zu", i);
+
+    g_symtable_bench_ids[i] = tau_interner_intern(name, (size_t)len);
+  }
+}
+
+/**
+ * \brief Returns the i-th identifier in a pseudo-random order.
+ */
+static uint32_t symtable_bench_id(size_t i)
+{
+  // 613 is coprime with the symbol count.
+  return g_symtable_bench_ids[i * 613 % SYMTABLE_BENCH_COUNT];
+}
+
+static void symtable_bench_fill(tau_symtable_t* table)
+{
+  for (size_t i = 0; i < SYMTABLE_BENCH_COUNT; i++)
+    tau_symtable_insert(table, tau_symbol_init(symtable_bench_id(i), NULL));
+}
+
+// Every operation builds and frees a table of `SYMTABLE_BENCH_COUNT` symbols.
+BENCH_CASE(tau_symtable_build)
+{
+  BENCH_LOOP(1)
+  {
+    tau_symtable_t* table = tau_symtable_init(NULL);
+
+    symtable_bench_fill(table);
+
+    tau_symtable_free(table);
+  }
+}
+
+BENCH_CASE(tau_symtable_get)
+{
+  tau_symtable_t* table = tau_symtable_init(NULL);
+
+  symtable_bench_fill(table);
+
+  BENCH_LOOP(SYMTABLE_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_symtable_get(table, symtable_bench_id(bench_iteration)));
+  }
+
+  tau_symtable_free(table);
+}
+
+BENCH_CASE(tau_symtable_lookup_nested)
+{
+  tau_symtable_t* root = tau_symtable_init(NULL);
+  tau_symtable_t* scope = root;
+
+  symtable_bench_fill(root);
+
+  for (size_t i = 0; i < SYMTABLE_BENCH_DEPTH; i++)
+    scope = tau_symtable_init(scope);
+
+  BENCH_LOOP(SYMTABLE_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_symtable_lookup(scope, symtable_bench_id(bench_iteration)));
+  }
+
+  tau_symtable_free(root);
+}
+
+TEST_MAIN()
+{
+  symtable_bench_intern();
+
+  TEST_RUN(tau_symtable_build);
+  TEST_RUN(tau_symtable_get);
+  TEST_RUN(tau_symtable_lookup_nested);
+
+  tau_interner_free();
+}
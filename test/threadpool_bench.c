@@ -0,0 +1,97 @@
+#include "bench.h"
+
+#include "utils/concurrency/threadpool.h"
+
+/// The number of worker threads of the pools.
+#define THREADPOOL_BENCH_WORKER_COUNT ((size_t)4)
+
+/// The number of elements processed by a parallel for.
+#define THREADPOOL_BENCH_ELEMENT_COUNT ((size_t)1000000)
+
+/**
+ * \brief Does nothing, used to measure scheduling overhead.
+ */
+static void* empty_task(void* TAU_UNUSED(arg))
+{
+  return NULL;
+}
+
+/**
+ * \brief Doubles the integer received through arg.
+ */
+static void* double_task(void* arg)
+{
+  return (void*)((intptr_t)arg * 2);
+}
+
+/**
+ * \brief Increments every element of an integer array in a range.
+ */
+static void increment_range(void* arg, size_t begin, size_t end)
+{
+  int* values = (int*)arg;
+
+  for (size_t i = begin; i < end; i++)
+    values[i]++;
+}
+
+BENCH_CASE(tau_threadpool_spawn)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(THREADPOOL_BENCH_WORKER_COUNT);
+
+  // The workers run the tasks while more are spawned.
+  BENCH_LOOP(10000)
+  {
+    tau_threadpool_spawn(pool, empty_task, NULL);
+  }
+
+  // Freeing the pool runs every queued task.
+  tau_threadpool_free(pool);
+}
+
+BENCH_CASE(tau_threadpool_parallel_for)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(THREADPOOL_BENCH_WORKER_COUNT);
+
+  int* values = (int*)calloc(THREADPOOL_BENCH_ELEMENT_COUNT, sizeof(int));
+
+  BENCH_LOOP(1)
+  {
+    tau_threadpool_parallel_for(pool, 0, THREADPOOL_BENCH_ELEMENT_COUNT, 1024, increment_range, values);
+  }
+
+  for (size_t i = 1; i < THREADPOOL_BENCH_ELEMENT_COUNT; i++)
+    TEST_ASSERT_EQUAL(values[i], values[0]);
+
+  free(values);
+  tau_threadpool_free(pool);
+}
+
+BENCH_CASE(tau_threadpool_submit_wait)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(1);
+
+  BENCH_LOOP(1000)
+  {
+    tau_promise_t promise;
+    tau_promise_init(&promise);
+
+    tau_future_t future;
+    tau_threadpool_submit(pool, double_task, (void*)(intptr_t)bench_iteration, &promise, &future);
+    tau_threadpool_wait(pool, &future);
+
+    TEST_ASSERT_EQUAL((intptr_t)tau_future_get_value(&future), (intptr_t)bench_iteration * 2);
+
+    tau_future_free(&future);
+    tau_promise_free(&promise);
+  }
+
+  tau_threadpool_free(pool);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_threadpool_spawn);
+  TEST_RUN(tau_threadpool_parallel_for);
+  TEST_RUN(tau_threadpool_submit_wait);
+}
@@ -0,0 +1,250 @@
+#include "test.h"
+
+#include <stdint.h>
+
+#include "utils/concurrency/mutex.h"
+#include "utils/concurrency/threadpool.h"
+#include "utils/thread_local.h"
+
+/// Argument type for fib_task.
+typedef struct fib_arg_t
+{
+  tau_threadpool_t* pool; ///< The pool to spawn subtasks on.
+  int n; ///< The index of the Fibonacci number to compute.
+} fib_arg_t;
+
+/// Argument type for count_task.
+typedef struct count_arg_t
+{
+  tau_mutex_t mtx; ///< Mutex to protect count.
+  int count; ///< The number of completed tasks.
+} count_arg_t;
+
+/// Argument type for outer_range.
+typedef struct nested_arg_t
+{
+  tau_threadpool_t* pool; ///< The pool to run the inner loops on.
+  tau_mutex_t mtx; ///< Mutex to protect clobber_count.
+  int clobber_count; ///< The number of outer indices whose thread state changed.
+  int values[16][64]; ///< The elements incremented by the inner loops.
+} nested_arg_t;
+
+/// The outer index being processed by the current thread or `SIZE_MAX`.
+static TAU_THREAD_LOCAL size_t g_outer_idx = SIZE_MAX;
+
+/**
+ * \brief Returns its argument multiplied by two.
+ */
+static void* double_task(void* arg)
+{
+  return (void*)((intptr_t)arg * 2);
+}
+
+/**
+ * \brief Increments the counter received through arg.
+ */
+static void* count_task(void* arg)
+{
+  count_arg_t* ca = (count_arg_t*)arg;
+
+  tau_mutex_lock(&ca->mtx);
+  ca->count++;
+  tau_mutex_unlock(&ca->mtx);
+
+  return NULL;
+}
+
+/**
+ * \brief Computes a Fibonacci number by submitting one recursive call and
+ * waiting for it on the pool.
+ */
+static void* fib_task(void* arg)
+{
+  fib_arg_t* fa = (fib_arg_t*)arg;
+
+  if (fa->n < 2)
+    return (void*)(intptr_t)fa->n;
+
+  fib_arg_t left = { fa->pool, fa->n - 1 };
+  fib_arg_t right = { fa->pool, fa->n - 2 };
+
+  tau_promise_t promise;
+  tau_promise_init(&promise);
+
+  tau_future_t future;
+  tau_threadpool_submit(fa->pool, fib_task, &left, &promise, &future);
+
+  intptr_t result = (intptr_t)fib_task(&right);
+
+  tau_threadpool_wait(fa->pool, &future);
+  result += (intptr_t)tau_future_get_value(&future);
+
+  tau_future_free(&future);
+  tau_promise_free(&promise);
+
+  return (void*)result;
+}
+
+/**
+ * \brief Increments every element of a subrange of an integer array.
+ */
+static void increment_range(void* arg, size_t begin, size_t end)
+{
+  int* values = (int*)arg;
+
+  for (size_t i = begin; i < end; i++)
+    values[i]++;
+}
+
+/**
+ * \brief Runs an inner parallel for per outer index and records whether the
+ * thread-local outer index was changed while waiting for it.
+ */
+static void outer_range(void* arg, size_t begin, size_t end)
+{
+  nested_arg_t* na = (nested_arg_t*)arg;
+
+  for (size_t i = begin; i < end; i++)
+  {
+    bool is_clobbered = g_outer_idx != SIZE_MAX;
+
+    g_outer_idx = i;
+
+    tau_threadpool_parallel_for(na->pool, 0, 64, 1, increment_range, na->values[i]);
+
+    is_clobbered = is_clobbered || g_outer_idx != i;
+
+    g_outer_idx = SIZE_MAX;
+
+    if (is_clobbered)
+    {
+      tau_mutex_lock(&na->mtx);
+      na->clobber_count++;
+      tau_mutex_unlock(&na->mtx);
+    }
+  }
+}
+
+TEST_CASE(submit_and_wait)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(4);
+
+  tau_promise_t promises[16];
+  tau_future_t futures[16];
+
+  for (intptr_t i = 0; i < 16; i++)
+  {
+    tau_promise_init(&promises[i]);
+    tau_threadpool_submit(pool, double_task, (void*)i, &promises[i], &futures[i]);
+  }
+
+  for (intptr_t i = 0; i < 16; i++)
+  {
+    tau_threadpool_wait(pool, &futures[i]);
+    TEST_ASSERT_EQUAL((intptr_t)tau_future_get_value(&futures[i]), i * 2);
+  }
+
+  for (size_t i = 0; i < 16; i++)
+  {
+    tau_future_free(&futures[i]);
+    tau_promise_free(&promises[i]);
+  }
+
+  tau_threadpool_free(pool);
+}
+
+TEST_CASE(spawn_runs_all_before_free)
+{
+  count_arg_t ca;
+  tau_mutex_init(&ca.mtx);
+  ca.count = 0;
+
+  tau_threadpool_t* pool = tau_threadpool_init(3);
+
+  for (int i = 0; i < 1000; i++)
+    tau_threadpool_spawn(pool, count_task, &ca);
+
+  tau_threadpool_free(pool);
+
+  TEST_ASSERT_EQUAL(ca.count, 1000);
+
+  tau_mutex_free(&ca.mtx);
+}
+
+TEST_CASE(nested_wait)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(2);
+
+  fib_arg_t arg = { pool, 16 };
+  TEST_ASSERT_EQUAL((intptr_t)fib_task(&arg), 987);
+
+  tau_threadpool_free(pool);
+}
+
+TEST_CASE(parallel_for_covers_range)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(4);
+
+  int values[1000] = { 0 };
+
+  tau_threadpool_parallel_for(pool, 0, 1000, 7, increment_range, values);
+  tau_threadpool_parallel_for(pool, 10, 20, 100, increment_range, values);
+  tau_threadpool_parallel_for(pool, 5, 5, 1, increment_range, values);
+
+  for (size_t i = 0; i < 1000; i++)
+    TEST_ASSERT_EQUAL(values[i], 10 <= i && i < 20 ? 2 : 1);
+
+  tau_threadpool_free(pool);
+}
+
+TEST_CASE(nested_parallel_for_keeps_thread_state)
+{
+  nested_arg_t na = { .pool = tau_threadpool_init(3) };
+  tau_mutex_init(&na.mtx);
+
+  tau_threadpool_parallel_for(na.pool, 0, 16, 1, outer_range, &na);
+
+  TEST_ASSERT_EQUAL(na.clobber_count, 0);
+
+  for (size_t i = 0; i < 16; i++)
+    for (size_t j = 0; j < 64; j++)
+      TEST_ASSERT_EQUAL(na.values[i][j], 1);
+
+  tau_mutex_free(&na.mtx);
+  tau_threadpool_free(na.pool);
+}
+
+TEST_CASE(zero_threads)
+{
+  tau_threadpool_t* pool = tau_threadpool_init(0);
+
+  int values[100] = { 0 };
+  tau_threadpool_parallel_for(pool, 0, 100, 3, increment_range, values);
+
+  for (size_t i = 0; i < 100; i++)
+    TEST_ASSERT_EQUAL(values[i], 1);
+
+  fib_arg_t arg = { pool, 10 };
+  TEST_ASSERT_EQUAL((intptr_t)fib_task(&arg), 55);
+
+  count_arg_t ca;
+  tau_mutex_init(&ca.mtx);
+  ca.count = 0;
+
+  tau_threadpool_spawn(pool, count_task, &ca);
+  tau_threadpool_free(pool);
+
+  TEST_ASSERT_EQUAL(ca.count, 1);
+
+  tau_mutex_free(&ca.mtx);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(submit_and_wait);
+  TEST_RUN(spawn_runs_all_before_free);
+  TEST_RUN(nested_wait);
+  TEST_RUN(parallel_for_covers_range);
+  TEST_RUN(nested_parallel_for_keeps_thread_state);
+  TEST_RUN(zero_threads);
+}
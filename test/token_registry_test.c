@@ -0,0 +1,52 @@
+#include "test.h"
+
+#include "stages/lexer/token/registry.h"
+
+TEST_CASE(tau_token_registry_register_file)
+{
+  uint32_t a = tau_token_registry_register_file("a.tau", "fun a");
+  uint32_t b = tau_token_registry_register_file("b.tau", "fun b");
+
+  TEST_ASSERT_NOT_EQUAL(a, b);
+  TEST_ASSERT_EQUAL(tau_token_registry_register_file("a.tau", "fun a"), a);
+
+  tau_token_registry_free();
+}
+
+TEST_CASE(tau_token_registry_file_info)
+{
+  const char* paths[] = { "a.tau", "b.tau", "c.tau" };
+  const char* srcs[] = { "fun a", "fun b", "fun c" };
+  uint32_t files[3];
+
+  for (size_t i = 0; i < 3; i++)
+    files[i] = tau_token_registry_register_file(paths[i], srcs[i]);
+
+  for (size_t i = 0; i < 3; i++)
+  {
+    tau_token_t* tok = tau_token_registry_token_init(files[i], TAU_TOK_ID, 4);
+
+    TEST_ASSERT_NOT_NULL(tok);
+    TEST_ASSERT_EQUAL(tok->file, files[i]);
+
+    const char* path = NULL;
+    const char* src = NULL;
+    tau_line_index_t* lines = NULL;
+
+    tau_token_registry_file_info(tok, &path, &src, &lines);
+
+    TEST_ASSERT_STR_EQUAL(path, paths[i]);
+    TEST_ASSERT_STR_EQUAL(src, srcs[i]);
+    TEST_ASSERT_NOT_NULL(lines);
+  }
+
+  TEST_ASSERT_NULL(tau_token_registry_token_init(3, TAU_TOK_ID, 0));
+
+  tau_token_registry_free();
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_token_registry_register_file);
+  TEST_RUN(tau_token_registry_file_info);
+}
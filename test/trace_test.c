@@ -0,0 +1,66 @@
+#include "test.h"
+
+#include <string.h>
+
+#include "utils/trace.h"
+#include "utils/io/file.h"
+
+#define TRACE_TEST_PATH "trace_test.tmp"
+
+/**
+ * \brief Reads the written trace into a buffer.
+ */
+static void trace_test_read(char* buf, size_t len)
+{
+  tau_path_t* path = tau_path_init_with_cstr(TRACE_TEST_PATH);
+
+  tau_file_read(path, buf, len);
+
+  tau_path_free(path);
+}
+
+TEST_CASE(tau_trace_disabled)
+{
+  TEST_ASSERT_FALSE(tau_trace_is_enabled());
+
+  tau_trace_begin("ignored");
+  tau_trace_end();
+
+  TEST_ASSERT_FALSE(tau_trace_write(TRACE_TEST_PATH));
+}
+
+TEST_CASE(tau_trace_write)
+{
+  tau_trace_init();
+
+  TEST_ASSERT(tau_trace_is_enabled());
+
+  tau_trace_begin("outer");
+  tau_trace_begin_with_detail("inner", "a \"quoted\" name and more", 15);
+  tau_trace_end();
+  tau_trace_end();
+  tau_trace_begin("open");
+
+  TEST_ASSERT(tau_trace_write(TRACE_TEST_PATH));
+
+  char buf[4096];
+  trace_test_read(buf, sizeof(buf));
+
+  TEST_ASSERT(strstr(buf, "{\"traceEvents\":[") == buf);
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"name\":\"outer\""));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"name\":\"inner\""));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"args\":{\"detail\":\"a \\\"quoted\\\" name\"}"));
+  TEST_ASSERT_NOT_NULL(strstr(buf, "\"name\":\"open\""));
+
+  tau_trace_free();
+
+  TEST_ASSERT_FALSE(tau_trace_is_enabled());
+
+  remove(TRACE_TEST_PATH);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_trace_disabled);
+  TEST_RUN(tau_trace_write);
+}
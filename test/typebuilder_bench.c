@@ -0,0 +1,70 @@
+#include "bench.h"
+
+#include "llvm.h"
+#include "stages/analysis/types/typebuilder.h"
+
+/// The number of distinct array and function types built.
+#define TYPEBUILDER_BENCH_COUNT ((size_t)10000)
+
+/**
+ * \brief Builds arrays of increasing length and functions taking them as
+ * parameters.
+ */
+static void typebuilder_bench_build(tau_typebuilder_t* builder, tau_typedesc_t** types)
+{
+  tau_typedesc_t* i32 = tau_typebuilder_build_i32(builder);
+
+  for (size_t i = 0; i < TYPEBUILDER_BENCH_COUNT; i++)
+    types[i] = tau_typebuilder_build_array(builder, i + 1, i32);
+
+  for (size_t i = 0; i < TYPEBUILDER_BENCH_COUNT; i++)
+    types[TYPEBUILDER_BENCH_COUNT + i] = tau_typebuilder_build_fun(builder, i32, &types[i], 1, false, TAU_CALLCONV_TAU);
+}
+
+BENCH_CASE(tau_typebuilder_build_distinct_types)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typedesc_t** types = (tau_typedesc_t**)malloc(sizeof(tau_typedesc_t*) * TYPEBUILDER_BENCH_COUNT * 2);
+
+  // Every operation builds all types in a fresh type builder.
+  BENCH_LOOP(1)
+  {
+    tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+    typebuilder_bench_build(builder, types);
+    tau_typebuilder_free(builder);
+  }
+
+  free(types);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+BENCH_CASE(tau_typebuilder_lookup_distinct_types)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+  tau_typedesc_t** types = (tau_typedesc_t**)malloc(sizeof(tau_typedesc_t*) * TYPEBUILDER_BENCH_COUNT * 2);
+
+  typebuilder_bench_build(builder, types);
+
+  tau_typedesc_t* i32 = tau_typebuilder_build_i32(builder);
+
+  // Every operation finds an existing function type.
+  BENCH_LOOP(TYPEBUILDER_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_typebuilder_build_fun(builder, i32, &types[bench_iteration], 1, false, TAU_CALLCONV_TAU));
+  }
+
+  free(types);
+  tau_typebuilder_free(builder);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_typebuilder_build_distinct_types);
+  TEST_RUN(tau_typebuilder_lookup_distinct_types);
+}
@@ -0,0 +1,120 @@
+#include "test.h"
+
+#include "ast/ast.h"
+#include "llvm.h"
+#include "stages/analysis/types/typebuilder.h"
+
+TEST_CASE(tau_typebuilder_modifiers)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+
+  tau_typedesc_t* i32 = tau_typebuilder_build_i32(builder);
+  tau_typedesc_t* i64 = tau_typebuilder_build_i64(builder);
+
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_ptr(builder, i32), tau_typebuilder_build_ptr(builder, i32));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_ptr(builder, i32) != tau_typebuilder_build_ptr(builder, i64));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_ptr(builder, i32) != tau_typebuilder_build_ref(builder, i32));
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_array(builder, 4, i32), tau_typebuilder_build_array(builder, 4, i32));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_array(builder, 4, i32) != tau_typebuilder_build_array(builder, 5, i32));
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_mat(builder, 2, 3, i32), tau_typebuilder_build_mat(builder, 2, 3, i32));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_mat(builder, 2, 3, i32) != tau_typebuilder_build_mat(builder, 3, 2, i32));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_vec(builder, 4, i32) != tau_typebuilder_build_array(builder, 4, i32));
+
+  tau_typebuilder_free(builder);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+TEST_CASE(tau_typebuilder_fun)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+
+  tau_typedesc_t* i32 = tau_typebuilder_build_i32(builder);
+  tau_typedesc_t* i64 = tau_typebuilder_build_i64(builder);
+  tau_typedesc_t* unit = tau_typebuilder_build_unit(builder);
+
+  tau_typedesc_t* params1[] = { i32, i64 };
+  tau_typedesc_t* params2[] = { i32, i64 };
+  tau_typedesc_t* params3[] = { i64, i32 };
+
+  tau_typedesc_t* fun = tau_typebuilder_build_fun(builder, unit, params1, 2, false, TAU_CALLCONV_TAU);
+
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_fun(builder, unit, params2, 2, false, TAU_CALLCONV_TAU), fun);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_fun(builder, unit, params3, 2, false, TAU_CALLCONV_TAU) != fun);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_fun(builder, unit, params1, 1, false, TAU_CALLCONV_TAU) != fun);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_fun(builder, i32, params1, 2, false, TAU_CALLCONV_TAU) != fun);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_fun(builder, unit, params1, 2, true, TAU_CALLCONV_TAU) != fun);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_fun(builder, unit, params1, 2, false, TAU_CALLCONV_CDECL) != fun);
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_fun(builder, unit, NULL, 0, false, TAU_CALLCONV_TAU), tau_typebuilder_build_fun(builder, unit, NULL, 0, false, TAU_CALLCONV_TAU));
+
+  tau_typebuilder_free(builder);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+TEST_CASE(tau_typebuilder_nominal)
+{
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+  tau_ast_node_t* nodes = (tau_ast_node_t*)calloc(2, sizeof(tau_ast_node_t));
+
+  tau_typedesc_t* fields[] = { tau_typebuilder_build_i32(builder) };
+
+  // Unions declared by different nodes are distinct even if their fields match.
+  tau_typedesc_t* desc = tau_typebuilder_build_union(builder, &nodes[0], fields, 1);
+
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_union(builder, &nodes[0], fields, 1), desc);
+  TEST_ASSERT_TRUE(tau_typebuilder_build_union(builder, &nodes[1], fields, 1) != desc);
+
+  TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_var(builder, 7), tau_typebuilder_build_var(builder, 7));
+  TEST_ASSERT_TRUE(tau_typebuilder_build_var(builder, 7) != tau_typebuilder_build_var(builder, 8));
+
+  free(nodes);
+  tau_typebuilder_free(builder);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+TEST_CASE(tau_typebuilder_distinct_types)
+{
+  enum { COUNT = 100000 };
+
+  LLVMContextRef llvm_context = LLVMContextCreate();
+  LLVMTargetDataRef llvm_layout = LLVMCreateTargetData("");
+  tau_typebuilder_t* builder = tau_typebuilder_init(llvm_context, llvm_layout);
+
+  tau_typedesc_t* i32 = tau_typebuilder_build_i32(builder);
+  tau_typedesc_t** types = (tau_typedesc_t**)malloc(sizeof(tau_typedesc_t*) * COUNT * 2);
+
+  // Arrays are created in increasing length and functions take the arrays as
+  // parameters, the worst case for an ordered tree keyed on the same fields.
+  for (size_t i = 0; i < COUNT; i++)
+    types[i] = tau_typebuilder_build_array(builder, i + 1, i32);
+
+  for (size_t i = 0; i < COUNT; i++)
+    types[COUNT + i] = tau_typebuilder_build_fun(builder, i32, &types[i], 1, false, TAU_CALLCONV_TAU);
+
+  for (size_t i = 0; i < COUNT; i++)
+    TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_array(builder, i + 1, i32), types[i]);
+
+  for (size_t i = 0; i < COUNT; i++)
+    TEST_ASSERT_PTR_EQUAL(tau_typebuilder_build_fun(builder, i32, &types[i], 1, false, TAU_CALLCONV_TAU), types[COUNT + i]);
+
+  free(types);
+  tau_typebuilder_free(builder);
+  LLVMDisposeTargetData(llvm_layout);
+  LLVMContextDispose(llvm_context);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_typebuilder_modifiers);
+  TEST_RUN(tau_typebuilder_fun);
+  TEST_RUN(tau_typebuilder_nominal);
+  TEST_RUN(tau_typebuilder_distinct_types);
+}
@@ -0,0 +1,62 @@
+#include "bench.h"
+
+#include "ast/ast.h"
+#include "stages/analysis/types/typetable.h"
+
+/// The number of nodes of the tables.
+#define TYPETABLE_BENCH_COUNT ((size_t)1000)
+
+static tau_ast_node_t* g_typetable_bench_nodes[TYPETABLE_BENCH_COUNT];
+
+/**
+ * \brief Returns the i-th node in a pseudo-random order.
+ */
+static tau_ast_node_t* typetable_bench_node(size_t i)
+{
+  // 613 is coprime with the node count.
+  return g_typetable_bench_nodes[i * 613 % TYPETABLE_BENCH_COUNT];
+}
+
+BENCH_CASE(tau_typetable_insert)
+{
+  tau_typetable_t* table = tau_typetable_init();
+  tau_typedesc_t* desc = (tau_typedesc_t*)tau_typedesc_prim_i32_init();
+
+  BENCH_LOOP(TYPETABLE_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_typetable_insert(table, typetable_bench_node(bench_iteration), desc));
+  }
+
+  tau_typedesc_free(desc);
+  tau_typetable_free(table);
+}
+
+BENCH_CASE(tau_typetable_lookup)
+{
+  tau_typetable_t* table = tau_typetable_init();
+  tau_typedesc_t* desc = (tau_typedesc_t*)tau_typedesc_prim_i32_init();
+
+  for (size_t i = 0; i < TYPETABLE_BENCH_COUNT; i++)
+    tau_typetable_insert(table, g_typetable_bench_nodes[i], desc);
+
+  BENCH_LOOP(TYPETABLE_BENCH_COUNT)
+  {
+    BENCH_DO_NOT_OPTIMIZE(tau_typetable_lookup(table, typetable_bench_node(bench_iteration)));
+  }
+
+  tau_typedesc_free(desc);
+  tau_typetable_free(table);
+}
+
+TEST_MAIN()
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  for (size_t i = 0; i < TYPETABLE_BENCH_COUNT; i++)
+    g_typetable_bench_nodes[i] = (tau_ast_node_t*)tau_ast_id_init(arena);
+
+  TEST_RUN(tau_typetable_insert);
+  TEST_RUN(tau_typetable_lookup);
+
+  tau_arena_free(arena);
+}
@@ -0,0 +1,69 @@
+#include "test.h"
+
+#include "ast/ast.h"
+#include "stages/analysis/types/typetable.h"
+
+TEST_CASE(tau_typetable_insert)
+{
+  tau_arena_t* arena = tau_arena_init();
+  tau_typetable_t* table = tau_typetable_init();
+
+  tau_ast_node_t* lhs = (tau_ast_node_t*)tau_ast_id_init(arena);
+  tau_ast_node_t* rhs = (tau_ast_node_t*)tau_ast_id_init(arena);
+
+  tau_typedesc_t* desc1 = (tau_typedesc_t*)tau_typedesc_prim_i32_init();
+  tau_typedesc_t* desc2 = (tau_typedesc_t*)tau_typedesc_prim_i64_init();
+
+  TEST_ASSERT_EQUAL(rhs->uid, lhs->uid + 1);
+  TEST_ASSERT_NULL(tau_typetable_lookup(table, lhs));
+
+  TEST_ASSERT_NULL(tau_typetable_insert(table, lhs, desc1));
+  TEST_ASSERT_PTR_EQUAL(tau_typetable_lookup(table, lhs), desc1);
+  TEST_ASSERT_NULL(tau_typetable_lookup(table, rhs));
+
+  TEST_ASSERT_PTR_EQUAL(tau_typetable_insert(table, lhs, desc2), desc1);
+  TEST_ASSERT_PTR_EQUAL(tau_typetable_lookup(table, lhs), desc2);
+
+  tau_typedesc_free(desc1);
+  tau_typedesc_free(desc2);
+  tau_typetable_free(table);
+  tau_arena_free(arena);
+}
+
+TEST_CASE(tau_typetable_merge)
+{
+  tau_arena_t* arena = tau_arena_init();
+  tau_typetable_t* dest = tau_typetable_init();
+  tau_typetable_t* src = tau_typetable_init();
+
+  tau_ast_node_t* lhs = (tau_ast_node_t*)tau_ast_id_init(arena);
+  tau_typedesc_t* desc1 = (tau_typedesc_t*)tau_typedesc_prim_i32_init();
+
+  TEST_ASSERT_NULL(tau_typetable_insert(dest, lhs, desc1));
+
+  // Nodes created after the destination was filled are beyond its capacity.
+  tau_ast_node_t* rhs = NULL;
+
+  for (size_t i = 0; i < 1000; i++)
+    rhs = (tau_ast_node_t*)tau_ast_id_init(arena);
+
+  tau_typedesc_t* desc2 = (tau_typedesc_t*)tau_typedesc_prim_i64_init();
+
+  TEST_ASSERT_NULL(tau_typetable_insert(src, rhs, desc2));
+
+  tau_typetable_merge(dest, src);
+
+  TEST_ASSERT_PTR_EQUAL(tau_typetable_lookup(dest, lhs), desc1);
+  TEST_ASSERT_PTR_EQUAL(tau_typetable_lookup(dest, rhs), desc2);
+
+  tau_typedesc_free(desc1);
+  tau_typedesc_free(desc2);
+  tau_typetable_free(dest);
+  tau_arena_free(arena);
+}
+
+TEST_MAIN()
+{
+  TEST_RUN(tau_typetable_insert);
+  TEST_RUN(tau_typetable_merge);
+}
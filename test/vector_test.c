@@ -11,6 +11,33 @@ TEST_CASE(tau_vector_init)
   tau_vector_free(vec);
 }
 
+TEST_CASE(tau_vector_init_with_arena)
+{
+  tau_arena_t* arena = tau_arena_init();
+
+  tau_vector_t* vec = tau_vector_init_with_arena(arena);
+
+  TEST_ASSERT_NOT_NULL(vec);
+  TEST_ASSERT_TRUE(tau_arena_owns(arena, vec));
+
+  int data[100];
+
+  for (size_t i = 0; i < 100; i++)
+    tau_vector_push(vec, &data[i]);
+
+  TEST_ASSERT_EQUAL(tau_vector_size(vec), 100);
+
+  for (size_t i = 0; i < 100; i++)
+    TEST_ASSERT_PTR_EQUAL(tau_vector_get(vec, i), &data[i]);
+
+  tau_vector_clear(vec);
+
+  TEST_ASSERT_TRUE(tau_vector_empty(vec));
+
+  tau_vector_free(vec);
+  tau_arena_free(arena);
+}
+
 TEST_CASE(tau_vector_init_from_buffer_empty)
 {
   tau_vector_t* vec = tau_vector_init_from_buffer(NULL, 0);
@@ -192,6 +219,7 @@ TEST_CASE(tau_vector_to_buffer)
 TEST_MAIN()
 {
   TEST_RUN(tau_vector_init);
+  TEST_RUN(tau_vector_init_with_arena);
   TEST_RUN(tau_vector_init_from_buffer_empty);
   TEST_RUN(tau_vector_init_from_buffer);
   TEST_RUN(tau_vector_push);